@@ -3,8 +3,14 @@
 #ifndef MTEA_H
 #define MTEA_H
 
+#include <algorithm>
 #include <array>
+#include <atomic>
 #include <cstddef>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+#include <utility>
 #include <sstream>
 
 #include "mtea_except.hpp"
@@ -13,6 +19,7 @@
 
 #ifdef MTEA_USE_FULL_LIB
 #include "mtea_string.hpp"
+#include <iomanip>
 #include <sstream>
 #endif
 
@@ -26,8 +33,51 @@ namespace mtea {
 #define MT_COMPAT_OVERRIDE
 #endif
 
+#if defined(__GNUC__) || defined(__clang__)
+#define MT_PREFETCH(ptr) __builtin_prefetch(ptr)
+#else
+#define MT_PREFETCH(ptr)
+#endif
+
 using time_step_t = double;
 
+// Computes the dot product with independent partial sums, allowing the loop to be vectorized without reassociating
+// floating point additions
+template <typename T>
+T dot_product(const T* a, const T* b, const size_t num) noexcept {
+    T acc[4] = {0, 0, 0, 0};
+
+    size_t i = 0;
+    for (; i + 4 <= num; i += 4) {
+        acc[0] += a[i] * b[i];
+        acc[1] += a[i + 1] * b[i + 1];
+        acc[2] += a[i + 2] * b[i + 2];
+        acc[3] += a[i + 3] * b[i + 3];
+    }
+
+    for (; i < num; ++i) {
+        acc[0] += a[i] * b[i];
+    }
+
+    return (acc[0] + acc[1]) + (acc[2] + acc[3]);
+}
+
+#ifdef MTEA_USE_FULL_LIB
+template <DataType DT>
+std::string parameter_to_string(const typename type_info<DT>::type_t value) {
+    using data_t = typename type_info<DT>::type_t;
+    std::ostringstream oss;
+
+    if constexpr (DT == DataType::BOOL) {
+        oss << (value ? "true" : "false");
+    } else {
+        oss << std::setprecision(std::numeric_limits<data_t>::max_digits10) << +value;
+    }
+
+    return oss.str();
+}
+#endif // MTEA_USE_FULL_LIB
+
 template <DataType DT, ArithType AT>
 struct ArithOperation {};
 
@@ -154,6 +204,20 @@ struct arith_block_dynamic MT_COMPAT_SUBCLASS {
         return 1;
     }
 
+    bool is_stateless() const noexcept override { return true; }
+
+    size_t get_state_size() const noexcept override {
+        return sizeof(s_out);
+    }
+
+    void save_state(void* data) const noexcept override {
+        write_state_values(data, s_out);
+    }
+
+    void load_state(const void* data) noexcept override {
+        read_state_values(data, s_out);
+    }
+
     DataType get_input_type(size_t port_num) const override {
         if (port_num < s_in.size) {
             return DT;
@@ -241,12 +305,175 @@ protected:
         oss << "arith_block<" << datatype_to_string(DT) << ", " << arith_to_string(AT) << ", " << SIZE << ">";
         return oss.str();
     }
+
+public:
+    std::unique_ptr<block_interface> clone() const override {
+        auto blk = std::make_unique<arith_block>();
+        blk->_input_array = _input_array;
+        blk->s_out = this->s_out;
+        return blk;
+    }
 #endif
 
 private:
     std::array<data_t, SIZE> _input_array;
 };
 
+template <DataType DT, ArithType AT>
+struct arith_block_const MT_COMPAT_SUBCLASS {
+    using data_t = typename type_info<DT>::type_t;
+
+    struct input_t {
+        data_t value;
+    };
+
+    struct output_t {
+        data_t value;
+    };
+
+    explicit arith_block_const(const data_t val) : operand{val} {}
+
+    arith_block_const(const arith_block_const&) = delete;
+    arith_block_const& operator=(const arith_block_const&) = delete;
+
+    void reset() noexcept MT_COMPAT_OVERRIDE { step(); }
+
+    void step() noexcept MT_COMPAT_OVERRIDE {
+        s_out.value = ArithOperation<DT, AT>::operation(s_in.value, operand);
+    }
+
+#ifdef MTEA_USE_FULL_LIB
+    explicit arith_block_const(const Argument* value) : arith_block_const(get_model_value<DT>(value)) {}
+
+    using type_info_t = arith_block_types;
+    block_types get_supported_types() const noexcept override {
+        return block_types{
+            .uses_integral = type_info_t::uses_integral,
+            .uses_float = type_info_t::uses_float,
+            .uses_logical = type_info_t::uses_logical,
+        };
+    }
+
+    DataType get_current_type() const noexcept override {
+        return DT;
+    }
+
+    void set_input(size_t port_num, const Argument* value) override {
+        if (port_num == 0) {
+            set_input_value<DT>(s_in.value, value);
+        } else {
+            throw block_error("input port too high");
+        }
+    }
+
+    void get_output(size_t port_num, Argument* value) const override {
+        if (port_num == 0) {
+            get_output_value<DT>(s_out.value, value);
+        } else {
+            throw block_error("output port too high");
+        }
+    }
+
+    size_t get_input_num() const noexcept override {
+        return 1;
+    }
+
+    bool get_input_type_settable(size_t port_num) const noexcept override {
+        return port_num < get_input_num();
+    }
+
+    size_t get_output_num() const noexcept override {
+        return 1;
+    }
+
+    bool is_stateless() const noexcept override { return true; }
+
+    size_t get_state_size() const noexcept override {
+        return sizeof(s_out);
+    }
+
+    void save_state(void* data) const noexcept override {
+        write_state_values(data, s_out);
+    }
+
+    void load_state(const void* data) noexcept override {
+        read_state_values(data, s_out);
+    }
+
+    DataType get_input_type(size_t port_num) const override {
+        if (port_num < get_input_num()) {
+            return DT;
+        } else {
+            throw block_error("input port too high");
+        }
+    }
+
+    DataType get_output_type(size_t port_num) const override {
+        if (port_num == 0) {
+            return DT;
+        } else {
+            throw block_error("output port too high");
+        }
+    }
+
+    std::string get_input_name(size_t port_num) const override {
+        if (port_num == 0) {
+            return "value";
+        } else {
+            throw block_error("input port too high");
+        }
+    }
+
+    std::string get_output_name(size_t port_num) const override {
+        if (port_num == 0) {
+            return "value";
+        } else {
+            throw block_error("output port too high");
+        }
+    }
+
+    std::string get_parameters() const override {
+        return parameter_to_string<DT>(operand);
+    }
+
+protected:
+    std::string get_class_name() const override {
+        std::ostringstream oss;
+        oss << "arith_block_const<" << datatype_to_string(DT) << ", " << arith_to_string(AT) << '>';
+        return oss.str();
+    }
+
+public:
+    std::string get_block_name() const override {
+        if constexpr (AT == ArithType::ADD) {
+            return BLK_NAME_ARITH_ADD_CONST;
+        } else if constexpr (AT == ArithType::SUB) {
+            return BLK_NAME_ARITH_SUB_CONST;
+        } else if constexpr (AT == ArithType::MUL) {
+            return BLK_NAME_ARITH_MUL_CONST;
+        } else if constexpr (AT == ArithType::DIV) {
+            return BLK_NAME_ARITH_DIV_CONST;
+        } else if constexpr (AT == ArithType::MOD) {
+            return BLK_NAME_ARITH_MOD_CONST;
+        } else {
+            static_assert("unknown arithmetic type provided");
+        }
+    }
+
+    std::unique_ptr<block_interface> clone() const override {
+        auto blk = std::make_unique<arith_block_const>(operand);
+        blk->s_in = s_in;
+        blk->s_out = s_out;
+        return blk;
+    }
+#endif
+
+    input_t s_in;
+    output_t s_out;
+
+    const data_t operand;
+};
+
 #ifdef MTEA_USE_FULL_LIB
 struct clock_block_types {
     static constexpr bool uses_integral = false;
@@ -277,6 +504,8 @@ struct clock_block MT_COMPAT_SUBCLASS {
 #ifdef MTEA_USE_FULL_LIB
     explicit clock_block(const Argument* input) : clock_block(get_model_value<DT>(input)) {}
 
+    void set_time_step(double dt) noexcept override { time_step = static_cast<data_t>(dt); }
+
     using type_info_t = clock_block_types;
     block_types get_supported_types() const noexcept override {
         return block_types{
@@ -334,6 +563,22 @@ struct clock_block MT_COMPAT_SUBCLASS {
         }
     }
 
+    size_t get_state_size() const noexcept override {
+        return sizeof(s_out);
+    }
+
+    void save_state(void* data) const noexcept override {
+        write_state_values(data, s_out);
+    }
+
+    void load_state(const void* data) noexcept override {
+        read_state_values(data, s_out);
+    }
+
+    std::string get_parameters() const override {
+        return parameter_to_string<DT>(time_step);
+    }
+
 protected:
     std::string get_class_name() const override {
         return (std::ostringstream{} << "clock_block<" << datatype_to_string(DT) << '>').str();
@@ -343,11 +588,17 @@ public:
     std::string get_block_name() const override {
         return BLK_NAME_CLOCK;
     }
+
+    std::unique_ptr<block_interface> clone() const override {
+        auto blk = std::make_unique<clock_block>(time_step);
+        blk->s_out = s_out;
+        return blk;
+    }
 #endif
 
     output_t s_out;
 
-    const data_t time_step;
+    data_t time_step;
 };
 
 #ifdef MTEA_USE_FULL_LIB
@@ -415,6 +666,8 @@ struct const_block MT_COMPAT_SUBCLASS {
         return 1;
     }
 
+    bool is_stateless() const noexcept override { return true; }
+
     DataType get_input_type(size_t port_num) const override {
         throw block_error("input port too high");
     }
@@ -439,6 +692,10 @@ struct const_block MT_COMPAT_SUBCLASS {
         }
     }
 
+    std::string get_parameters() const override {
+        return parameter_to_string<DT>(s_out.value);
+    }
+
 protected:
     std::string get_class_name() const override {
         std::ostringstream oss;
@@ -450,6 +707,11 @@ public:
     std::string get_block_name() const override {
         return BLK_NAME_CONST;
     }
+
+    std::unique_ptr<block_interface> clone() const override {
+        auto blk = std::make_unique<const_block>(s_out.value);
+        return blk;
+    }
 #endif
 };
 
@@ -553,11 +815,16 @@ public:
     std::string get_block_name() const override {
         return BLK_NAME_CONST_PTR;
     }
+
+    std::unique_ptr<block_interface> clone() const override {
+        auto blk = std::make_unique<const_ptr_block>(s_out.value);
+        return blk;
+    }
 #endif
 };
 
 #ifdef MTEA_USE_FULL_LIB
-struct delay_block_types {
+struct source_block_types {
     static constexpr bool uses_integral = true;
     static constexpr bool uses_float = true;
     static constexpr bool uses_logical = true;
@@ -565,43 +832,65 @@ struct delay_block_types {
 #endif // MTEA_USE_FULL_LIB
 
 template <DataType DT>
-struct delay_block MT_COMPAT_SUBCLASS {
+struct source_block MT_COMPAT_SUBCLASS {
     using data_t = typename type_info<DT>::type_t;
 
-    struct input_t {
-        data_t value;
-        data_t reset;
-        bool reset_flag;
-    };
-
     struct output_t {
         data_t value;
     };
 
-    delay_block() = default;
-    delay_block(const delay_block&) = delete;
-    delay_block& operator=(const delay_block&) = delete;
+    // Outputs the samples of an externally owned buffer, such as a memory-mapped file, advancing sample_step samples
+    // per step. Float types are linearly interpolated between samples, and the last sample is held past the end.
+    source_block(const data_t* data, const size_t sample_num, const double sample_step = 1.0) : s_out{}, sample_step{sample_step}, data{data}, sample_num{sample_num}, position{0.0}, previous{}, final_value{sample_num > 0 ? data[sample_num - 1] : data_t{}} {
+        // Empty Constructor
+    }
+
+    source_block(const source_block&) = delete;
+    source_block& operator=(const source_block&) = delete;
 
     void reset() noexcept MT_COMPAT_OVERRIDE {
-        next_value = s_in.reset;
-        s_out.value = s_in.reset;
+        position = 0.0;
+        update_output();
     }
 
     void step() noexcept MT_COMPAT_OVERRIDE {
-        if (s_in.reset_flag) {
-            reset();
+        position += sample_step;
+        update_output();
+    }
+
+    // Replaces the sample buffer with the chunk following the current buffer, such that a long input may be provided
+    // in consecutive chunks once is_finished() returns true. The final sample of the current buffer is kept, so that
+    // float types interpolate across the boundary into the first sample of the new chunk. As the final sample is
+    // copied when a buffer is provided, the previous buffer may already be reused by a producer, such as the prefetch
+    // of a csv_reader, by the time the next chunk is set.
+    void set_data(const data_t* new_data, const size_t new_sample_num) noexcept {
+        position = is_finished() ? position - static_cast<double>(sample_num) : 0.0;
+
+        if (sample_num > 0) {
+            previous = final_value;
         }
 
-        s_out.value = next_value;
-        next_value = s_in.value;
+        data = new_data;
+        sample_num = new_sample_num;
+        final_value = sample_num > 0 ? data[sample_num - 1] : data_t{};
+        update_output();
     }
 
-#ifdef MTEA_USE_FULL_LIB
-    static const size_t PORT_VALUE_NUM = 0;
-    static const size_t PORT_RESET_NUM = 1;
-    static const size_t PORT_FLAG_NUM = 2;
+    size_t get_sample_index() const noexcept {
+        return position > 0.0 ? static_cast<size_t>(position) : 0;
+    }
 
-    using type_info_t = delay_block_types;
+    // Checks whether the output requires samples past the end of the current buffer
+    bool is_finished() const noexcept {
+        return position > static_cast<double>(sample_num) - 1.0;
+    }
+
+    output_t s_out;
+
+    double sample_step;
+
+#ifdef MTEA_USE_FULL_LIB
+    using type_info_t = source_block_types;
     block_types get_supported_types() const noexcept override {
         return block_types{
             .uses_integral = type_info_t::uses_integral,
@@ -615,31 +904,23 @@ struct delay_block MT_COMPAT_SUBCLASS {
     }
 
     void set_input(size_t port_num, const Argument* value) override {
-        if (port_num == PORT_VALUE_NUM) {
-            set_input_value<DT>(s_in.value, value);
-        } else if (port_num == PORT_RESET_NUM) {
-            set_input_value<DT>(s_in.reset, value);
-        } else if (port_num == PORT_FLAG_NUM) {
-            set_input_value<DataType::BOOL>(s_in.reset_flag, value);
-        } else {
-            throw block_error("input port too high");
-        }
+        throw block_error("input port too high");
     }
 
     void get_output(size_t port_num, Argument* value) const override {
         if (port_num == 0) {
-            get_output_value<DT>(s_out.value, value);
+            return get_output_value<DT>(s_out.value, value);
         } else {
             throw block_error("output port too high");
         }
     }
 
     size_t get_input_num() const noexcept override {
-        return 3;
+        return 0;
     }
 
     bool get_input_type_settable(size_t port_num) const noexcept override {
-        return port_num < PORT_FLAG_NUM;
+        return false;
     }
 
     size_t get_output_num() const noexcept override {
@@ -647,13 +928,7 @@ struct delay_block MT_COMPAT_SUBCLASS {
     }
 
     DataType get_input_type(size_t port_num) const override {
-        if (port_num == 0 || port_num == 1) {
-            return DT;
-        } else if (port_num == 2) {
-            return DataType::BOOL;
-        } else {
-            throw block_error("input port too high");
-        }
+        throw block_error("input port too high");
     }
 
     DataType get_output_type(size_t port_num) const override {
@@ -664,18 +939,8 @@ struct delay_block MT_COMPAT_SUBCLASS {
         }
     }
 
-    bool outputs_are_delayed() const noexcept override { return true; }
-
     std::string get_input_name(size_t port_num) const override {
-        if (port_num == PORT_VALUE_NUM) {
-            return "value";
-        } else if (port_num == PORT_RESET_NUM) {
-            return "reset";
-        } else if (port_num == PORT_FLAG_NUM) {
-            return "reset_flag";
-        } else {
-            throw block_error("input port too high");
-        }
+        throw block_error("input port too high");
     }
 
     std::string get_output_name(size_t port_num) const override {
@@ -686,39 +951,105 @@ struct delay_block MT_COMPAT_SUBCLASS {
         }
     }
 
+    size_t get_state_size() const noexcept override {
+        return sizeof(s_out) + sizeof(position) + sizeof(previous);
+    }
+
+    void save_state(void* state) const noexcept override {
+        write_state_values(state, s_out, position, previous);
+    }
+
+    void load_state(const void* state) noexcept override {
+        read_state_values(state, s_out, position, previous);
+    }
+
+    std::string get_parameters() const override {
+        return parameter_to_string<DataType::F64>(sample_step);
+    }
+
 protected:
     std::string get_class_name() const override {
         std::ostringstream oss;
-        oss << "delay_block<" << datatype_to_string(DT) << '>';
+        oss << "source_block<" << datatype_to_string(DT) << '>';
         return oss.str();
     }
 
 public:
     std::string get_block_name() const override {
-        return BLK_NAME_DELAY;
+        return BLK_NAME_SOURCE;
+    }
+
+    std::unique_ptr<block_interface> clone() const override {
+        auto blk = std::make_unique<source_block>(data, sample_num, sample_step);
+        blk->s_out = s_out;
+        blk->position = position;
+        blk->previous = previous;
+        return blk;
     }
 #endif
 
-    input_t s_in;
-    output_t s_out;
+protected:
+    static data_t interpolate(const data_t a, const data_t b, const double frac, std::true_type) noexcept {
+        return a + (b - a) * static_cast<data_t>(frac);
+    }
 
-    data_t next_value;
+    static data_t interpolate(const data_t a, const data_t, const double, std::false_type) noexcept {
+        return a;
+    }
+
+    void update_output() noexcept {
+        using is_float_t = std::integral_constant<bool, type_info<DT>::is_float>;
+
+        if (sample_num == 0) {
+            s_out.value = previous;
+            return;
+        }
+
+        // A negative position lies between the final sample of the previous chunk and the first sample of this chunk
+        if (position < 0.0) {
+            s_out.value = interpolate(previous, data[0], position + 1.0, is_float_t{});
+            return;
+        }
+
+        const size_t index = static_cast<size_t>(position);
+
+        if (index + 1 >= sample_num) {
+            s_out.value = data[sample_num - 1];
+            return;
+        }
+
+        const size_t prefetch_index = index + SOURCE_PREFETCH_DISTANCE;
+        if (prefetch_index < sample_num) {
+            MT_PREFETCH(data + prefetch_index);
+        }
+
+        s_out.value = interpolate(data[index], data[index + 1], position - static_cast<double>(index), is_float_t{});
+    }
+
+    static const size_t SOURCE_PREFETCH_DISTANCE = 64 / sizeof(data_t) * 4;
+
+    const data_t* data;
+    size_t sample_num;
+    double position;
+    data_t previous;
+    data_t final_value;
 };
 
 #ifdef MTEA_USE_FULL_LIB
-struct derivative_block_types {
-    static constexpr bool uses_integral = false;
+struct delay_block_types {
+    static constexpr bool uses_integral = true;
     static constexpr bool uses_float = true;
-    static constexpr bool uses_logical = false;
+    static constexpr bool uses_logical = true;
 };
 #endif // MTEA_USE_FULL_LIB
 
 template <DataType DT>
-struct derivative_block MT_COMPAT_SUBCLASS {
+struct delay_block MT_COMPAT_SUBCLASS {
     using data_t = typename type_info<DT>::type_t;
 
     struct input_t {
         data_t value;
+        data_t reset;
         bool reset_flag;
     };
 
@@ -726,16 +1057,13 @@ struct derivative_block MT_COMPAT_SUBCLASS {
         data_t value;
     };
 
-    explicit derivative_block(const time_step_t dt) : s_in{}, s_out{}, time_step(dt) {
-        static_assert(type_info<DT>::is_float, "derivative data type must be a floating point type");
-    }
-
-    derivative_block(const derivative_block&) = delete;
-    derivative_block& operator=(const derivative_block&) = delete;
+    delay_block() = default;
+    delay_block(const delay_block&) = delete;
+    delay_block& operator=(const delay_block&) = delete;
 
     void reset() noexcept MT_COMPAT_OVERRIDE {
-        last_value = {};
-        s_out.value = {};
+        next_value = s_in.reset;
+        s_out.value = s_in.reset;
     }
 
     void step() noexcept MT_COMPAT_OVERRIDE {
@@ -743,14 +1071,16 @@ struct derivative_block MT_COMPAT_SUBCLASS {
             reset();
         }
 
-        s_out.value = (s_in.value - last_value) / time_step;
-        last_value = s_in.value;
+        s_out.value = next_value;
+        next_value = s_in.value;
     }
 
 #ifdef MTEA_USE_FULL_LIB
-    explicit derivative_block(const Argument* dt) : derivative_block(get_model_value<DT>(dt)) {}
+    static const size_t PORT_VALUE_NUM = 0;
+    static const size_t PORT_RESET_NUM = 1;
+    static const size_t PORT_FLAG_NUM = 2;
 
-    using type_info_t = derivative_block_types;
+    using type_info_t = delay_block_types;
     block_types get_supported_types() const noexcept override {
         return block_types{
             .uses_integral = type_info_t::uses_integral,
@@ -764,9 +1094,11 @@ struct derivative_block MT_COMPAT_SUBCLASS {
     }
 
     void set_input(size_t port_num, const Argument* value) override {
-        if (port_num == 0) {
+        if (port_num == PORT_VALUE_NUM) {
             set_input_value<DT>(s_in.value, value);
-        } else if (port_num == 1) {
+        } else if (port_num == PORT_RESET_NUM) {
+            set_input_value<DT>(s_in.reset, value);
+        } else if (port_num == PORT_FLAG_NUM) {
             set_input_value<DataType::BOOL>(s_in.reset_flag, value);
         } else {
             throw block_error("input port too high");
@@ -782,11 +1114,11 @@ struct derivative_block MT_COMPAT_SUBCLASS {
     }
 
     size_t get_input_num() const noexcept override {
-        return 2;
+        return 3;
     }
 
     bool get_input_type_settable(size_t port_num) const noexcept override {
-        return port_num == 0;
+        return port_num < PORT_FLAG_NUM;
     }
 
     size_t get_output_num() const noexcept override {
@@ -794,9 +1126,9 @@ struct derivative_block MT_COMPAT_SUBCLASS {
     }
 
     DataType get_input_type(size_t port_num) const override {
-        if (port_num == 0) {
+        if (port_num == 0 || port_num == 1) {
             return DT;
-        } else if (port_num == 1) {
+        } else if (port_num == 2) {
             return DataType::BOOL;
         } else {
             throw block_error("input port too high");
@@ -813,10 +1145,12 @@ struct derivative_block MT_COMPAT_SUBCLASS {
 
     bool outputs_are_delayed() const noexcept override { return true; }
 
-std::string get_input_name(size_t port_num) const override {
-        if (port_num == 0) {
+    std::string get_input_name(size_t port_num) const override {
+        if (port_num == PORT_VALUE_NUM) {
             return "value";
-        } else if (port_num == 1) {
+        } else if (port_num == PORT_RESET_NUM) {
+            return "reset";
+        } else if (port_num == PORT_FLAG_NUM) {
             return "reset_flag";
         } else {
             throw block_error("input port too high");
@@ -831,41 +1165,51 @@ std::string get_input_name(size_t port_num) const override {
         }
     }
 
+    size_t get_state_size() const noexcept override {
+        return sizeof(s_out) + sizeof(next_value);
+    }
+
+    void save_state(void* data) const noexcept override {
+        write_state_values(data, s_out, next_value);
+    }
+
+    void load_state(const void* data) noexcept override {
+        read_state_values(data, s_out, next_value);
+    }
+
 protected:
     std::string get_class_name() const override {
         std::ostringstream oss;
-        oss << "derivative_block<" << datatype_to_string(DT) << '>';
+        oss << "delay_block<" << datatype_to_string(DT) << '>';
         return oss.str();
     }
 
 public:
     std::string get_block_name() const override {
-        return BLK_NAME_DERIV;
+        return BLK_NAME_DELAY;
+    }
+
+    std::unique_ptr<block_interface> clone() const override {
+        auto blk = std::make_unique<delay_block>();
+        blk->s_in = s_in;
+        blk->s_out = s_out;
+        blk->next_value = next_value;
+        return blk;
     }
 #endif
 
     input_t s_in;
     output_t s_out;
 
-    data_t last_value;
-    const time_step_t time_step;
-};
-
-#ifdef MTEA_USE_FULL_LIB
-struct integrator_block_types {
-    static constexpr bool uses_integral = false;
-    static constexpr bool uses_float = true;
-    static constexpr bool uses_logical = false;
+    data_t next_value;
 };
-#endif // MTEA_USE_FULL_LIB
 
 template <DataType DT>
-struct integrator_block MT_COMPAT_SUBCLASS {
+struct delay_block_const MT_COMPAT_SUBCLASS {
     using data_t = typename type_info<DT>::type_t;
 
     struct input_t {
         data_t value;
-        data_t reset;
         bool reset_flag;
     };
 
@@ -873,31 +1217,32 @@ struct integrator_block MT_COMPAT_SUBCLASS {
         data_t value;
     };
 
-    explicit integrator_block(const time_step_t dt) : time_step(dt) {
-        static_assert(type_info<DT>::is_float, "integrator data type must be a floating point type");
-    }
+    explicit delay_block_const(const data_t reset) : reset_value{reset} {}
 
-    integrator_block(const integrator_block&) = delete;
-    integrator_block& operator=(const integrator_block&) = delete;
+    delay_block_const(const delay_block_const&) = delete;
+    delay_block_const& operator=(const delay_block_const&) = delete;
 
-    void reset() noexcept MT_COMPAT_OVERRIDE { s_out.value = s_in.reset; }
+    void reset() noexcept MT_COMPAT_OVERRIDE {
+        next_value = reset_value;
+        s_out.value = reset_value;
+    }
 
     void step() noexcept MT_COMPAT_OVERRIDE {
         if (s_in.reset_flag) {
             reset();
-        } else {
-            s_out.value += s_in.value * time_step;
         }
+
+        s_out.value = next_value;
+        next_value = s_in.value;
     }
 
 #ifdef MTEA_USE_FULL_LIB
-    explicit integrator_block(const Argument* dt) : integrator_block(get_model_value<DT>(dt)) {}
+    explicit delay_block_const(const Argument* reset) : delay_block_const(get_model_value<DT>(reset)) {}
 
     static const size_t PORT_VALUE_NUM = 0;
-    static const size_t PORT_RESET_NUM = 1;
-    static const size_t PORT_FLAG_NUM = 2;
+    static const size_t PORT_FLAG_NUM = 1;
 
-    using type_info_t = integrator_block_types;
+    using type_info_t = delay_block_types;
     block_types get_supported_types() const noexcept override {
         return block_types{
             .uses_integral = type_info_t::uses_integral,
@@ -913,8 +1258,6 @@ struct integrator_block MT_COMPAT_SUBCLASS {
     void set_input(size_t port_num, const Argument* value) override {
         if (port_num == PORT_VALUE_NUM) {
             set_input_value<DT>(s_in.value, value);
-        } else if (port_num == PORT_RESET_NUM) {
-            set_input_value<DT>(s_in.reset, value);
         } else if (port_num == PORT_FLAG_NUM) {
             set_input_value<DataType::BOOL>(s_in.reset_flag, value);
         } else {
@@ -931,11 +1274,11 @@ struct integrator_block MT_COMPAT_SUBCLASS {
     }
 
     size_t get_input_num() const noexcept override {
-        return 3;
+        return 2;
     }
 
     bool get_input_type_settable(size_t port_num) const noexcept override {
-        return port_num < PORT_FLAG_NUM;
+        return port_num == PORT_VALUE_NUM;
     }
 
     size_t get_output_num() const noexcept override {
@@ -943,9 +1286,9 @@ struct integrator_block MT_COMPAT_SUBCLASS {
     }
 
     DataType get_input_type(size_t port_num) const override {
-        if (port_num == 0 || port_num == 1) {
+        if (port_num == PORT_VALUE_NUM) {
             return DT;
-        } else if (port_num == 2) {
+        } else if (port_num == PORT_FLAG_NUM) {
             return DataType::BOOL;
         } else {
             throw block_error("input port too high");
@@ -965,8 +1308,6 @@ struct integrator_block MT_COMPAT_SUBCLASS {
     std::string get_input_name(size_t port_num) const override {
         if (port_num == PORT_VALUE_NUM) {
             return "value";
-        } else if (port_num == PORT_RESET_NUM) {
-            return "reset";
         } else if (port_num == PORT_FLAG_NUM) {
             return "reset_flag";
         } else {
@@ -982,79 +1323,99 @@ struct integrator_block MT_COMPAT_SUBCLASS {
         }
     }
 
+    size_t get_state_size() const noexcept override {
+        return sizeof(s_out) + sizeof(next_value);
+    }
+
+    void save_state(void* data) const noexcept override {
+        write_state_values(data, s_out, next_value);
+    }
+
+    void load_state(const void* data) noexcept override {
+        read_state_values(data, s_out, next_value);
+    }
+
+    std::string get_parameters() const override {
+        return parameter_to_string<DT>(reset_value);
+    }
+
 protected:
     std::string get_class_name() const override {
         std::ostringstream oss;
-        oss << "integrator_block<" << datatype_to_string(DT) << '>';
+        oss << "delay_block_const<" << datatype_to_string(DT) << '>';
         return oss.str();
     }
 
 public:
     std::string get_block_name() const override {
-        return BLK_NAME_INTEG;
+        return BLK_NAME_DELAY_CONST;
+    }
+
+    std::unique_ptr<block_interface> clone() const override {
+        auto blk = std::make_unique<delay_block_const>(reset_value);
+        blk->s_in = s_in;
+        blk->s_out = s_out;
+        blk->next_value = next_value;
+        return blk;
     }
 #endif
 
     input_t s_in;
     output_t s_out;
 
-    const time_step_t time_step;
-};
+    data_t next_value;
 
-#ifdef MTEA_USE_FULL_LIB
-struct switch_block_types {
-    static constexpr bool uses_integral = true;
-    static constexpr bool uses_float = true;
-    static constexpr bool uses_logical = true;
+    const data_t reset_value;
 };
-#endif // MTEA_USE_FULL_LIB
 
 template <DataType DT>
-struct switch_block MT_COMPAT_SUBCLASS {
+struct delay_n_block_dynamic MT_COMPAT_SUBCLASS {
     using data_t = typename type_info<DT>::type_t;
 
     struct input_t {
-        bool value_flag;
-        data_t value_a;
-        data_t value_b;
+        data_t value;
+        data_t reset;
+        bool reset_flag;
     };
 
     struct output_t {
         data_t value;
     };
 
-    switch_block() = default;
-    switch_block(const switch_block&) = delete;
-    switch_block& operator=(const switch_block&) = delete;
+    delay_n_block_dynamic() : s_in{}, s_out{}, buffer{nullptr}, delay_num{0}, position{0} {}
 
-    void reset() noexcept MT_COMPAT_OVERRIDE { step(); }
+    delay_n_block_dynamic(const delay_n_block_dynamic&) = delete;
+    delay_n_block_dynamic& operator=(const delay_n_block_dynamic&) = delete;
 
-    void step() noexcept MT_COMPAT_OVERRIDE {
-        if (s_in.value_flag) {
-            s_out.value = s_in.value_a;
-        } else {
-            s_out.value = s_in.value_b;
+    void reset() noexcept MT_COMPAT_OVERRIDE {
+        for (size_t i = 0; i < delay_num; ++i) {
+            buffer[i] = s_in.reset;
         }
-    }
 
-#ifdef MTEA_USE_FULL_LIB
-protected:
-    std::string get_class_name() const override {
-        std::ostringstream oss;
-        oss << "switch_block<" << datatype_to_string(DT) << '>';
-        return oss.str();
+        position = 0;
+        s_out.value = s_in.reset;
     }
 
-    static const size_t PORT_VALUE_FLAG = 0;
-    static const size_t PORT_VALUE_A = 1;
-    static const size_t PORT_VALUE_B = 2;
+    void step() noexcept MT_COMPAT_OVERRIDE {
+        if (s_in.reset_flag) {
+            reset();
+        }
 
-public:
-    std::string get_block_name() const override {
-        return BLK_NAME_SWITCH;
+        s_out.value = buffer[position];
+        buffer[position] = s_in.value;
+        position = position + 1 == delay_num ? 0 : position + 1;
     }
 
-    using type_info_t = switch_block_types;
+    size_t get_delay_num() const noexcept {
+        return delay_num;
+    }
+
+#ifdef MTEA_USE_FULL_LIB
+    static const size_t PORT_VALUE_NUM = 0;
+    static const size_t PORT_RESET_NUM = 1;
+    static const size_t PORT_FLAG_NUM = 2;
+
+    using type_info_t = delay_block_types;
     block_types get_supported_types() const noexcept override {
         return block_types{
             .uses_integral = type_info_t::uses_integral,
@@ -1068,12 +1429,12 @@ public:
     }
 
     void set_input(size_t port_num, const Argument* value) override {
-        if (port_num == PORT_VALUE_FLAG) {
-            set_input_value<DataType::BOOL>(s_in.value_flag, value);
-        } else if (port_num == PORT_VALUE_A) {
-            set_input_value<DT>(s_in.value_a, value);
-        } else if (port_num == PORT_VALUE_B) {
-            set_input_value<DT>(s_in.value_b, value);
+        if (port_num == PORT_VALUE_NUM) {
+            set_input_value<DT>(s_in.value, value);
+        } else if (port_num == PORT_RESET_NUM) {
+            set_input_value<DT>(s_in.reset, value);
+        } else if (port_num == PORT_FLAG_NUM) {
+            set_input_value<DataType::BOOL>(s_in.reset_flag, value);
         } else {
             throw block_error("input port too high");
         }
@@ -1092,7 +1453,7 @@ public:
     }
 
     bool get_input_type_settable(size_t port_num) const noexcept override {
-        return port_num < get_input_num() && port_num != PORT_VALUE_FLAG;
+        return port_num < PORT_FLAG_NUM;
     }
 
     size_t get_output_num() const noexcept override {
@@ -1100,10 +1461,10 @@ public:
     }
 
     DataType get_input_type(size_t port_num) const override {
-        if (port_num == PORT_VALUE_FLAG) {
-            return DataType::BOOL;
-        } else if (port_num == PORT_VALUE_A || port_num == PORT_VALUE_B) {
+        if (port_num == PORT_VALUE_NUM || port_num == PORT_RESET_NUM) {
             return DT;
+        } else if (port_num == PORT_FLAG_NUM) {
+            return DataType::BOOL;
         } else {
             throw block_error("input port too high");
         }
@@ -1117,13 +1478,15 @@ public:
         }
     }
 
+    bool outputs_are_delayed() const noexcept override { return true; }
+
     std::string get_input_name(size_t port_num) const override {
-        if (port_num == PORT_VALUE_FLAG) {
-            return "value_flag";
-        } else if (port_num == PORT_VALUE_A) {
-            return "value_a";
-        } else if (port_num == PORT_VALUE_B) {
-            return "value_b";
+        if (port_num == PORT_VALUE_NUM) {
+            return "value";
+        } else if (port_num == PORT_RESET_NUM) {
+            return "reset";
+        } else if (port_num == PORT_FLAG_NUM) {
+            return "reset_flag";
         } else {
             throw block_error("input port too high");
         }
@@ -1136,60 +1499,185 @@ public:
             throw block_error("output port too high");
         }
     }
+
+    size_t get_state_size() const noexcept override {
+        return sizeof(s_out) + sizeof(position) + delay_num * sizeof(data_t);
+    }
+
+    void save_state(void* data) const noexcept override {
+        write_state_values(data, s_out, position);
+        std::memcpy(static_cast<unsigned char*>(data) + sizeof(s_out) + sizeof(position), buffer, delay_num * sizeof(data_t));
+    }
+
+    void load_state(const void* data) noexcept override {
+        read_state_values(data, s_out, position);
+        std::memcpy(buffer, static_cast<const unsigned char*>(data) + sizeof(s_out) + sizeof(position), delay_num * sizeof(data_t));
+    }
+
+    std::string get_parameters() const override {
+        return std::to_string(delay_num);
+    }
+
+protected:
+    std::string get_class_name() const override {
+        std::ostringstream oss;
+        oss << "delay_n_block_dynamic<" << datatype_to_string(DT) << '>';
+        return oss.str();
+    }
+
+    std::string get_class_name_codegen() const override {
+        std::ostringstream oss;
+        oss << "delay_n_block<" << datatype_to_string(DT) << ", " << delay_num << '>';
+        return oss.str();
+    }
+
+public:
+    std::string get_block_name() const override {
+        return BLK_NAME_DELAY_N;
+    }
 #endif
 
     input_t s_in;
     output_t s_out;
+
+protected:
+    void copy_from(const delay_n_block_dynamic& other) noexcept {
+        for (size_t i = 0; i < delay_num; ++i) {
+            buffer[i] = other.buffer[i];
+        }
+
+        s_in = other.s_in;
+        s_out = other.s_out;
+        position = other.position;
+    }
+
+    data_t* buffer;
+    size_t delay_num;
+    size_t position;
 };
 
-#ifdef MTEA_USE_FULL_LIB
-struct limiter_block_types {
-    static constexpr bool uses_integral = true;
+template <DataType DT, size_t DELAY>
+struct delay_n_block : public delay_n_block_dynamic<DT> {
+    using data_t = typename type_info<DT>::type_t;
+
+    delay_n_block() : _buffer_array{} {
+        static_assert(DELAY > 0, "delay must be at least one step");
+        this->buffer = _buffer_array.data();
+        this->delay_num = DELAY;
+    }
+
+    delay_n_block(const delay_n_block&) = delete;
+    delay_n_block& operator=(const delay_n_block&) = delete;
+
+#ifdef MTEA_USE_FULL_LIB
+protected:
+    std::string get_class_name() const override {
+        std::ostringstream oss;
+        oss << "delay_n_block<" << datatype_to_string(DT) << ", " << DELAY << '>';
+        return oss.str();
+    }
+
+public:
+    std::unique_ptr<block_interface> clone() const override {
+        auto blk = std::make_unique<delay_n_block>();
+        blk->copy_from(*this);
+        return blk;
+    }
+#endif
+
+private:
+    std::array<data_t, DELAY> _buffer_array;
+};
+
+#ifdef MTEA_USE_FULL_LIB
+struct transport_delay_block_types {
+    static constexpr bool uses_integral = false;
     static constexpr bool uses_float = true;
     static constexpr bool uses_logical = false;
 };
 #endif // MTEA_USE_FULL_LIB
 
 template <DataType DT>
-struct limiter_block MT_COMPAT_SUBCLASS {
+struct transport_delay_block_dynamic MT_COMPAT_SUBCLASS {
     using data_t = typename type_info<DT>::type_t;
 
     struct input_t {
         data_t value;
-        data_t limit_upper;
-        data_t limit_lower;
+        data_t delay;
     };
 
     struct output_t {
         data_t value;
     };
 
-    limiter_block() = default;
-    limiter_block(const limiter_block&) = delete;
-    limiter_block& operator=(const limiter_block&) = delete;
+    transport_delay_block_dynamic() : s_in{}, s_out{}, time_step{1.0}, buffer{nullptr}, times{nullptr}, capacity{0}, position{0}, elapsed{0} {
+        static_assert(type_info<DT>::is_float, "data type must be a float");
+    }
 
-    void reset() noexcept MT_COMPAT_OVERRIDE { step(); }
+    transport_delay_block_dynamic(const transport_delay_block_dynamic&) = delete;
+    transport_delay_block_dynamic& operator=(const transport_delay_block_dynamic&) = delete;
+
+    void reset() noexcept MT_COMPAT_OVERRIDE {
+        for (size_t i = 0; i < capacity; ++i) {
+            buffer[i] = 0;
+            times[i] = 0;
+        }
+
+        position = 0;
+        elapsed = 0;
+        s_out.value = 0;
+    }
 
     void step() noexcept MT_COMPAT_OVERRIDE {
-        data_t x = s_in.value;
+        position = position + 1 == capacity ? 0 : position + 1;
+        elapsed += time_step;
+        buffer[position] = s_in.value;
+        times[position] = elapsed;
+
+        // Each sample keeps the time it was taken at, such that the delay is found in time rather than in samples and
+        // remains correct when the time step varies between steps
+        const double target = s_in.delay > 0 ? elapsed - static_cast<double>(s_in.delay) : elapsed;
+
+        // Sample times decrease with age, allowing the newest sample at or before the target to be found by bisection.
+        // Targets beyond the oldest sample are clamped to the oldest sample.
+        size_t lower = 0;
+        size_t upper = capacity - 1;
+        while (lower < upper) {
+            const size_t mid = lower + (upper - lower) / 2;
+            if (times[sample_index(mid)] > target) {
+                lower = mid + 1;
+            } else {
+                upper = mid;
+            }
+        }
 
-        if (x < s_in.limit_lower) {
-            x = s_in.limit_lower;
-        } else if (x > s_in.limit_upper) {
-            x = s_in.limit_upper;
+        if (lower == 0 || times[sample_index(lower)] > target) {
+            s_out.value = buffer[sample_index(lower)];
+        } else {
+            const double ta = times[sample_index(lower)];
+            const double tb = times[sample_index(lower - 1)];
+            const data_t a = buffer[sample_index(lower)];
+            const data_t b = buffer[sample_index(lower - 1)];
+            s_out.value = a + (b - a) * static_cast<data_t>((target - ta) / (tb - ta));
         }
+    }
 
-        s_out.value = x;
+    size_t get_capacity() const noexcept {
+        return capacity;
     }
 
+    input_t s_in;
+    output_t s_out;
+
+    double time_step;
+
 #ifdef MTEA_USE_FULL_LIB
-protected:
-    static const size_t PORT_VALUE = 0;
-    static const size_t PORT_LIMIT_UPPER = 1;
-    static const size_t PORT_LIMIT_LOWER = 2;
+    static const size_t PORT_VALUE_NUM = 0;
+    static const size_t PORT_DELAY_NUM = 1;
 
-public:
-    using type_info_t = limiter_block_types;
+    void set_time_step(double dt) noexcept override { time_step = dt; }
+
+    using type_info_t = transport_delay_block_types;
     block_types get_supported_types() const noexcept override {
         return block_types{
             .uses_integral = type_info_t::uses_integral,
@@ -1203,12 +1691,10 @@ public:
     }
 
     void set_input(size_t port_num, const Argument* value) override {
-        if (port_num == PORT_VALUE) {
+        if (port_num == PORT_VALUE_NUM) {
             set_input_value<DT>(s_in.value, value);
-        } else if (port_num == PORT_LIMIT_LOWER) {
-            set_input_value<DT>(s_in.limit_lower, value);
-        } else if (port_num == PORT_LIMIT_UPPER) {
-            set_input_value<DT>(s_in.limit_upper, value);
+        } else if (port_num == PORT_DELAY_NUM) {
+            set_input_value<DT>(s_in.delay, value);
         } else {
             throw block_error("input port too high");
         }
@@ -1223,7 +1709,7 @@ public:
     }
 
     size_t get_input_num() const noexcept override {
-        return 3;
+        return 2;
     }
 
     bool get_input_type_settable(size_t port_num) const noexcept override {
@@ -1251,12 +1737,10 @@ public:
     }
 
     std::string get_input_name(size_t port_num) const override {
-        if (port_num == PORT_VALUE) {
+        if (port_num == PORT_VALUE_NUM) {
             return "value";
-        } else if (port_num == PORT_LIMIT_LOWER) {
-            return "limit_lower";
-        } else if (port_num == PORT_LIMIT_UPPER) {
-            return "limit_upper";
+        } else if (port_num == PORT_DELAY_NUM) {
+            return "delay";
         } else {
             throw block_error("input port too high");
         }
@@ -1270,59 +1754,157 @@ public:
         }
     }
 
+    size_t get_state_size() const noexcept override {
+        return sizeof(s_out) + sizeof(position) + sizeof(elapsed) + capacity * (sizeof(data_t) + sizeof(double));
+    }
+
+    void save_state(void* data) const noexcept override {
+        write_state_values(data, s_out, position, elapsed);
+        auto* values = static_cast<unsigned char*>(data) + sizeof(s_out) + sizeof(position) + sizeof(elapsed);
+        std::memcpy(values, buffer, capacity * sizeof(data_t));
+        std::memcpy(values + capacity * sizeof(data_t), times, capacity * sizeof(double));
+    }
+
+    void load_state(const void* data) noexcept override {
+        read_state_values(data, s_out, position, elapsed);
+        const auto* values = static_cast<const unsigned char*>(data) + sizeof(s_out) + sizeof(position) + sizeof(elapsed);
+        std::memcpy(buffer, values, capacity * sizeof(data_t));
+        std::memcpy(times, values + capacity * sizeof(data_t), capacity * sizeof(double));
+    }
+
+    std::string get_parameters() const override {
+        return std::to_string(capacity) + ", " + parameter_to_string<DataType::F64>(time_step);
+    }
+
 protected:
     std::string get_class_name() const override {
         std::ostringstream oss;
-        oss << "limiter_block<" << datatype_to_string(DT) << '>';
+        oss << "transport_delay_block_dynamic<" << datatype_to_string(DT) << '>';
+        return oss.str();
+    }
+
+    std::string get_class_name_codegen() const override {
+        std::ostringstream oss;
+        oss << "transport_delay_block<" << datatype_to_string(DT) << ", " << capacity << '>';
         return oss.str();
     }
 
 public:
     std::string get_block_name() const override {
-        return BLK_NAME_LIMITER;
+        return BLK_NAME_TRANSPORT_DELAY;
     }
 #endif
 
-    input_t s_in;
-    output_t s_out;
+protected:
+    size_t sample_index(const size_t age) const noexcept {
+        return position >= age ? position - age : position + capacity - age;
+    }
+
+    void copy_from(const transport_delay_block_dynamic& other) noexcept {
+        for (size_t i = 0; i < capacity; ++i) {
+            buffer[i] = other.buffer[i];
+            times[i] = other.times[i];
+        }
+
+        s_in = other.s_in;
+        s_out = other.s_out;
+        time_step = other.time_step;
+        position = other.position;
+        elapsed = other.elapsed;
+    }
+
+    data_t* buffer;
+    double* times;
+    size_t capacity;
+    size_t position;
+    double elapsed;
 };
 
+template <DataType DT, size_t CAPACITY>
+struct transport_delay_block : public transport_delay_block_dynamic<DT> {
+    using data_t = typename type_info<DT>::type_t;
+
+    // Holds the most recent CAPACITY inputs with their times, allowing delays up to the age of the oldest input
+    explicit transport_delay_block(const double dt = 1.0) : _buffer_array{}, _time_array{} {
+        static_assert(CAPACITY > 0, "delay buffer must not be empty");
+        this->time_step = dt;
+        this->buffer = _buffer_array.data();
+        this->times = _time_array.data();
+        this->capacity = CAPACITY;
+    }
+
+    transport_delay_block(const transport_delay_block&) = delete;
+    transport_delay_block& operator=(const transport_delay_block&) = delete;
+
+#ifdef MTEA_USE_FULL_LIB
+protected:
+    std::string get_class_name() const override {
+        std::ostringstream oss;
+        oss << "transport_delay_block<" << datatype_to_string(DT) << ", " << CAPACITY << '>';
+        return oss.str();
+    }
+
+public:
+    std::unique_ptr<block_interface> clone() const override {
+        auto blk = std::make_unique<transport_delay_block>();
+        blk->copy_from(*this);
+        return blk;
+    }
+#endif
+
+private:
+    std::array<data_t, CAPACITY> _buffer_array;
+    std::array<double, CAPACITY> _time_array;
+};
+
+#ifdef MTEA_USE_FULL_LIB
+struct derivative_block_types {
+    static constexpr bool uses_integral = false;
+    static constexpr bool uses_float = true;
+    static constexpr bool uses_logical = false;
+};
+#endif // MTEA_USE_FULL_LIB
+
 template <DataType DT>
-struct limiter_block_const MT_COMPAT_SUBCLASS {
+struct derivative_block MT_COMPAT_SUBCLASS {
     using data_t = typename type_info<DT>::type_t;
 
     struct input_t {
         data_t value;
+        bool reset_flag;
     };
 
     struct output_t {
         data_t value;
     };
 
-    limiter_block_const(const data_t upper, const data_t lower)
-        : bound_upper{upper}, bound_lower{lower} {}
+    explicit derivative_block(const time_step_t dt) : s_in{}, s_out{}, time_step(dt) {
+        static_assert(type_info<DT>::is_float, "derivative data type must be a floating point type");
+    }
 
-    limiter_block_const(const limiter_block_const&) = delete;
-    limiter_block_const& operator=(const limiter_block_const&) = delete;
+    derivative_block(const derivative_block&) = delete;
+    derivative_block& operator=(const derivative_block&) = delete;
 
-    void reset() noexcept MT_COMPAT_OVERRIDE { step(); }
+    void reset() noexcept MT_COMPAT_OVERRIDE {
+        last_value = {};
+        s_out.value = {};
+    }
 
     void step() noexcept MT_COMPAT_OVERRIDE {
-        data_t x = s_in.value;
-
-        if (x < bound_lower) {
-            x = bound_lower;
-        } else if (x > bound_upper) {
-            x = bound_upper;
+        if (s_in.reset_flag) {
+            reset();
         }
 
-        s_out.value = x;
+        s_out.value = (s_in.value - last_value) / time_step;
+        last_value = s_in.value;
     }
 
 #ifdef MTEA_USE_FULL_LIB
-    explicit limiter_block_const(const Argument* upper, const Argument* lower) : limiter_block_const(get_model_value<DT>(upper), get_model_value<DT>(lower)) {}
+    explicit derivative_block(const Argument* dt) : derivative_block(get_model_value<DT>(dt)) {}
 
-    using type_info_t = limiter_block_types;
+    void set_time_step(double dt) noexcept override { time_step = dt; }
+
+    using type_info_t = derivative_block_types;
     block_types get_supported_types() const noexcept override {
         return block_types{
             .uses_integral = type_info_t::uses_integral,
@@ -1338,6 +1920,8 @@ struct limiter_block_const MT_COMPAT_SUBCLASS {
     void set_input(size_t port_num, const Argument* value) override {
         if (port_num == 0) {
             set_input_value<DT>(s_in.value, value);
+        } else if (port_num == 1) {
+            set_input_value<DataType::BOOL>(s_in.reset_flag, value);
         } else {
             throw block_error("input port too high");
         }
@@ -1352,11 +1936,11 @@ struct limiter_block_const MT_COMPAT_SUBCLASS {
     }
 
     size_t get_input_num() const noexcept override {
-        return 1;
+        return 2;
     }
 
     bool get_input_type_settable(size_t port_num) const noexcept override {
-        return port_num < get_input_num();
+        return port_num == 0;
     }
 
     size_t get_output_num() const noexcept override {
@@ -1364,8 +1948,10 @@ struct limiter_block_const MT_COMPAT_SUBCLASS {
     }
 
     DataType get_input_type(size_t port_num) const override {
-        if (port_num < get_input_num()) {
+        if (port_num == 0) {
             return DT;
+        } else if (port_num == 1) {
+            return DataType::BOOL;
         } else {
             throw block_error("input port too high");
         }
@@ -1379,9 +1965,13 @@ struct limiter_block_const MT_COMPAT_SUBCLASS {
         }
     }
 
-    std::string get_input_name(size_t port_num) const override {
+    bool outputs_are_delayed() const noexcept override { return true; }
+
+std::string get_input_name(size_t port_num) const override {
         if (port_num == 0) {
             return "value";
+        } else if (port_num == 1) {
+            return "reset_flag";
         } else {
             throw block_error("input port too high");
         }
@@ -1395,151 +1985,5929 @@ struct limiter_block_const MT_COMPAT_SUBCLASS {
         }
     }
 
+    size_t get_state_size() const noexcept override {
+        return sizeof(s_out) + sizeof(last_value);
+    }
+
+    void save_state(void* data) const noexcept override {
+        write_state_values(data, s_out, last_value);
+    }
+
+    void load_state(const void* data) noexcept override {
+        read_state_values(data, s_out, last_value);
+    }
+
+    std::string get_parameters() const override {
+        return parameter_to_string<DataType::F64>(time_step);
+    }
+
 protected:
     std::string get_class_name() const override {
         std::ostringstream oss;
-        oss << "limiter_block_const<" << datatype_to_string(DT) << '>';
+        oss << "derivative_block<" << datatype_to_string(DT) << '>';
         return oss.str();
     }
 
 public:
     std::string get_block_name() const override {
-        return BLK_NAME_LIMITER;
+        return BLK_NAME_DERIV;
+    }
+
+    std::unique_ptr<block_interface> clone() const override {
+        auto blk = std::make_unique<derivative_block>(time_step);
+        blk->s_in = s_in;
+        blk->s_out = s_out;
+        blk->last_value = last_value;
+        return blk;
     }
 #endif
 
     input_t s_in;
     output_t s_out;
 
-    const data_t bound_upper;
-    const data_t bound_lower;
+    data_t last_value;
+    time_step_t time_step;
 };
 
-template <DataType DT, RelationalOperator OP>
-struct RelationalOperation {};
-
-template <DataType DT>
-struct RelationalOperation<DT, RelationalOperator::EQUAL> {
-    using data_t = typename type_info<DT>::type_t;
-    static bool operation(const data_t a, const data_t b) {
-        return a == b;
-    }
+#ifdef MTEA_USE_FULL_LIB
+struct integrator_block_types {
+    static constexpr bool uses_integral = false;
+    static constexpr bool uses_float = true;
+    static constexpr bool uses_logical = false;
 };
+#endif // MTEA_USE_FULL_LIB
 
 template <DataType DT>
-struct RelationalOperation<DT, RelationalOperator::NOT_EQUAL> {
+struct integrator_block MT_COMPAT_SUBCLASS {
     using data_t = typename type_info<DT>::type_t;
-    static bool operation(const data_t a, const data_t b) {
-        return a != b;
-    }
-};
 
-template <DataType DT>
-struct RelationalOperation<DT, RelationalOperator::GREATER_THAN> {
-    using data_t = typename type_info<DT>::type_t;
-    static bool operation(const data_t a, const data_t b) {
-        return a > b;
-    }
-};
+    struct input_t {
+        data_t value;
+        data_t reset;
+        bool reset_flag;
+    };
 
-template <DataType DT>
-struct RelationalOperation<DT, RelationalOperator::GREATER_THAN_EQUAL> {
-    using data_t = typename type_info<DT>::type_t;
-    static bool operation(const data_t a, const data_t b) {
-        return a >= b;
-    }
-};
+    struct output_t {
+        data_t value;
+    };
 
-template <DataType DT>
-struct RelationalOperation<DT, RelationalOperator::LESS_THAN> {
-    using data_t = typename type_info<DT>::type_t;
-    static bool operation(const data_t a, const data_t b) {
-        return a < b;
+    explicit integrator_block(const time_step_t dt) : time_step(dt) {
+        static_assert(type_info<DT>::is_float, "integrator data type must be a floating point type");
     }
-};
 
-template <DataType DT>
-struct RelationalOperation<DT, RelationalOperator::LESS_THAN_EQUAL> {
-    using data_t = typename type_info<DT>::type_t;
-    static bool operation(const data_t a, const data_t b) {
-        return a <= b;
-    }
-};
+    integrator_block(const integrator_block&) = delete;
+    integrator_block& operator=(const integrator_block&) = delete;
 
-#ifdef MTEA_USE_FULL_LIB
-template <RelationalOperator OP>
-struct relational_block_types {
-    static constexpr bool uses_integral = true;
-    static constexpr bool uses_float = true;
-    static constexpr bool uses_logical = false;
-};
+    void reset() noexcept MT_COMPAT_OVERRIDE { s_out.value = s_in.reset; }
+
+    void step() noexcept MT_COMPAT_OVERRIDE {
+        if (s_in.reset_flag) {
+            reset();
+        } else {
+            s_out.value += s_in.value * time_step;
+        }
+    }
+
+#ifdef MTEA_USE_FULL_LIB
+    explicit integrator_block(const Argument* dt) : integrator_block(get_model_value<DT>(dt)) {}
+
+    void set_time_step(double dt) noexcept override { time_step = dt; }
+
+    static const size_t PORT_VALUE_NUM = 0;
+    static const size_t PORT_RESET_NUM = 1;
+    static const size_t PORT_FLAG_NUM = 2;
+
+    using type_info_t = integrator_block_types;
+    block_types get_supported_types() const noexcept override {
+        return block_types{
+            .uses_integral = type_info_t::uses_integral,
+            .uses_float = type_info_t::uses_float,
+            .uses_logical = type_info_t::uses_logical,
+        };
+    }
+
+    DataType get_current_type() const noexcept override {
+        return DT;
+    }
+
+    void set_input(size_t port_num, const Argument* value) override {
+        if (port_num == PORT_VALUE_NUM) {
+            set_input_value<DT>(s_in.value, value);
+        } else if (port_num == PORT_RESET_NUM) {
+            set_input_value<DT>(s_in.reset, value);
+        } else if (port_num == PORT_FLAG_NUM) {
+            set_input_value<DataType::BOOL>(s_in.reset_flag, value);
+        } else {
+            throw block_error("input port too high");
+        }
+    }
+
+    void get_output(size_t port_num, Argument* value) const override {
+        if (port_num == 0) {
+            get_output_value<DT>(s_out.value, value);
+        } else {
+            throw block_error("output port too high");
+        }
+    }
+
+    size_t get_input_num() const noexcept override {
+        return 3;
+    }
+
+    bool get_input_type_settable(size_t port_num) const noexcept override {
+        return port_num < PORT_FLAG_NUM;
+    }
+
+    size_t get_output_num() const noexcept override {
+        return 1;
+    }
+
+    DataType get_input_type(size_t port_num) const override {
+        if (port_num == 0 || port_num == 1) {
+            return DT;
+        } else if (port_num == 2) {
+            return DataType::BOOL;
+        } else {
+            throw block_error("input port too high");
+        }
+    }
+
+    DataType get_output_type(size_t port_num) const override {
+        if (port_num == 0) {
+            return DT;
+        } else {
+            throw block_error("output port too high");
+        }
+    }
+
+    bool outputs_are_delayed() const noexcept override { return true; }
+
+    std::string get_input_name(size_t port_num) const override {
+        if (port_num == PORT_VALUE_NUM) {
+            return "value";
+        } else if (port_num == PORT_RESET_NUM) {
+            return "reset";
+        } else if (port_num == PORT_FLAG_NUM) {
+            return "reset_flag";
+        } else {
+            throw block_error("input port too high");
+        }
+    }
+
+    std::string get_output_name(size_t port_num) const override {
+        if (port_num == 0) {
+            return "value";
+        } else {
+            throw block_error("output port too high");
+        }
+    }
+
+    size_t get_state_size() const noexcept override {
+        return sizeof(s_out);
+    }
+
+    void save_state(void* data) const noexcept override {
+        write_state_values(data, s_out);
+    }
+
+    void load_state(const void* data) noexcept override {
+        read_state_values(data, s_out);
+    }
+
+    std::string get_parameters() const override {
+        return parameter_to_string<DataType::F64>(time_step);
+    }
+
+protected:
+    std::string get_class_name() const override {
+        std::ostringstream oss;
+        oss << "integrator_block<" << datatype_to_string(DT) << '>';
+        return oss.str();
+    }
+
+public:
+    std::string get_block_name() const override {
+        return BLK_NAME_INTEG;
+    }
+
+    std::unique_ptr<block_interface> clone() const override {
+        auto blk = std::make_unique<integrator_block>(time_step);
+        blk->s_in = s_in;
+        blk->s_out = s_out;
+        return blk;
+    }
+#endif
+
+    input_t s_in;
+    output_t s_out;
+
+    time_step_t time_step;
+};
+
+template <DataType DT>
+struct integrator_block_const MT_COMPAT_SUBCLASS {
+    using data_t = typename type_info<DT>::type_t;
+
+    struct input_t {
+        data_t value;
+        bool reset_flag;
+    };
+
+    struct output_t {
+        data_t value;
+    };
+
+    integrator_block_const(const data_t reset, const time_step_t dt) : time_step(dt), reset_value{reset} {
+        static_assert(type_info<DT>::is_float, "integrator data type must be a floating point type");
+    }
+
+    integrator_block_const(const integrator_block_const&) = delete;
+    integrator_block_const& operator=(const integrator_block_const&) = delete;
+
+    void reset() noexcept MT_COMPAT_OVERRIDE { s_out.value = reset_value; }
+
+    void step() noexcept MT_COMPAT_OVERRIDE {
+        if (s_in.reset_flag) {
+            reset();
+        } else {
+            s_out.value += s_in.value * time_step;
+        }
+    }
+
+#ifdef MTEA_USE_FULL_LIB
+    explicit integrator_block_const(const Argument* reset, const Argument* dt) : integrator_block_const(get_model_value<DT>(reset), get_model_value<DT>(dt)) {}
+
+    void set_time_step(double dt) noexcept override { time_step = dt; }
+
+    static const size_t PORT_VALUE_NUM = 0;
+    static const size_t PORT_FLAG_NUM = 1;
+
+    using type_info_t = integrator_block_types;
+    block_types get_supported_types() const noexcept override {
+        return block_types{
+            .uses_integral = type_info_t::uses_integral,
+            .uses_float = type_info_t::uses_float,
+            .uses_logical = type_info_t::uses_logical,
+        };
+    }
+
+    DataType get_current_type() const noexcept override {
+        return DT;
+    }
+
+    void set_input(size_t port_num, const Argument* value) override {
+        if (port_num == PORT_VALUE_NUM) {
+            set_input_value<DT>(s_in.value, value);
+        } else if (port_num == PORT_FLAG_NUM) {
+            set_input_value<DataType::BOOL>(s_in.reset_flag, value);
+        } else {
+            throw block_error("input port too high");
+        }
+    }
+
+    void get_output(size_t port_num, Argument* value) const override {
+        if (port_num == 0) {
+            get_output_value<DT>(s_out.value, value);
+        } else {
+            throw block_error("output port too high");
+        }
+    }
+
+    size_t get_input_num() const noexcept override {
+        return 2;
+    }
+
+    bool get_input_type_settable(size_t port_num) const noexcept override {
+        return port_num == PORT_VALUE_NUM;
+    }
+
+    size_t get_output_num() const noexcept override {
+        return 1;
+    }
+
+    DataType get_input_type(size_t port_num) const override {
+        if (port_num == PORT_VALUE_NUM) {
+            return DT;
+        } else if (port_num == PORT_FLAG_NUM) {
+            return DataType::BOOL;
+        } else {
+            throw block_error("input port too high");
+        }
+    }
+
+    DataType get_output_type(size_t port_num) const override {
+        if (port_num == 0) {
+            return DT;
+        } else {
+            throw block_error("output port too high");
+        }
+    }
+
+    bool outputs_are_delayed() const noexcept override { return true; }
+
+    std::string get_input_name(size_t port_num) const override {
+        if (port_num == PORT_VALUE_NUM) {
+            return "value";
+        } else if (port_num == PORT_FLAG_NUM) {
+            return "reset_flag";
+        } else {
+            throw block_error("input port too high");
+        }
+    }
+
+    std::string get_output_name(size_t port_num) const override {
+        if (port_num == 0) {
+            return "value";
+        } else {
+            throw block_error("output port too high");
+        }
+    }
+
+    size_t get_state_size() const noexcept override {
+        return sizeof(s_out);
+    }
+
+    void save_state(void* data) const noexcept override {
+        write_state_values(data, s_out);
+    }
+
+    void load_state(const void* data) noexcept override {
+        read_state_values(data, s_out);
+    }
+
+    std::string get_parameters() const override {
+        return parameter_to_string<DT>(reset_value) + ", " + parameter_to_string<DataType::F64>(time_step);
+    }
+
+protected:
+    std::string get_class_name() const override {
+        std::ostringstream oss;
+        oss << "integrator_block_const<" << datatype_to_string(DT) << '>';
+        return oss.str();
+    }
+
+public:
+    std::string get_block_name() const override {
+        return BLK_NAME_INTEG_CONST;
+    }
+
+    std::unique_ptr<block_interface> clone() const override {
+        auto blk = std::make_unique<integrator_block_const>(reset_value, time_step);
+        blk->s_in = s_in;
+        blk->s_out = s_out;
+        return blk;
+    }
+#endif
+
+    input_t s_in;
+    output_t s_out;
+
+    time_step_t time_step;
+
+    const data_t reset_value;
+};
+
+#ifdef MTEA_USE_FULL_LIB
+struct switch_block_types {
+    static constexpr bool uses_integral = true;
+    static constexpr bool uses_float = true;
+    static constexpr bool uses_logical = true;
+};
+#endif // MTEA_USE_FULL_LIB
+
+template <DataType DT>
+struct switch_block MT_COMPAT_SUBCLASS {
+    using data_t = typename type_info<DT>::type_t;
+
+    struct input_t {
+        bool value_flag;
+        data_t value_a;
+        data_t value_b;
+    };
+
+    struct output_t {
+        data_t value;
+    };
+
+    switch_block() = default;
+    switch_block(const switch_block&) = delete;
+    switch_block& operator=(const switch_block&) = delete;
+
+    void reset() noexcept MT_COMPAT_OVERRIDE { step(); }
+
+    void step() noexcept MT_COMPAT_OVERRIDE {
+        if (s_in.value_flag) {
+            s_out.value = s_in.value_a;
+        } else {
+            s_out.value = s_in.value_b;
+        }
+    }
+
+#ifdef MTEA_USE_FULL_LIB
+protected:
+    std::string get_class_name() const override {
+        std::ostringstream oss;
+        oss << "switch_block<" << datatype_to_string(DT) << '>';
+        return oss.str();
+    }
+
+    static const size_t PORT_VALUE_FLAG = 0;
+    static const size_t PORT_VALUE_A = 1;
+    static const size_t PORT_VALUE_B = 2;
+
+public:
+    std::string get_block_name() const override {
+        return BLK_NAME_SWITCH;
+    }
+
+    using type_info_t = switch_block_types;
+    block_types get_supported_types() const noexcept override {
+        return block_types{
+            .uses_integral = type_info_t::uses_integral,
+            .uses_float = type_info_t::uses_float,
+            .uses_logical = type_info_t::uses_logical,
+        };
+    }
+
+    DataType get_current_type() const noexcept override {
+        return DT;
+    }
+
+    void set_input(size_t port_num, const Argument* value) override {
+        if (port_num == PORT_VALUE_FLAG) {
+            set_input_value<DataType::BOOL>(s_in.value_flag, value);
+        } else if (port_num == PORT_VALUE_A) {
+            set_input_value<DT>(s_in.value_a, value);
+        } else if (port_num == PORT_VALUE_B) {
+            set_input_value<DT>(s_in.value_b, value);
+        } else {
+            throw block_error("input port too high");
+        }
+    }
+
+    void get_output(size_t port_num, Argument* value) const override {
+        if (port_num == 0) {
+            get_output_value<DT>(s_out.value, value);
+        } else {
+            throw block_error("output port too high");
+        }
+    }
+
+    size_t get_input_num() const noexcept override {
+        return 3;
+    }
+
+    bool get_input_type_settable(size_t port_num) const noexcept override {
+        return port_num < get_input_num() && port_num != PORT_VALUE_FLAG;
+    }
+
+    size_t get_output_num() const noexcept override {
+        return 1;
+    }
+
+    bool is_stateless() const noexcept override { return true; }
+
+    size_t get_state_size() const noexcept override {
+        return sizeof(s_out);
+    }
+
+    void save_state(void* data) const noexcept override {
+        write_state_values(data, s_out);
+    }
+
+    void load_state(const void* data) noexcept override {
+        read_state_values(data, s_out);
+    }
+
+    DataType get_input_type(size_t port_num) const override {
+        if (port_num == PORT_VALUE_FLAG) {
+            return DataType::BOOL;
+        } else if (port_num == PORT_VALUE_A || port_num == PORT_VALUE_B) {
+            return DT;
+        } else {
+            throw block_error("input port too high");
+        }
+    }
+
+    DataType get_output_type(size_t port_num) const override {
+        if (port_num == 0) {
+            return DT;
+        } else {
+            throw block_error("output port too high");
+        }
+    }
+
+    std::string get_input_name(size_t port_num) const override {
+        if (port_num == PORT_VALUE_FLAG) {
+            return "value_flag";
+        } else if (port_num == PORT_VALUE_A) {
+            return "value_a";
+        } else if (port_num == PORT_VALUE_B) {
+            return "value_b";
+        } else {
+            throw block_error("input port too high");
+        }
+    }
+
+    std::string get_output_name(size_t port_num) const override {
+        if (port_num == 0) {
+            return "value";
+        } else {
+            throw block_error("output port too high");
+        }
+    }
+
+    std::unique_ptr<block_interface> clone() const override {
+        auto blk = std::make_unique<switch_block>();
+        blk->s_in = s_in;
+        blk->s_out = s_out;
+        return blk;
+    }
+#endif
+
+    input_t s_in;
+    output_t s_out;
+};
+
+#ifdef MTEA_USE_FULL_LIB
+struct limiter_block_types {
+    static constexpr bool uses_integral = true;
+    static constexpr bool uses_float = true;
+    static constexpr bool uses_logical = false;
+};
+#endif // MTEA_USE_FULL_LIB
+
+template <DataType DT>
+struct limiter_block MT_COMPAT_SUBCLASS {
+    using data_t = typename type_info<DT>::type_t;
+
+    struct input_t {
+        data_t value;
+        data_t limit_upper;
+        data_t limit_lower;
+    };
+
+    struct output_t {
+        data_t value;
+    };
+
+    limiter_block() = default;
+    limiter_block(const limiter_block&) = delete;
+    limiter_block& operator=(const limiter_block&) = delete;
+
+    void reset() noexcept MT_COMPAT_OVERRIDE { step(); }
+
+    void step() noexcept MT_COMPAT_OVERRIDE {
+        data_t x = s_in.value;
+
+        if (x < s_in.limit_lower) {
+            x = s_in.limit_lower;
+        } else if (x > s_in.limit_upper) {
+            x = s_in.limit_upper;
+        }
+
+        s_out.value = x;
+    }
+
+#ifdef MTEA_USE_FULL_LIB
+protected:
+    static const size_t PORT_VALUE = 0;
+    static const size_t PORT_LIMIT_UPPER = 1;
+    static const size_t PORT_LIMIT_LOWER = 2;
+
+public:
+    using type_info_t = limiter_block_types;
+    block_types get_supported_types() const noexcept override {
+        return block_types{
+            .uses_integral = type_info_t::uses_integral,
+            .uses_float = type_info_t::uses_float,
+            .uses_logical = type_info_t::uses_logical,
+        };
+    }
+
+    DataType get_current_type() const noexcept override {
+        return DT;
+    }
+
+    void set_input(size_t port_num, const Argument* value) override {
+        if (port_num == PORT_VALUE) {
+            set_input_value<DT>(s_in.value, value);
+        } else if (port_num == PORT_LIMIT_LOWER) {
+            set_input_value<DT>(s_in.limit_lower, value);
+        } else if (port_num == PORT_LIMIT_UPPER) {
+            set_input_value<DT>(s_in.limit_upper, value);
+        } else {
+            throw block_error("input port too high");
+        }
+    }
+
+    void get_output(size_t port_num, Argument* value) const override {
+        if (port_num == 0) {
+            get_output_value<DT>(s_out.value, value);
+        } else {
+            throw block_error("output port too high");
+        }
+    }
+
+    size_t get_input_num() const noexcept override {
+        return 3;
+    }
+
+    bool get_input_type_settable(size_t port_num) const noexcept override {
+        return port_num < get_input_num();
+    }
+
+    size_t get_output_num() const noexcept override {
+        return 1;
+    }
+
+    bool is_stateless() const noexcept override { return true; }
+
+    size_t get_state_size() const noexcept override {
+        return sizeof(s_out);
+    }
+
+    void save_state(void* data) const noexcept override {
+        write_state_values(data, s_out);
+    }
+
+    void load_state(const void* data) noexcept override {
+        read_state_values(data, s_out);
+    }
+
+    DataType get_input_type(size_t port_num) const override {
+        if (port_num < get_input_num()) {
+            return DT;
+        } else {
+            throw block_error("input port too high");
+        }
+    }
+
+    DataType get_output_type(size_t port_num) const override {
+        if (port_num == 0) {
+            return DT;
+        } else {
+            throw block_error("output port too high");
+        }
+    }
+
+    size_t get_zero_crossing_num() const noexcept override {
+        return 2;
+    }
+
+    double get_zero_crossing(size_t index) const override {
+        if (index == 0) {
+            return static_cast<double>(s_in.value) - static_cast<double>(s_in.limit_lower);
+        } else if (index == 1) {
+            return static_cast<double>(s_in.value) - static_cast<double>(s_in.limit_upper);
+        } else {
+            throw block_error("zero crossing index too high");
+        }
+    }
+
+    std::string get_input_name(size_t port_num) const override {
+        if (port_num == PORT_VALUE) {
+            return "value";
+        } else if (port_num == PORT_LIMIT_LOWER) {
+            return "limit_lower";
+        } else if (port_num == PORT_LIMIT_UPPER) {
+            return "limit_upper";
+        } else {
+            throw block_error("input port too high");
+        }
+    }
+
+    std::string get_output_name(size_t port_num) const override {
+        if (port_num == 0) {
+            return "value";
+        } else {
+            throw block_error("output port too high");
+        }
+    }
+
+protected:
+    std::string get_class_name() const override {
+        std::ostringstream oss;
+        oss << "limiter_block<" << datatype_to_string(DT) << '>';
+        return oss.str();
+    }
+
+public:
+    std::string get_block_name() const override {
+        return BLK_NAME_LIMITER;
+    }
+
+    std::unique_ptr<block_interface> clone() const override {
+        auto blk = std::make_unique<limiter_block>();
+        blk->s_in = s_in;
+        blk->s_out = s_out;
+        return blk;
+    }
+#endif
+
+    input_t s_in;
+    output_t s_out;
+};
+
+template <DataType DT>
+struct limiter_block_const MT_COMPAT_SUBCLASS {
+    using data_t = typename type_info<DT>::type_t;
+
+    struct input_t {
+        data_t value;
+    };
+
+    struct output_t {
+        data_t value;
+    };
+
+    limiter_block_const(const data_t upper, const data_t lower)
+        : bound_upper{upper}, bound_lower{lower} {}
+
+    limiter_block_const(const limiter_block_const&) = delete;
+    limiter_block_const& operator=(const limiter_block_const&) = delete;
+
+    void reset() noexcept MT_COMPAT_OVERRIDE { step(); }
+
+    void step() noexcept MT_COMPAT_OVERRIDE {
+        data_t x = s_in.value;
+
+        if (x < bound_lower) {
+            x = bound_lower;
+        } else if (x > bound_upper) {
+            x = bound_upper;
+        }
+
+        s_out.value = x;
+    }
+
+#ifdef MTEA_USE_FULL_LIB
+    explicit limiter_block_const(const Argument* upper, const Argument* lower) : limiter_block_const(get_model_value<DT>(upper), get_model_value<DT>(lower)) {}
+
+    using type_info_t = limiter_block_types;
+    block_types get_supported_types() const noexcept override {
+        return block_types{
+            .uses_integral = type_info_t::uses_integral,
+            .uses_float = type_info_t::uses_float,
+            .uses_logical = type_info_t::uses_logical,
+        };
+    }
+
+    DataType get_current_type() const noexcept override {
+        return DT;
+    }
+
+    void set_input(size_t port_num, const Argument* value) override {
+        if (port_num == 0) {
+            set_input_value<DT>(s_in.value, value);
+        } else {
+            throw block_error("input port too high");
+        }
+    }
+
+    void get_output(size_t port_num, Argument* value) const override {
+        if (port_num == 0) {
+            get_output_value<DT>(s_out.value, value);
+        } else {
+            throw block_error("output port too high");
+        }
+    }
+
+    size_t get_input_num() const noexcept override {
+        return 1;
+    }
+
+    bool get_input_type_settable(size_t port_num) const noexcept override {
+        return port_num < get_input_num();
+    }
+
+    size_t get_output_num() const noexcept override {
+        return 1;
+    }
+
+    bool is_stateless() const noexcept override { return true; }
+
+    size_t get_state_size() const noexcept override {
+        return sizeof(s_out);
+    }
+
+    void save_state(void* data) const noexcept override {
+        write_state_values(data, s_out);
+    }
+
+    void load_state(const void* data) noexcept override {
+        read_state_values(data, s_out);
+    }
+
+    DataType get_input_type(size_t port_num) const override {
+        if (port_num < get_input_num()) {
+            return DT;
+        } else {
+            throw block_error("input port too high");
+        }
+    }
+
+    DataType get_output_type(size_t port_num) const override {
+        if (port_num == 0) {
+            return DT;
+        } else {
+            throw block_error("output port too high");
+        }
+    }
+
+    size_t get_zero_crossing_num() const noexcept override {
+        return 2;
+    }
+
+    double get_zero_crossing(size_t index) const override {
+        if (index == 0) {
+            return static_cast<double>(s_in.value) - static_cast<double>(bound_lower);
+        } else if (index == 1) {
+            return static_cast<double>(s_in.value) - static_cast<double>(bound_upper);
+        } else {
+            throw block_error("zero crossing index too high");
+        }
+    }
+
+    std::string get_input_name(size_t port_num) const override {
+        if (port_num == 0) {
+            return "value";
+        } else {
+            throw block_error("input port too high");
+        }
+    }
+
+    std::string get_output_name(size_t port_num) const override {
+        if (port_num == 0) {
+            return "value";
+        } else {
+            throw block_error("output port too high");
+        }
+    }
+
+    std::string get_parameters() const override {
+        return parameter_to_string<DT>(bound_upper) + ", " + parameter_to_string<DT>(bound_lower);
+    }
+
+protected:
+    std::string get_class_name() const override {
+        std::ostringstream oss;
+        oss << "limiter_block_const<" << datatype_to_string(DT) << '>';
+        return oss.str();
+    }
+
+public:
+    std::string get_block_name() const override {
+        return BLK_NAME_LIMITER_CONST;
+    }
+
+    std::unique_ptr<block_interface> clone() const override {
+        auto blk = std::make_unique<limiter_block_const>(bound_upper, bound_lower);
+        blk->s_in = s_in;
+        blk->s_out = s_out;
+        return blk;
+    }
+#endif
+
+    input_t s_in;
+    output_t s_out;
+
+    const data_t bound_upper;
+    const data_t bound_lower;
+};
+
+template <DataType DT, RelationalOperator OP>
+struct RelationalOperation {};
+
+template <DataType DT>
+struct RelationalOperation<DT, RelationalOperator::EQUAL> {
+    using data_t = typename type_info<DT>::type_t;
+    static bool operation(const data_t a, const data_t b) {
+        return a == b;
+    }
+};
+
+template <DataType DT>
+struct RelationalOperation<DT, RelationalOperator::NOT_EQUAL> {
+    using data_t = typename type_info<DT>::type_t;
+    static bool operation(const data_t a, const data_t b) {
+        return a != b;
+    }
+};
+
+template <DataType DT>
+struct RelationalOperation<DT, RelationalOperator::GREATER_THAN> {
+    using data_t = typename type_info<DT>::type_t;
+    static bool operation(const data_t a, const data_t b) {
+        return a > b;
+    }
+};
+
+template <DataType DT>
+struct RelationalOperation<DT, RelationalOperator::GREATER_THAN_EQUAL> {
+    using data_t = typename type_info<DT>::type_t;
+    static bool operation(const data_t a, const data_t b) {
+        return a >= b;
+    }
+};
+
+template <DataType DT>
+struct RelationalOperation<DT, RelationalOperator::LESS_THAN> {
+    using data_t = typename type_info<DT>::type_t;
+    static bool operation(const data_t a, const data_t b) {
+        return a < b;
+    }
+};
+
+template <DataType DT>
+struct RelationalOperation<DT, RelationalOperator::LESS_THAN_EQUAL> {
+    using data_t = typename type_info<DT>::type_t;
+    static bool operation(const data_t a, const data_t b) {
+        return a <= b;
+    }
+};
+
+#ifdef MTEA_USE_FULL_LIB
+template <RelationalOperator OP>
+struct relational_block_types {
+    static constexpr bool uses_integral = true;
+    static constexpr bool uses_float = true;
+    static constexpr bool uses_logical = false;
+};
+
+template <>
+struct relational_block_types<RelationalOperator::EQUAL> {
+    static constexpr bool uses_integral = true;
+    static constexpr bool uses_float = true;
+    static constexpr bool uses_logical = true;
+};
+
+template <>
+struct relational_block_types<RelationalOperator::NOT_EQUAL> {
+    static constexpr bool uses_integral = true;
+    static constexpr bool uses_float = true;
+    static constexpr bool uses_logical = true;
+};
+#endif // MTEA_USE_FULL_LIB
+
+template <DataType DT, RelationalOperator OP>
+struct relational_block MT_COMPAT_SUBCLASS {
+    using data_t = typename type_info<DT>::type_t;
+
+    struct input_t {
+        data_t value_a;
+        data_t value_b;
+    };
+
+    struct output_t {
+        bool value;
+    };
+
+    relational_block() = default;
+    relational_block(const relational_block&) = delete;
+    relational_block& operator=(const relational_block&) = delete;
+
+    void reset() noexcept MT_COMPAT_OVERRIDE { step(); }
+
+    void step() noexcept MT_COMPAT_OVERRIDE {
+        s_out.value = RelationalOperation<DT, OP>::operation(s_in.value_a, s_in.value_b);
+    }
+
+#ifdef MTEA_USE_FULL_LIB
+protected:
+    std::string get_class_name() const override {
+        std::ostringstream oss;
+        oss << "relational_block<" << datatype_to_string(DT) << ", " << relational_to_string(OP) << '>';
+        return oss.str();
+    }
+
+public:
+    std::string get_block_name() const override {
+        if constexpr (OP == RelationalOperator::EQUAL) {
+            return BLK_NAME_REL_EQ;
+        } else if constexpr (OP == RelationalOperator::NOT_EQUAL) {
+            return BLK_NAME_REL_NEQ;
+        } else if constexpr (OP == RelationalOperator::GREATER_THAN) {
+            return BLK_NAME_REL_GT;
+        } else if constexpr (OP == RelationalOperator::GREATER_THAN_EQUAL) {
+            return BLK_NAME_REL_GEQ;
+        } else if constexpr (OP == RelationalOperator::LESS_THAN) {
+            return BLK_NAME_REL_LT;
+        } else if constexpr (OP == RelationalOperator::LESS_THAN_EQUAL) {
+            return BLK_NAME_REL_LEQ;
+        } else {
+            static_assert("unknown relational operation provided");
+        }
+    }
+
+    using type_info_t = relational_block_types<OP>;
+    block_types get_supported_types() const noexcept override {
+        return block_types{
+            .uses_integral = type_info_t::uses_integral,
+            .uses_float = type_info_t::uses_float,
+            .uses_logical = type_info_t::uses_logical,
+        };
+    }
+
+    DataType get_current_type() const noexcept override {
+        return DT;
+    }
+
+    void set_input(size_t port_num, const Argument* value) override {
+        if (port_num == 0) {
+            set_input_value<DT>(s_in.value_a, value);
+        } else if (port_num == 1) {
+            set_input_value<DT>(s_in.value_b, value);
+        } else {
+            throw block_error("input port too high");
+        }
+    }
+
+    void get_output(size_t port_num, Argument* value) const override {
+        if (port_num == 0) {
+            get_output_value<DataType::BOOL>(s_out.value, value);
+        } else {
+            throw block_error("output port too high");
+        }
+    }
+
+    size_t get_input_num() const noexcept override {
+        return 2;
+    }
+
+    bool get_input_type_settable(size_t port_num) const noexcept override {
+        return port_num < get_input_num();
+    }
+
+    size_t get_output_num() const noexcept override {
+        return 1;
+    }
+
+    bool is_stateless() const noexcept override { return true; }
+
+    size_t get_state_size() const noexcept override {
+        return sizeof(s_out);
+    }
+
+    void save_state(void* data) const noexcept override {
+        write_state_values(data, s_out);
+    }
+
+    void load_state(const void* data) noexcept override {
+        read_state_values(data, s_out);
+    }
+
+    DataType get_input_type(size_t port_num) const override {
+        if (port_num < get_input_num()) {
+            return DT;
+        } else {
+            throw block_error("input port too high");
+        }
+    }
+
+    DataType get_output_type(size_t port_num) const override {
+        if (port_num == 0) {
+            return DataType::BOOL;
+        } else {
+            throw block_error("output port too high");
+        }
+    }
+
+    size_t get_zero_crossing_num() const noexcept override {
+        return 1;
+    }
+
+    double get_zero_crossing(size_t index) const override {
+        if (index == 0) {
+            return static_cast<double>(s_in.value_a) - static_cast<double>(s_in.value_b);
+        } else {
+            throw block_error("zero crossing index too high");
+        }
+    }
+
+    std::string get_input_name(size_t port_num) const override {
+        if (port_num == 0) {
+            return "value_a";
+        } else if (port_num == 1) {
+            return "value_b";
+        } else {
+            throw block_error("input port too high");
+        }
+    }
+
+    std::string get_output_name(size_t port_num) const override {
+        if (port_num == 0) {
+            return "value";
+        } else {
+            throw block_error("output port too high");
+        }
+    }
+
+    std::unique_ptr<block_interface> clone() const override {
+        auto blk = std::make_unique<relational_block>();
+        blk->s_in = s_in;
+        blk->s_out = s_out;
+        return blk;
+    }
+#endif
+
+    input_t s_in;
+    output_t s_out;
+};
+
+template <DataType DT, RelationalOperator OP>
+struct relational_block_const MT_COMPAT_SUBCLASS {
+    using data_t = typename type_info<DT>::type_t;
+
+    struct input_t {
+        data_t value;
+    };
+
+    struct output_t {
+        bool value;
+    };
+
+    explicit relational_block_const(const data_t val) : threshold{val} {}
+
+    relational_block_const(const relational_block_const&) = delete;
+    relational_block_const& operator=(const relational_block_const&) = delete;
+
+    void reset() noexcept MT_COMPAT_OVERRIDE { step(); }
+
+    void step() noexcept MT_COMPAT_OVERRIDE {
+        s_out.value = RelationalOperation<DT, OP>::operation(s_in.value, threshold);
+    }
+
+#ifdef MTEA_USE_FULL_LIB
+    explicit relational_block_const(const Argument* value) : relational_block_const(get_model_value<DT>(value)) {}
+
+    std::string get_parameters() const override {
+        return parameter_to_string<DT>(threshold);
+    }
+
+protected:
+    std::string get_class_name() const override {
+        std::ostringstream oss;
+        oss << "relational_block_const<" << datatype_to_string(DT) << ", " << relational_to_string(OP) << '>';
+        return oss.str();
+    }
+
+public:
+    std::string get_block_name() const override {
+        if constexpr (OP == RelationalOperator::EQUAL) {
+            return BLK_NAME_REL_EQ_CONST;
+        } else if constexpr (OP == RelationalOperator::NOT_EQUAL) {
+            return BLK_NAME_REL_NEQ_CONST;
+        } else if constexpr (OP == RelationalOperator::GREATER_THAN) {
+            return BLK_NAME_REL_GT_CONST;
+        } else if constexpr (OP == RelationalOperator::GREATER_THAN_EQUAL) {
+            return BLK_NAME_REL_GEQ_CONST;
+        } else if constexpr (OP == RelationalOperator::LESS_THAN) {
+            return BLK_NAME_REL_LT_CONST;
+        } else if constexpr (OP == RelationalOperator::LESS_THAN_EQUAL) {
+            return BLK_NAME_REL_LEQ_CONST;
+        } else {
+            static_assert("unknown relational operation provided");
+        }
+    }
+
+    using type_info_t = relational_block_types<OP>;
+    block_types get_supported_types() const noexcept override {
+        return block_types{
+            .uses_integral = type_info_t::uses_integral,
+            .uses_float = type_info_t::uses_float,
+            .uses_logical = type_info_t::uses_logical,
+        };
+    }
+
+    DataType get_current_type() const noexcept override {
+        return DT;
+    }
+
+    void set_input(size_t port_num, const Argument* value) override {
+        if (port_num == 0) {
+            set_input_value<DT>(s_in.value, value);
+        } else {
+            throw block_error("input port too high");
+        }
+    }
+
+    void get_output(size_t port_num, Argument* value) const override {
+        if (port_num == 0) {
+            get_output_value<DataType::BOOL>(s_out.value, value);
+        } else {
+            throw block_error("output port too high");
+        }
+    }
+
+    size_t get_input_num() const noexcept override {
+        return 1;
+    }
+
+    bool get_input_type_settable(size_t port_num) const noexcept override {
+        return port_num < get_input_num();
+    }
+
+    size_t get_output_num() const noexcept override {
+        return 1;
+    }
+
+    bool is_stateless() const noexcept override { return true; }
+
+    size_t get_state_size() const noexcept override {
+        return sizeof(s_out);
+    }
+
+    void save_state(void* data) const noexcept override {
+        write_state_values(data, s_out);
+    }
+
+    void load_state(const void* data) noexcept override {
+        read_state_values(data, s_out);
+    }
+
+    DataType get_input_type(size_t port_num) const override {
+        if (port_num < get_input_num()) {
+            return DT;
+        } else {
+            throw block_error("input port too high");
+        }
+    }
+
+    DataType get_output_type(size_t port_num) const override {
+        if (port_num == 0) {
+            return DataType::BOOL;
+        } else {
+            throw block_error("output port too high");
+        }
+    }
+
+    size_t get_zero_crossing_num() const noexcept override {
+        return 1;
+    }
+
+    double get_zero_crossing(size_t index) const override {
+        if (index == 0) {
+            return static_cast<double>(s_in.value) - static_cast<double>(threshold);
+        } else {
+            throw block_error("zero crossing index too high");
+        }
+    }
+
+    std::string get_input_name(size_t port_num) const override {
+        if (port_num == 0) {
+            return "value";
+        } else {
+            throw block_error("input port too high");
+        }
+    }
+
+    std::string get_output_name(size_t port_num) const override {
+        if (port_num == 0) {
+            return "value";
+        } else {
+            throw block_error("output port too high");
+        }
+    }
+
+    std::unique_ptr<block_interface> clone() const override {
+        auto blk = std::make_unique<relational_block_const>(threshold);
+        blk->s_in = s_in;
+        blk->s_out = s_out;
+        return blk;
+    }
+#endif
+
+    input_t s_in;
+    output_t s_out;
+
+    const data_t threshold;
+};
+
+template <TrigFunction FCN>
+struct TrigInfo {
+    static const size_t input_count = 1;
+};
+
+template <>
+struct TrigInfo<TrigFunction::ATAN2> {
+    static const size_t input_count = 2;
+};
+
+template <DataType DT, size_t N, TrigFunction FCN>
+struct TrigOperation {};
+
+template <DataType DT, size_t N>
+struct TrigOperation<DT, N, TrigFunction::SIN> {
+    using data_t = typename type_info<DT>::type_t;
+    static data_t operation(const data_t values[N]) {
+        static_assert(N == 1, "sin requires a single argument");
+        static_assert(type_info<DT>::is_numeric, "sin requires a numeric data type");
+        return t_sin(values[0]);
+    }
+};
+
+template <DataType DT, size_t N>
+struct TrigOperation<DT, N, TrigFunction::COS> {
+    using data_t = typename type_info<DT>::type_t;
+    static data_t operation(const data_t values[N]) {
+        static_assert(N == 1, "cos requires a single argument");
+        static_assert(type_info<DT>::is_numeric, "cos requires a numeric data type");
+        return t_cos(values[0]);
+    }
+};
+
+template <DataType DT, size_t N>
+struct TrigOperation<DT, N, TrigFunction::TAN> {
+    using data_t = typename type_info<DT>::type_t;
+    static data_t operation(const data_t values[N]) {
+        static_assert(N == 1, "tan requires a single argument");
+        static_assert(type_info<DT>::is_numeric, "tan requires a numeric data type");
+        return t_tan(values[0]);
+    }
+};
+
+template <DataType DT, size_t N>
+struct TrigOperation<DT, N, TrigFunction::ASIN> {
+    using data_t = typename type_info<DT>::type_t;
+    static data_t operation(const data_t values[N]) {
+        static_assert(N == 1, "arcsin requires a single argument");
+        static_assert(type_info<DT>::is_numeric, "arcsin requires a numeric data type");
+        return t_asin(values[0]);
+    }
+};
+
+template <DataType DT, size_t N>
+struct TrigOperation<DT, N, TrigFunction::ACOS> {
+    using data_t = typename type_info<DT>::type_t;
+    static data_t operation(const data_t values[N]) {
+        static_assert(N == 1, "arccos requires a single argument");
+        static_assert(type_info<DT>::is_numeric, "arccos requires a numeric data type");
+        return t_acos(values[0]);
+    }
+};
+
+template <DataType DT, size_t N>
+struct TrigOperation<DT, N, TrigFunction::ATAN> {
+    using data_t = typename type_info<DT>::type_t;
+    static data_t operation(const data_t values[N]) {
+        static_assert(N == 1, "arctan requires a single argument");
+        static_assert(type_info<DT>::is_numeric, "arctan requires a numeric data type");
+        return t_atan(values[0]);
+    }
+};
+
+template <DataType DT, size_t N>
+struct TrigOperation<DT, N, TrigFunction::ATAN2> {
+    using data_t = typename type_info<DT>::type_t;
+    static data_t operation(const data_t values[N]) {
+        static_assert(N == 2, "arctan2 requires a single argument");
+        static_assert(type_info<DT>::is_numeric, "arctan2 requires a numeric data type");
+        return t_atan2(values[0], values[1]);
+    }
+};
+
+#ifdef MTEA_USE_FULL_LIB
+struct trig_block_types {
+    static constexpr bool uses_integral = false;
+    static constexpr bool uses_float = true;
+    static constexpr bool uses_logical = false;
+};
+#endif // MTEA_USE_FULL_LIB
+
+template <DataType DT, TrigFunction FCN>
+struct trig_block MT_COMPAT_SUBCLASS {
+    using data_t = typename type_info<DT>::type_t;
+
+    struct input_t {
+        data_t values[TrigInfo<FCN>::input_count];
+    };
+
+    struct output_t {
+        data_t value;
+    };
+
+    trig_block() = default;
+    trig_block(const trig_block&) = delete;
+    trig_block& operator=(const trig_block&) = delete;
+
+    void reset() noexcept MT_COMPAT_OVERRIDE { step(); }
+
+    void step() noexcept MT_COMPAT_OVERRIDE {
+        s_out.value = TrigOperation<DT, TrigInfo<FCN>::input_count, FCN>::operation(s_in.values);
+    }
+
+#ifdef MTEA_USE_FULL_LIB
+    using type_info_t = trig_block_types;
+    block_types get_supported_types() const noexcept override {
+        return block_types{
+            .uses_integral = type_info_t::uses_integral,
+            .uses_float = type_info_t::uses_float,
+            .uses_logical = type_info_t::uses_logical,
+        };
+    }
+
+    DataType get_current_type() const noexcept override {
+        return DT;
+    }
+
+    void set_input(size_t port_num, const Argument* value) override {
+        if (port_num < get_input_num()) {
+            set_input_value<DT>(s_in.values[port_num], value);
+        } else {
+            throw block_error("input port too high");
+        }
+    }
+
+    void get_output(size_t port_num, Argument* value) const override {
+        if (port_num == 0) {
+            get_output_value<DT>(s_out.value, value);
+        } else {
+            throw block_error("output port too high");
+        }
+    }
+
+    size_t get_input_num() const noexcept override {
+        return TrigInfo<FCN>::input_count;
+    }
+
+    bool get_input_type_settable(size_t port_num) const noexcept override {
+        return port_num < get_input_num();
+    }
+
+    size_t get_output_num() const noexcept override {
+        return 1;
+    }
+
+    bool is_stateless() const noexcept override { return true; }
+
+    size_t get_state_size() const noexcept override {
+        return sizeof(s_out);
+    }
+
+    void save_state(void* data) const noexcept override {
+        write_state_values(data, s_out);
+    }
+
+    void load_state(const void* data) noexcept override {
+        read_state_values(data, s_out);
+    }
+
+    DataType get_input_type(size_t port_num) const override {
+        if (port_num < get_input_num()) {
+            return DT;
+        } else {
+            throw block_error("input port too high");
+        }
+    }
+
+    DataType get_output_type(size_t port_num) const override {
+        if (port_num == 0) {
+            return DT;
+        } else {
+            throw block_error("output port too high");
+        }
+    }
+
+    std::string get_input_name(size_t port_num) const override {
+        if (port_num < get_input_num()) {
+            return (std::ostringstream() << "values[" << port_num << "]").str();
+        } else {
+            throw block_error("input port too high");
+        }
+    }
+
+    std::string get_output_name(size_t port_num) const override {
+        if (port_num == 0) {
+            return "value";
+        } else {
+            throw block_error("output port too high");
+        }
+    }
+
+protected:
+    std::string get_class_name() const override {
+        std::ostringstream oss;
+        oss << "trig_block<" << datatype_to_string(DT) << ", " << trig_func_to_string(FCN) << '>';
+        return oss.str();
+    }
+
+public:
+    std::string get_block_name() const override {
+        if constexpr (FCN == TrigFunction::SIN) {
+            return BLK_NAME_TRIG_SIN;
+        } else if (FCN == TrigFunction::COS) {
+            return BLK_NAME_TRIG_COS;
+        } else if (FCN == TrigFunction::TAN) {
+            return BLK_NAME_TRIG_TAN;
+        } else if (FCN == TrigFunction::ASIN) {
+            return BLK_NAME_TRIG_ASIN;
+        } else if (FCN == TrigFunction::ACOS) {
+            return BLK_NAME_TRIG_ACOS;
+        } else if (FCN == TrigFunction::ATAN) {
+            return BLK_NAME_TRIG_ATAN;
+        } else if (FCN == TrigFunction::ATAN2) {
+            return BLK_NAME_TRIG_ATAN2;
+        } else {
+            static_assert("unknown trig block type");
+        }
+    }
+
+
+    std::unique_ptr<block_interface> clone() const override {
+        auto blk = std::make_unique<trig_block>();
+        blk->s_in = s_in;
+        blk->s_out = s_out;
+        return blk;
+    }
+#endif
+
+    input_t s_in;
+    output_t s_out;
+};
+
+#ifdef MTEA_USE_FULL_LIB
+struct conversion_block_types {
+    static constexpr bool uses_integral = true;
+    static constexpr bool uses_float = true;
+    static constexpr bool uses_logical = true;
+};
+#endif // MTEA_USE_FULL_LIB
+
+template <DataType DT_IN, DataType DT_OUT>
+struct conversion_block MT_COMPAT_SUBCLASS {
+    using data_t_in = typename type_info<DT_IN>::type_t;
+    using data_t_out = typename type_info<DT_OUT>::type_t;
+
+    struct input_t {
+        data_t_in value;
+    };
+
+    struct output_t {
+        data_t_out value;
+    };
+
+    conversion_block() = default;
+    conversion_block(const conversion_block&) = delete;
+    conversion_block& operator=(const conversion_block&) = delete;
+
+    void reset() noexcept MT_COMPAT_OVERRIDE { step(); }
+
+    void step() noexcept MT_COMPAT_OVERRIDE {
+        s_out.value = static_cast<data_t_out>(s_in.value);
+    }
+
+#ifdef MTEA_USE_FULL_LIB
+    using type_info_t = conversion_block_types;
+    block_types get_supported_types() const noexcept override {
+        return block_types{
+            .uses_integral = type_info_t::uses_integral,
+            .uses_float = type_info_t::uses_float,
+            .uses_logical = type_info_t::uses_logical,
+        };
+    }
+
+    DataType get_current_type() const noexcept override {
+        return DT_IN;
+    }
+
+    void set_input(size_t port_num, const Argument* value) override {
+        if (port_num < get_input_num()) {
+            set_input_value<DT_IN>(s_in.value, value);
+        } else {
+            throw block_error("input port too high");
+        }
+    }
+
+    void get_output(size_t port_num, Argument* value) const override {
+        if (port_num < get_output_num()) {
+            get_output_value<DT_OUT>(s_out.value, value);
+        } else {
+            throw block_error("output port too high");
+        }
+    }
+
+    size_t get_input_num() const noexcept override {
+        return 1;
+    }
+
+    bool get_input_type_settable(size_t port_num) const noexcept override {
+        return port_num < get_output_num();
+    }
+
+    size_t get_output_num() const noexcept override {
+        return 1;
+    }
+
+    bool is_stateless() const noexcept override { return true; }
+
+    size_t get_state_size() const noexcept override {
+        return sizeof(s_out);
+    }
+
+    void save_state(void* data) const noexcept override {
+        write_state_values(data, s_out);
+    }
+
+    void load_state(const void* data) noexcept override {
+        read_state_values(data, s_out);
+    }
+
+    DataType get_input_type(size_t port_num) const override {
+        if (port_num < get_input_num()) {
+            return DT_IN;
+        } else {
+            throw block_error("input port too high");
+        }
+    }
+
+    DataType get_output_type(size_t port_num) const override {
+        if (port_num < get_output_num()) {
+            return DT_OUT;
+        } else {
+            throw block_error("output port too high");
+        }
+    }
+
+    std::string get_input_name(size_t port_num) const override {
+        if (port_num < get_input_num()) {
+            return "value";
+        } else {
+            throw block_error("input port too high");
+        }
+    }
+
+    std::string get_output_name(size_t port_num) const override {
+        if (port_num < get_output_num()) {
+            return "value";
+        } else {
+            throw block_error("output port too high");
+        }
+    }
+
+protected:
+    std::string get_class_name() const override {
+        std::ostringstream oss;
+        oss << "conversion_block<" << datatype_to_string(DT_IN) << ", " << datatype_to_string(DT_OUT) << '>';
+        return oss.str();
+    }
+
+public:
+    std::string get_block_name() const override {
+        return BLK_NAME_CONVERSION;
+    }
+
+
+    std::unique_ptr<block_interface> clone() const override {
+        auto blk = std::make_unique<conversion_block>();
+        blk->s_in = s_in;
+        blk->s_out = s_out;
+        return blk;
+    }
+#endif
+
+    input_t s_in;
+    output_t s_out;
+};
+
+#ifdef MTEA_USE_FULL_LIB
+struct recorder_block_types {
+    static constexpr bool uses_integral = true;
+    static constexpr bool uses_float = true;
+    static constexpr bool uses_logical = true;
+};
+#endif // MTEA_USE_FULL_LIB
+
+template <DataType DT>
+struct recorder_block_dynamic MT_COMPAT_SUBCLASS {
+    using data_t = typename type_info<DT>::type_t;
+
+    struct input_t {
+        data_t value;
+        bool enable;
+    };
+
+    recorder_block_dynamic() : s_in{}, decimation{1}, step_count{0}, buffer{nullptr}, capacity{0}, overrun_count{0}, head{0}, tail{0} {}
+
+    recorder_block_dynamic(const recorder_block_dynamic&) = delete;
+    recorder_block_dynamic& operator=(const recorder_block_dynamic&) = delete;
+
+    void reset() noexcept MT_COMPAT_OVERRIDE { step_count = 0; }
+
+    void step() noexcept MT_COMPAT_OVERRIDE {
+        const bool sample = s_in.enable && step_count % decimation == 0;
+        step_count += 1;
+
+        if (!sample) {
+            return;
+        }
+
+        const size_t h = head.load(std::memory_order_relaxed);
+        const size_t t = tail.load(std::memory_order_acquire);
+
+        if (h - t >= capacity) {
+            overrun_count.fetch_add(1, std::memory_order_relaxed);
+        } else {
+            buffer[h % capacity] = s_in.value;
+            head.store(h + 1, std::memory_order_release);
+        }
+    }
+
+    // Copies up to max_num recorded samples into values, oldest first. May be called from a single reader thread while
+    // the model continues to step.
+    size_t read(data_t* values, const size_t max_num) noexcept {
+        const size_t t = tail.load(std::memory_order_relaxed);
+        const size_t h = head.load(std::memory_order_acquire);
+
+        size_t num = h - t;
+        if (num > max_num) {
+            num = max_num;
+        }
+
+        for (size_t i = 0; i < num; ++i) {
+            values[i] = buffer[(t + i) % capacity];
+        }
+
+        tail.store(t + num, std::memory_order_release);
+        return num;
+    }
+
+    size_t get_available() const noexcept {
+        return head.load(std::memory_order_acquire) - tail.load(std::memory_order_acquire);
+    }
+
+    size_t get_capacity() const noexcept {
+        return capacity;
+    }
+
+    size_t get_overrun_count() const noexcept {
+        return overrun_count.load(std::memory_order_relaxed);
+    }
+
+    size_t get_decimation() const noexcept {
+        return decimation;
+    }
+
+    // Records every n-th enabled step, where a decimation of zero is treated as one
+    void set_decimation(const size_t n) noexcept {
+        decimation = n > 0 ? n : 1;
+    }
+
+    // Discards all recorded samples, which must only be called while no reader is active
+    void clear() noexcept {
+        tail.store(head.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        overrun_count.store(0, std::memory_order_relaxed);
+    }
+
+#ifdef MTEA_USE_FULL_LIB
+    static const size_t PORT_VALUE_NUM = 0;
+    static const size_t PORT_ENABLE_NUM = 1;
+
+    using type_info_t = recorder_block_types;
+    block_types get_supported_types() const noexcept override {
+        return block_types{
+            .uses_integral = type_info_t::uses_integral,
+            .uses_float = type_info_t::uses_float,
+            .uses_logical = type_info_t::uses_logical,
+        };
+    }
+
+    DataType get_current_type() const noexcept override {
+        return DT;
+    }
+
+    void set_input(size_t port_num, const Argument* value) override {
+        if (port_num == PORT_VALUE_NUM) {
+            set_input_value<DT>(s_in.value, value);
+        } else if (port_num == PORT_ENABLE_NUM) {
+            set_input_value<DataType::BOOL>(s_in.enable, value);
+        } else {
+            throw block_error("input port too high");
+        }
+    }
+
+    void get_output(size_t port_num, Argument* value) const override {
+        throw block_error("output port too high");
+    }
+
+    size_t get_input_num() const noexcept override {
+        return 2;
+    }
+
+    bool get_input_type_settable(size_t port_num) const noexcept override {
+        return port_num == PORT_VALUE_NUM;
+    }
+
+    size_t get_output_num() const noexcept override {
+        return 0;
+    }
+
+    DataType get_input_type(size_t port_num) const override {
+        if (port_num == PORT_VALUE_NUM) {
+            return DT;
+        } else if (port_num == PORT_ENABLE_NUM) {
+            return DataType::BOOL;
+        } else {
+            throw block_error("input port too high");
+        }
+    }
+
+    DataType get_output_type(size_t port_num) const override {
+        throw block_error("output port too high");
+    }
+
+    std::string get_input_name(size_t port_num) const override {
+        if (port_num == PORT_VALUE_NUM) {
+            return "value";
+        } else if (port_num == PORT_ENABLE_NUM) {
+            return "enable";
+        } else {
+            throw block_error("input port too high");
+        }
+    }
+
+    std::string get_output_name(size_t port_num) const override {
+        throw block_error("output port too high");
+    }
+
+    size_t get_state_size() const noexcept override {
+        return sizeof(step_count);
+    }
+
+    void save_state(void* data) const noexcept override {
+        write_state_values(data, step_count);
+    }
+
+    void load_state(const void* data) noexcept override {
+        read_state_values(data, step_count);
+    }
+
+    std::string get_parameters() const override {
+        return std::to_string(decimation);
+    }
+
+protected:
+    std::string get_class_name() const override {
+        std::ostringstream oss;
+        oss << "recorder_block_dynamic<" << datatype_to_string(DT) << '>';
+        return oss.str();
+    }
+
+    std::string get_class_name_codegen() const override {
+        std::ostringstream oss;
+        oss << "recorder_block<" << datatype_to_string(DT) << ", " << capacity << '>';
+        return oss.str();
+    }
+
+public:
+    std::string get_block_name() const override {
+        return BLK_NAME_RECORDER;
+    }
+#endif
+
+    input_t s_in;
+
+protected:
+    size_t decimation;
+    size_t step_count;
+
+    data_t* buffer;
+    size_t capacity;
+
+private:
+    // Read by a reader thread for monitoring while the model steps, so kept atomic even though only the model writes it
+    std::atomic<size_t> overrun_count;
+
+    alignas(64) std::atomic<size_t> head;
+    alignas(64) std::atomic<size_t> tail;
+};
+
+template <DataType DT, size_t SIZE>
+struct recorder_block : public recorder_block_dynamic<DT> {
+    using data_t = typename type_info<DT>::type_t;
+
+    explicit recorder_block(const size_t decimation = 1) {
+        static_assert(SIZE > 0, "recorder must have a non-zero capacity");
+        this->set_decimation(decimation);
+        this->buffer = _buffer_array.data();
+        this->capacity = SIZE;
+    }
+
+    recorder_block(const recorder_block&) = delete;
+    recorder_block& operator=(const recorder_block&) = delete;
+
+#ifdef MTEA_USE_FULL_LIB
+protected:
+    std::string get_class_name() const override {
+        std::ostringstream oss;
+        oss << "recorder_block<" << datatype_to_string(DT) << ", " << SIZE << '>';
+        return oss.str();
+    }
+
+public:
+    std::unique_ptr<block_interface> clone() const override {
+        auto blk = std::make_unique<recorder_block>(this->decimation);
+        blk->s_in = this->s_in;
+        blk->step_count = this->step_count;
+        return blk;
+    }
+#endif
+
+private:
+    std::array<data_t, SIZE> _buffer_array;
+};
+
+template <typename T>
+struct lookup_axis {
+    lookup_axis() : breakpoints{nullptr}, size{0}, inv_spacing{0}, uniform{false}, index{0} {}
+
+    // Uniformly spaced breakpoints are indexed directly, while other breakpoints are searched starting from the index of
+    // the previous lookup
+    void init(const T* bp, const size_t num) noexcept {
+        breakpoints = bp;
+        size = num;
+        index = 0;
+        uniform = false;
+        inv_spacing = 0;
+
+        if (num < 2 || !(bp[num - 1] > bp[0])) {
+            return;
+        }
+
+        const T range = bp[num - 1] - bp[0];
+        const T spacing = range / static_cast<T>(num - 1);
+        const T tol = range * static_cast<T>(16) * std::numeric_limits<T>::epsilon();
+
+        uniform = true;
+        for (size_t i = 1; i < num - 1; ++i) {
+            const T diff = bp[i] - (bp[0] + spacing * static_cast<T>(i));
+            if (diff > tol || diff < -tol) {
+                uniform = false;
+                break;
+            }
+        }
+
+        inv_spacing = static_cast<T>(1) / spacing;
+    }
+
+    // Returns the lower breakpoint index of the interval containing x, clamping x to the breakpoint range
+    size_t find(const T x, T& frac) noexcept {
+        if (size < 2 || !(x > breakpoints[0])) {
+            frac = 0;
+            index = 0;
+            return 0;
+        } else if (!(x < breakpoints[size - 1])) {
+            frac = 1;
+            index = size - 2;
+            return index;
+        }
+
+        size_t i = index;
+        if (uniform) {
+            i = static_cast<size_t>((x - breakpoints[0]) * inv_spacing);
+            if (i > size - 2) {
+                i = size - 2;
+            }
+        } else if (breakpoints[i] <= x && x < breakpoints[i + 1]) {
+            // Cached interval still contains x
+        } else if (i + 2 < size && breakpoints[i + 1] <= x && x < breakpoints[i + 2]) {
+            i += 1;
+        } else {
+            i = static_cast<size_t>(std::upper_bound(breakpoints, breakpoints + size, x) - breakpoints) - 1;
+        }
+
+        index = i;
+        frac = (x - breakpoints[i]) / (breakpoints[i + 1] - breakpoints[i]);
+        return i;
+    }
+
+    const T* breakpoints;
+    size_t size;
+    T inv_spacing;
+    bool uniform;
+    size_t index;
+};
+
+#ifdef MTEA_USE_FULL_LIB
+struct lookup_block_types {
+    static constexpr bool uses_integral = false;
+    static constexpr bool uses_float = true;
+    static constexpr bool uses_logical = false;
+};
+#endif // MTEA_USE_FULL_LIB
+
+template <DataType DT, size_t N>
+struct lookup_block MT_COMPAT_SUBCLASS {
+    using data_t = typename type_info<DT>::type_t;
+
+    struct input_t {
+        data_t values[N];
+    };
+
+    struct output_t {
+        data_t value;
+    };
+
+    // Interpolates linearly within a table stored in row-major order, where the last dimension is contiguous. The
+    // breakpoints of each dimension must be strictly increasing, and inputs outside the breakpoints are clamped.
+    lookup_block(const std::array<const data_t*, N>& breakpoints, const std::array<size_t, N>& sizes, const data_t* table) : s_in{}, s_out{}, table{table} {
+        static_assert(type_info<DT>::is_float, "data type must be a float");
+        static_assert(N > 0, "lookup must have at least one dimension");
+
+        size_t stride = 1;
+        for (size_t i = N; i > 0; --i) {
+            axes[i - 1].init(breakpoints[i - 1], sizes[i - 1]);
+            strides[i - 1] = sizes[i - 1] > 1 ? stride : 0;
+            stride *= sizes[i - 1];
+        }
+    }
+
+    lookup_block(const lookup_block&) = delete;
+    lookup_block& operator=(const lookup_block&) = delete;
+
+    void reset() noexcept MT_COMPAT_OVERRIDE { step(); }
+
+    void step() noexcept MT_COMPAT_OVERRIDE {
+        s_out.value = evaluate(s_in.values);
+    }
+
+    // Evaluates num points, with the N coordinates of each point stored consecutively in values, reusing the search
+    // index between points such that sorted or slowly varying points avoid searching
+    void evaluate_batch(const data_t* values, data_t* outputs, const size_t num) noexcept {
+        for (size_t i = 0; i < num; ++i) {
+            outputs[i] = evaluate(values + i * N);
+        }
+    }
+
+    input_t s_in;
+    output_t s_out;
+
+#ifdef MTEA_USE_FULL_LIB
+    using type_info_t = lookup_block_types;
+    block_types get_supported_types() const noexcept override {
+        return block_types{
+            .uses_integral = type_info_t::uses_integral,
+            .uses_float = type_info_t::uses_float,
+            .uses_logical = type_info_t::uses_logical,
+        };
+    }
+
+    DataType get_current_type() const noexcept override {
+        return DT;
+    }
+
+    void set_input(size_t port_num, const Argument* value) override {
+        if (port_num < N) {
+            set_input_value<DT>(s_in.values[port_num], value);
+        } else {
+            throw block_error("input port too high");
+        }
+    }
+
+    void get_output(size_t port_num, Argument* value) const override {
+        if (port_num == 0) {
+            get_output_value<DT>(s_out.value, value);
+        } else {
+            throw block_error("output port too high");
+        }
+    }
+
+    size_t get_input_num() const noexcept override {
+        return N;
+    }
+
+    bool get_input_type_settable(size_t port_num) const noexcept override {
+        return port_num < N;
+    }
+
+    size_t get_output_num() const noexcept override {
+        return 1;
+    }
+
+    bool is_stateless() const noexcept override { return true; }
+
+    size_t get_state_size() const noexcept override {
+        return sizeof(s_out);
+    }
+
+    void save_state(void* data) const noexcept override {
+        write_state_values(data, s_out);
+    }
+
+    void load_state(const void* data) noexcept override {
+        read_state_values(data, s_out);
+    }
+
+    DataType get_input_type(size_t port_num) const override {
+        if (port_num < N) {
+            return DT;
+        } else {
+            throw block_error("input port too high");
+        }
+    }
+
+    DataType get_output_type(size_t port_num) const override {
+        if (port_num == 0) {
+            return DT;
+        } else {
+            throw block_error("output port too high");
+        }
+    }
+
+    std::string get_input_name(size_t port_num) const override {
+        if (port_num < N) {
+            return (std::ostringstream() << "values[" << port_num << "]").str();
+        } else {
+            throw block_error("input port too high");
+        }
+    }
+
+    std::string get_output_name(size_t port_num) const override {
+        if (port_num == 0) {
+            return "value";
+        } else {
+            throw block_error("output port too high");
+        }
+    }
+
+    // The breakpoints and table are not owned by the block, so a hash of their values is included after the sizes,
+    // which keeps the signature short for large tables. Equal hashes are confirmed by has_equal_parameters().
+    std::string get_parameters() const override {
+        std::ostringstream oss;
+        for (size_t i = 0; i < N; ++i) {
+            oss << (i > 0 ? "x" : "") << axes[i].size;
+        }
+
+        uint64_t hash = FNV_OFFSET;
+        for (size_t i = 0; i < N; ++i) {
+            hash = hash_values(hash, axes[i].breakpoints, axes[i].size);
+        }
+
+        hash = hash_values(hash, table, get_table_size());
+        oss << ", #" << std::hex << std::setw(16) << std::setfill('0') << hash;
+        return oss.str();
+    }
+
+    bool has_equal_parameters(const block_interface& other) const override {
+        const auto* lookup = dynamic_cast<const lookup_block*>(&other);
+        if (lookup == nullptr) {
+            return false;
+        }
+
+        for (size_t i = 0; i < N; ++i) {
+            if (axes[i].size != lookup->axes[i].size || !equal_values(axes[i].breakpoints, lookup->axes[i].breakpoints, axes[i].size)) {
+                return false;
+            }
+        }
+
+        return equal_values(table, lookup->table, get_table_size());
+    }
+
+protected:
+    std::string get_class_name() const override {
+        std::ostringstream oss;
+        oss << "lookup_block<" << datatype_to_string(DT) << ", " << N << '>';
+        return oss.str();
+    }
+
+public:
+    std::string get_block_name() const override {
+        return BLK_NAME_LOOKUP;
+    }
+
+    std::unique_ptr<block_interface> clone() const override {
+        std::array<const data_t*, N> breakpoints;
+        std::array<size_t, N> sizes;
+        for (size_t i = 0; i < N; ++i) {
+            breakpoints[i] = axes[i].breakpoints;
+            sizes[i] = axes[i].size;
+        }
+
+        auto blk = std::make_unique<lookup_block>(breakpoints, sizes, table);
+        blk->s_in = s_in;
+        blk->s_out = s_out;
+        return blk;
+    }
+
+protected:
+    static const uint64_t FNV_OFFSET = 14695981039346656037ull;
+    static const uint64_t FNV_PRIME = 1099511628211ull;
+
+    size_t get_table_size() const noexcept {
+        size_t table_size = 1;
+        for (size_t i = 0; i < N; ++i) {
+            table_size *= axes[i].size;
+        }
+        return table_size;
+    }
+
+    static uint64_t hash_values(uint64_t hash, const data_t* values, const size_t num) noexcept {
+        const auto* bytes = reinterpret_cast<const unsigned char*>(values);
+        for (size_t i = 0; i < num * sizeof(data_t); ++i) {
+            hash = (hash ^ bytes[i]) * FNV_PRIME;
+        }
+        return hash;
+    }
+
+    // Shared storage is equal without reading it, which is the common case for lookups created from one calibration map
+    static bool equal_values(const data_t* a, const data_t* b, const size_t num) noexcept {
+        return a == b || num == 0 || std::memcmp(a, b, num * sizeof(data_t)) == 0;
+    }
+#endif
+
+protected:
+    data_t evaluate(const data_t* values) noexcept {
+        size_t base = 0;
+        data_t fracs[N];
+
+        for (size_t i = 0; i < N; ++i) {
+            base += axes[i].find(values[i], fracs[i]) * strides[i];
+        }
+
+        data_t result = 0;
+        for (size_t corner = 0; corner < (size_t(1) << N); ++corner) {
+            size_t offset = base;
+            data_t weight = 1;
+
+            for (size_t i = 0; i < N; ++i) {
+                if ((corner >> i) & 1) {
+                    offset += strides[i];
+                    weight *= fracs[i];
+                } else {
+                    weight *= 1 - fracs[i];
+                }
+            }
+
+            result += weight * table[offset];
+        }
+
+        return result;
+    }
+
+    lookup_axis<data_t> axes[N];
+    size_t strides[N];
+    const data_t* table;
+};
+
+#ifdef MTEA_USE_FULL_LIB
+struct filter_block_types {
+    static constexpr bool uses_integral = false;
+    static constexpr bool uses_float = true;
+    static constexpr bool uses_logical = false;
+};
+#endif // MTEA_USE_FULL_LIB
+
+template <DataType DT>
+struct fir_block_dynamic MT_COMPAT_SUBCLASS {
+    using data_t = typename type_info<DT>::type_t;
+
+    struct input_t {
+        data_t value;
+    };
+
+    struct output_t {
+        data_t value;
+    };
+
+    fir_block_dynamic() : s_in{}, s_out{}, coefficients{nullptr}, history{nullptr}, tap_num{0}, position{0} {
+        static_assert(type_info<DT>::is_float, "data type must be a float");
+    }
+
+    fir_block_dynamic(const fir_block_dynamic&) = delete;
+    fir_block_dynamic& operator=(const fir_block_dynamic&) = delete;
+
+    void reset() noexcept MT_COMPAT_OVERRIDE {
+        for (size_t i = 0; i < 2 * tap_num; ++i) {
+            history[i] = 0;
+        }
+
+        position = 0;
+        s_out.value = 0;
+    }
+
+    void step() noexcept MT_COMPAT_OVERRIDE {
+        // A default-constructed block has no buffers assigned and acts as an empty filter
+        if (tap_num == 0) {
+            s_out.value = 0;
+            return;
+        }
+
+        // History values are stored twice, such that the most recent tap_num inputs are always contiguous
+        position = position == 0 ? tap_num - 1 : position - 1;
+        history[position] = s_in.value;
+        history[position + tap_num] = s_in.value;
+
+        s_out.value = dot_product(coefficients, history + position, tap_num);
+    }
+
+    size_t get_tap_num() const noexcept {
+        return tap_num;
+    }
+
+    input_t s_in;
+    output_t s_out;
+
+    // Tap coefficients, where coefficients[i] multiplies the input from i steps ago
+    data_t* coefficients;
+
+#ifdef MTEA_USE_FULL_LIB
+    using type_info_t = filter_block_types;
+    block_types get_supported_types() const noexcept override {
+        return block_types{
+            .uses_integral = type_info_t::uses_integral,
+            .uses_float = type_info_t::uses_float,
+            .uses_logical = type_info_t::uses_logical,
+        };
+    }
+
+    DataType get_current_type() const noexcept override {
+        return DT;
+    }
+
+    void set_input(size_t port_num, const Argument* value) override {
+        if (port_num == 0) {
+            set_input_value<DT>(s_in.value, value);
+        } else {
+            throw block_error("input port too high");
+        }
+    }
+
+    void get_output(size_t port_num, Argument* value) const override {
+        if (port_num == 0) {
+            get_output_value<DT>(s_out.value, value);
+        } else {
+            throw block_error("output port too high");
+        }
+    }
+
+    size_t get_input_num() const noexcept override {
+        return 1;
+    }
+
+    bool get_input_type_settable(size_t port_num) const noexcept override {
+        return port_num == 0;
+    }
+
+    size_t get_output_num() const noexcept override {
+        return 1;
+    }
+
+    DataType get_input_type(size_t port_num) const override {
+        if (port_num == 0) {
+            return DT;
+        } else {
+            throw block_error("input port too high");
+        }
+    }
+
+    DataType get_output_type(size_t port_num) const override {
+        if (port_num == 0) {
+            return DT;
+        } else {
+            throw block_error("output port too high");
+        }
+    }
+
+    std::string get_input_name(size_t port_num) const override {
+        if (port_num == 0) {
+            return "value";
+        } else {
+            throw block_error("input port too high");
+        }
+    }
+
+    std::string get_output_name(size_t port_num) const override {
+        if (port_num == 0) {
+            return "value";
+        } else {
+            throw block_error("output port too high");
+        }
+    }
+
+    size_t get_state_size() const noexcept override {
+        return sizeof(s_out) + sizeof(position) + 2 * tap_num * sizeof(data_t);
+    }
+
+    void save_state(void* data) const noexcept override {
+        write_state_values(data, s_out, position);
+        std::memcpy(static_cast<unsigned char*>(data) + sizeof(s_out) + sizeof(position), history, 2 * tap_num * sizeof(data_t));
+    }
+
+    void load_state(const void* data) noexcept override {
+        read_state_values(data, s_out, position);
+        std::memcpy(history, static_cast<const unsigned char*>(data) + sizeof(s_out) + sizeof(position), 2 * tap_num * sizeof(data_t));
+    }
+
+    std::string get_parameters() const override {
+        std::ostringstream oss;
+        for (size_t i = 0; i < tap_num; ++i) {
+            oss << (i > 0 ? ", " : "") << parameter_to_string<DT>(coefficients[i]);
+        }
+        return oss.str();
+    }
+
+protected:
+    std::string get_class_name() const override {
+        std::ostringstream oss;
+        oss << "fir_block_dynamic<" << datatype_to_string(DT) << '>';
+        return oss.str();
+    }
+
+    std::string get_class_name_codegen() const override {
+        std::ostringstream oss;
+        oss << "fir_block<" << datatype_to_string(DT) << ", " << tap_num << '>';
+        return oss.str();
+    }
+
+public:
+    std::string get_block_name() const override {
+        return BLK_NAME_FIR;
+    }
+#endif
+
+protected:
+    void copy_from(const fir_block_dynamic& other) noexcept {
+        for (size_t i = 0; i < tap_num; ++i) {
+            coefficients[i] = other.coefficients[i];
+        }
+
+        for (size_t i = 0; i < 2 * tap_num; ++i) {
+            history[i] = other.history[i];
+        }
+
+        s_in = other.s_in;
+        s_out = other.s_out;
+        position = other.position;
+    }
+
+    data_t* history;
+    size_t tap_num;
+    size_t position;
+};
+
+template <DataType DT, size_t TAPS>
+struct fir_block : public fir_block_dynamic<DT> {
+    using data_t = typename type_info<DT>::type_t;
+
+    fir_block() : _coefficient_array{}, _history_array{} {
+        static_assert(TAPS > 0, "filter must have at least one tap");
+        _coefficient_array[0] = 1;
+        this->coefficients = _coefficient_array.data();
+        this->history = _history_array.data();
+        this->tap_num = TAPS;
+    }
+
+    explicit fir_block(const std::array<data_t, TAPS>& coefficients) : fir_block() {
+        _coefficient_array = coefficients;
+    }
+
+    fir_block(const fir_block&) = delete;
+    fir_block& operator=(const fir_block&) = delete;
+
+#ifdef MTEA_USE_FULL_LIB
+protected:
+    std::string get_class_name() const override {
+        std::ostringstream oss;
+        oss << "fir_block<" << datatype_to_string(DT) << ", " << TAPS << '>';
+        return oss.str();
+    }
+
+public:
+    std::unique_ptr<block_interface> clone() const override {
+        auto blk = std::make_unique<fir_block>();
+        blk->copy_from(*this);
+        return blk;
+    }
+#endif
+
+private:
+    std::array<data_t, TAPS> _coefficient_array;
+    std::array<data_t, 2 * TAPS> _history_array;
+};
+
+template <DataType DT>
+struct biquad_block_dynamic MT_COMPAT_SUBCLASS {
+    using data_t = typename type_info<DT>::type_t;
+
+    struct input_t {
+        data_t value;
+    };
+
+    struct output_t {
+        data_t value;
+    };
+
+    static const size_t COEFFICIENT_NUM = 5;
+
+    biquad_block_dynamic() : s_in{}, s_out{}, coefficients{nullptr}, states{nullptr}, section_num{0} {
+        static_assert(type_info<DT>::is_float, "data type must be a float");
+    }
+
+    biquad_block_dynamic(const biquad_block_dynamic&) = delete;
+    biquad_block_dynamic& operator=(const biquad_block_dynamic&) = delete;
+
+    void reset() noexcept MT_COMPAT_OVERRIDE {
+        for (size_t i = 0; i < 2 * section_num; ++i) {
+            states[i] = 0;
+        }
+
+        s_out.value = 0;
+    }
+
+    void step() noexcept MT_COMPAT_OVERRIDE {
+        data_t x = s_in.value;
+
+        // Each section is evaluated in transposed direct form II
+        for (size_t i = 0; i < section_num; ++i) {
+            const data_t* c = coefficients + i * COEFFICIENT_NUM;
+            data_t* z = states + i * 2;
+
+            const data_t y = c[0] * x + z[0];
+            z[0] = c[1] * x - c[3] * y + z[1];
+            z[1] = c[2] * x - c[4] * y;
+            x = y;
+        }
+
+        s_out.value = x;
+    }
+
+    size_t get_section_num() const noexcept {
+        return section_num;
+    }
+
+    input_t s_in;
+    output_t s_out;
+
+    // Normalized coefficients {b0, b1, b2, a1, a2} for each section, with a0 = 1
+    data_t* coefficients;
+
+#ifdef MTEA_USE_FULL_LIB
+    using type_info_t = filter_block_types;
+    block_types get_supported_types() const noexcept override {
+        return block_types{
+            .uses_integral = type_info_t::uses_integral,
+            .uses_float = type_info_t::uses_float,
+            .uses_logical = type_info_t::uses_logical,
+        };
+    }
+
+    DataType get_current_type() const noexcept override {
+        return DT;
+    }
+
+    void set_input(size_t port_num, const Argument* value) override {
+        if (port_num == 0) {
+            set_input_value<DT>(s_in.value, value);
+        } else {
+            throw block_error("input port too high");
+        }
+    }
+
+    void get_output(size_t port_num, Argument* value) const override {
+        if (port_num == 0) {
+            get_output_value<DT>(s_out.value, value);
+        } else {
+            throw block_error("output port too high");
+        }
+    }
+
+    size_t get_input_num() const noexcept override {
+        return 1;
+    }
+
+    bool get_input_type_settable(size_t port_num) const noexcept override {
+        return port_num == 0;
+    }
+
+    size_t get_output_num() const noexcept override {
+        return 1;
+    }
+
+    DataType get_input_type(size_t port_num) const override {
+        if (port_num == 0) {
+            return DT;
+        } else {
+            throw block_error("input port too high");
+        }
+    }
+
+    DataType get_output_type(size_t port_num) const override {
+        if (port_num == 0) {
+            return DT;
+        } else {
+            throw block_error("output port too high");
+        }
+    }
+
+    std::string get_input_name(size_t port_num) const override {
+        if (port_num == 0) {
+            return "value";
+        } else {
+            throw block_error("input port too high");
+        }
+    }
+
+    std::string get_output_name(size_t port_num) const override {
+        if (port_num == 0) {
+            return "value";
+        } else {
+            throw block_error("output port too high");
+        }
+    }
+
+    size_t get_state_size() const noexcept override {
+        return sizeof(s_out) + 2 * section_num * sizeof(data_t);
+    }
+
+    void save_state(void* data) const noexcept override {
+        write_state_values(data, s_out);
+        std::memcpy(static_cast<unsigned char*>(data) + sizeof(s_out), states, 2 * section_num * sizeof(data_t));
+    }
+
+    void load_state(const void* data) noexcept override {
+        read_state_values(data, s_out);
+        std::memcpy(states, static_cast<const unsigned char*>(data) + sizeof(s_out), 2 * section_num * sizeof(data_t));
+    }
+
+    std::string get_parameters() const override {
+        std::ostringstream oss;
+        for (size_t i = 0; i < section_num * COEFFICIENT_NUM; ++i) {
+            oss << (i > 0 ? ", " : "") << parameter_to_string<DT>(coefficients[i]);
+        }
+        return oss.str();
+    }
+
+protected:
+    std::string get_class_name() const override {
+        std::ostringstream oss;
+        oss << "biquad_block_dynamic<" << datatype_to_string(DT) << '>';
+        return oss.str();
+    }
+
+    std::string get_class_name_codegen() const override {
+        std::ostringstream oss;
+        oss << "biquad_block<" << datatype_to_string(DT) << ", " << section_num << '>';
+        return oss.str();
+    }
+
+public:
+    std::string get_block_name() const override {
+        return BLK_NAME_BIQUAD;
+    }
+#endif
+
+protected:
+    void copy_from(const biquad_block_dynamic& other) noexcept {
+        for (size_t i = 0; i < section_num * COEFFICIENT_NUM; ++i) {
+            coefficients[i] = other.coefficients[i];
+        }
+
+        for (size_t i = 0; i < 2 * section_num; ++i) {
+            states[i] = other.states[i];
+        }
+
+        s_in = other.s_in;
+        s_out = other.s_out;
+    }
+
+    data_t* states;
+    size_t section_num;
+};
+
+template <DataType DT, size_t SECTIONS>
+struct biquad_block : public biquad_block_dynamic<DT> {
+    using data_t = typename type_info<DT>::type_t;
+    using base_t = biquad_block_dynamic<DT>;
+
+    biquad_block() : _coefficient_array{}, _state_array{} {
+        static_assert(SECTIONS > 0, "filter must have at least one section");
+        for (size_t i = 0; i < SECTIONS; ++i) {
+            _coefficient_array[i * base_t::COEFFICIENT_NUM] = 1;
+        }
+        this->coefficients = _coefficient_array.data();
+        this->states = _state_array.data();
+        this->section_num = SECTIONS;
+    }
+
+    explicit biquad_block(const std::array<data_t, SECTIONS * base_t::COEFFICIENT_NUM>& coefficients) : biquad_block() {
+        _coefficient_array = coefficients;
+    }
+
+    biquad_block(const biquad_block&) = delete;
+    biquad_block& operator=(const biquad_block&) = delete;
+
+#ifdef MTEA_USE_FULL_LIB
+protected:
+    std::string get_class_name() const override {
+        std::ostringstream oss;
+        oss << "biquad_block<" << datatype_to_string(DT) << ", " << SECTIONS << '>';
+        return oss.str();
+    }
+
+public:
+    std::unique_ptr<block_interface> clone() const override {
+        auto blk = std::make_unique<biquad_block>();
+        blk->copy_from(*this);
+        return blk;
+    }
+#endif
+
+private:
+    std::array<data_t, SECTIONS * base_t::COEFFICIENT_NUM> _coefficient_array;
+    std::array<data_t, 2 * SECTIONS> _state_array;
+};
+
+#ifdef MTEA_USE_FULL_LIB
+struct linear_block_types {
+    static constexpr bool uses_integral = false;
+    static constexpr bool uses_float = true;
+    static constexpr bool uses_logical = false;
+};
+#endif // MTEA_USE_FULL_LIB
+
+template <DataType DT>
+struct state_space_block_dynamic MT_COMPAT_SUBCLASS {
+    using data_t = typename type_info<DT>::type_t;
+
+    struct input_t {
+        data_t* values;
+        size_t size;
+    };
+
+    struct output_t {
+        data_t* values;
+        size_t size;
+    };
+
+    state_space_block_dynamic() : s_in{nullptr, 0}, s_out{nullptr, 0}, a{nullptr}, b{nullptr}, c{nullptr}, d{nullptr}, states{nullptr}, next_states{nullptr}, state_num{0}, diagonal{false}, feedthrough{true} {
+        static_assert(type_info<DT>::is_float, "data type must be a float");
+    }
+
+    state_space_block_dynamic(const state_space_block_dynamic&) = delete;
+    state_space_block_dynamic& operator=(const state_space_block_dynamic&) = delete;
+
+    void reset() noexcept MT_COMPAT_OVERRIDE {
+        for (size_t i = 0; i < state_num; ++i) {
+            states[i] = 0;
+        }
+
+        for (size_t i = 0; i < s_out.size; ++i) {
+            s_out.values[i] = 0;
+        }
+    }
+
+    void step() noexcept MT_COMPAT_OVERRIDE {
+        const size_t n = state_num;
+        const size_t m = s_in.size;
+
+        for (size_t i = 0; i < s_out.size; ++i) {
+            s_out.values[i] = dot_product(c + i * n, states, n) + dot_product(d + i * m, s_in.values, m);
+        }
+
+        if (diagonal) {
+            for (size_t i = 0; i < n; ++i) {
+                next_states[i] = a[i * n + i] * states[i] + dot_product(b + i * m, s_in.values, m);
+            }
+        } else {
+            for (size_t i = 0; i < n; ++i) {
+                next_states[i] = dot_product(a + i * n, states, n) + dot_product(b + i * m, s_in.values, m);
+            }
+        }
+
+        data_t* tmp = states;
+        states = next_states;
+        next_states = tmp;
+    }
+
+    // Updates the evaluation path after the matrices are modified, using the diagonal of A only when every other
+    // element is zero
+    void analyze() noexcept {
+        diagonal = true;
+        for (size_t i = 0; i < state_num && diagonal; ++i) {
+            for (size_t j = 0; j < state_num; ++j) {
+                if (i != j && a[i * state_num + j] != 0) {
+                    diagonal = false;
+                    break;
+                }
+            }
+        }
+
+        feedthrough = false;
+        for (size_t i = 0; i < s_out.size * s_in.size; ++i) {
+            if (d[i] != 0) {
+                feedthrough = true;
+                break;
+            }
+        }
+    }
+
+    size_t get_state_num() const noexcept {
+        return state_num;
+    }
+
+    const data_t* get_states() const noexcept {
+        return states;
+    }
+
+    bool is_diagonal() const noexcept {
+        return diagonal;
+    }
+
+    input_t s_in;
+    output_t s_out;
+
+    // Row-major system matrices, such that x[k + 1] = A x[k] + B u[k] and y[k] = C x[k] + D u[k]
+    data_t* a;
+    data_t* b;
+    data_t* c;
+    data_t* d;
+
+#ifdef MTEA_USE_FULL_LIB
+    using type_info_t = linear_block_types;
+    block_types get_supported_types() const noexcept override {
+        return block_types{
+            .uses_integral = type_info_t::uses_integral,
+            .uses_float = type_info_t::uses_float,
+            .uses_logical = type_info_t::uses_logical,
+        };
+    }
+
+    DataType get_current_type() const noexcept override {
+        return DT;
+    }
+
+    void set_input(size_t port_num, const Argument* value) override {
+        if (port_num < s_in.size) {
+            set_input_value<DT>(s_in.values[port_num], value);
+        } else {
+            throw block_error("input port too high");
+        }
+    }
+
+    void get_output(size_t port_num, Argument* value) const override {
+        if (port_num < s_out.size) {
+            get_output_value<DT>(s_out.values[port_num], value);
+        } else {
+            throw block_error("output port too high");
+        }
+    }
+
+    size_t get_input_num() const noexcept override {
+        return s_in.size;
+    }
+
+    bool get_input_type_settable(size_t port_num) const noexcept override {
+        return port_num < s_in.size;
+    }
+
+    size_t get_output_num() const noexcept override {
+        return s_out.size;
+    }
+
+    DataType get_input_type(size_t port_num) const override {
+        if (port_num < s_in.size) {
+            return DT;
+        } else {
+            throw block_error("input port too high");
+        }
+    }
+
+    DataType get_output_type(size_t port_num) const override {
+        if (port_num < s_out.size) {
+            return DT;
+        } else {
+            throw block_error("output port too high");
+        }
+    }
+
+    bool outputs_are_delayed() const noexcept override { return !feedthrough; }
+
+    std::string get_input_name(size_t port_num) const override {
+        if (port_num < s_in.size) {
+            return (std::ostringstream() << "values[" << port_num << "]").str();
+        } else {
+            throw block_error("input port too high");
+        }
+    }
+
+    std::string get_output_name(size_t port_num) const override {
+        if (port_num < s_out.size) {
+            return (std::ostringstream() << "values[" << port_num << "]").str();
+        } else {
+            throw block_error("output port too high");
+        }
+    }
+
+    size_t get_state_size() const noexcept override {
+        return (state_num + s_out.size) * sizeof(data_t);
+    }
+
+    void save_state(void* data) const noexcept override {
+        std::memcpy(data, states, state_num * sizeof(data_t));
+        std::memcpy(static_cast<unsigned char*>(data) + state_num * sizeof(data_t), s_out.values, s_out.size * sizeof(data_t));
+    }
+
+    void load_state(const void* data) noexcept override {
+        std::memcpy(states, data, state_num * sizeof(data_t));
+        std::memcpy(s_out.values, static_cast<const unsigned char*>(data) + state_num * sizeof(data_t), s_out.size * sizeof(data_t));
+    }
+
+    std::string get_parameters() const override {
+        const size_t n = state_num;
+        const size_t m = s_in.size;
+        const size_t p = s_out.size;
+
+        std::ostringstream oss;
+        oss << n << "x" << m << "x" << p;
+
+        const std::pair<const data_t*, size_t> matrices[] = {{a, n * n}, {b, n * m}, {c, p * n}, {d, p * m}};
+        for (const auto& mat : matrices) {
+            for (size_t i = 0; i < mat.second; ++i) {
+                oss << ", " << parameter_to_string<DT>(mat.first[i]);
+            }
+        }
+
+        return oss.str();
+    }
+
+protected:
+    std::string get_class_name() const override {
+        std::ostringstream oss;
+        oss << "state_space_block_dynamic<" << datatype_to_string(DT) << '>';
+        return oss.str();
+    }
+
+    std::string get_class_name_codegen() const override {
+        std::ostringstream oss;
+        oss << "state_space_block<" << datatype_to_string(DT) << ", " << state_num << ", " << s_in.size << ", " << s_out.size << '>';
+        return oss.str();
+    }
+
+public:
+    std::string get_block_name() const override {
+        return BLK_NAME_STATE_SPACE;
+    }
+#endif
+
+protected:
+    void copy_from(const state_space_block_dynamic& other) noexcept {
+        const size_t n = state_num;
+        const size_t m = s_in.size;
+        const size_t p = s_out.size;
+
+        std::copy(other.a, other.a + n * n, a);
+        std::copy(other.b, other.b + n * m, b);
+        std::copy(other.c, other.c + p * n, c);
+        std::copy(other.d, other.d + p * m, d);
+        std::copy(other.states, other.states + n, states);
+        std::copy(other.s_in.values, other.s_in.values + m, s_in.values);
+        std::copy(other.s_out.values, other.s_out.values + p, s_out.values);
+
+        diagonal = other.diagonal;
+        feedthrough = other.feedthrough;
+    }
+
+    data_t* states;
+    data_t* next_states;
+    size_t state_num;
+
+    bool diagonal;
+    bool feedthrough;
+};
+
+template <DataType DT, size_t N, size_t M, size_t P>
+struct state_space_block : public state_space_block_dynamic<DT> {
+    using data_t = typename type_info<DT>::type_t;
+
+    state_space_block() : _a_array{}, _b_array{}, _c_array{}, _d_array{}, _state_array{}, _next_state_array{}, _input_array{}, _output_array{} {
+        static_assert(N > 0 && M > 0 && P > 0, "state space dimensions must be non-zero");
+        this->a = _a_array.data();
+        this->b = _b_array.data();
+        this->c = _c_array.data();
+        this->d = _d_array.data();
+        this->states = _state_array.data();
+        this->next_states = _next_state_array.data();
+        this->state_num = N;
+        this->s_in.values = _input_array.data();
+        this->s_in.size = M;
+        this->s_out.values = _output_array.data();
+        this->s_out.size = P;
+        this->analyze();
+    }
+
+    state_space_block(const std::array<data_t, N * N>& a, const std::array<data_t, N * M>& b, const std::array<data_t, P * N>& c, const std::array<data_t, P * M>& d) : state_space_block() {
+        _a_array = a;
+        _b_array = b;
+        _c_array = c;
+        _d_array = d;
+        this->analyze();
+    }
+
+    state_space_block(const state_space_block&) = delete;
+    state_space_block& operator=(const state_space_block&) = delete;
+
+#ifdef MTEA_USE_FULL_LIB
+protected:
+    std::string get_class_name() const override {
+        std::ostringstream oss;
+        oss << "state_space_block<" << datatype_to_string(DT) << ", " << N << ", " << M << ", " << P << '>';
+        return oss.str();
+    }
+
+public:
+    std::unique_ptr<block_interface> clone() const override {
+        auto blk = std::make_unique<state_space_block>();
+        blk->copy_from(*this);
+        return blk;
+    }
+#endif
+
+private:
+    alignas(64) std::array<data_t, N * N> _a_array;
+    alignas(64) std::array<data_t, N * M> _b_array;
+    alignas(64) std::array<data_t, P * N> _c_array;
+    alignas(64) std::array<data_t, P * M> _d_array;
+    alignas(64) std::array<data_t, N> _state_array;
+    alignas(64) std::array<data_t, N> _next_state_array;
+    std::array<data_t, M> _input_array;
+    std::array<data_t, P> _output_array;
+};
+
+template <DataType DT>
+struct transfer_function_block_dynamic MT_COMPAT_SUBCLASS {
+    using data_t = typename type_info<DT>::type_t;
+
+    struct input_t {
+        data_t value;
+    };
+
+    struct output_t {
+        data_t value;
+    };
+
+    transfer_function_block_dynamic() : s_in{}, s_out{}, numerator{nullptr}, denominator{nullptr}, states{nullptr}, order{0} {
+        static_assert(type_info<DT>::is_float, "data type must be a float");
+    }
+
+    transfer_function_block_dynamic(const transfer_function_block_dynamic&) = delete;
+    transfer_function_block_dynamic& operator=(const transfer_function_block_dynamic&) = delete;
+
+    void reset() noexcept MT_COMPAT_OVERRIDE {
+        for (size_t i = 0; i < order; ++i) {
+            states[i] = 0;
+        }
+
+        s_out.value = 0;
+    }
+
+    void step() noexcept MT_COMPAT_OVERRIDE {
+        // Evaluated in transposed direct form II, such that the states hold the pending terms for future steps
+        const data_t x = s_in.value;
+        const data_t y = numerator[0] * x + (order > 0 ? states[0] : data_t(0));
+
+        for (size_t i = 0; i + 1 < order; ++i) {
+            states[i] = numerator[i + 1] * x - denominator[i] * y + states[i + 1];
+        }
+
+        if (order > 0) {
+            states[order - 1] = numerator[order] * x - denominator[order - 1] * y;
+        }
+
+        s_out.value = y;
+    }
+
+    size_t get_order() const noexcept {
+        return order;
+    }
+
+    input_t s_in;
+    output_t s_out;
+
+    // Coefficients of H(z) = (b0 + b1 z^-1 + ... + bn z^-n) / (1 + a1 z^-1 + ... + an z^-n), where numerator holds
+    // {b0, ..., bn} and denominator holds {a1, ..., an}
+    data_t* numerator;
+    data_t* denominator;
+
+#ifdef MTEA_USE_FULL_LIB
+    using type_info_t = linear_block_types;
+    block_types get_supported_types() const noexcept override {
+        return block_types{
+            .uses_integral = type_info_t::uses_integral,
+            .uses_float = type_info_t::uses_float,
+            .uses_logical = type_info_t::uses_logical,
+        };
+    }
+
+    DataType get_current_type() const noexcept override {
+        return DT;
+    }
+
+    void set_input(size_t port_num, const Argument* value) override {
+        if (port_num == 0) {
+            set_input_value<DT>(s_in.value, value);
+        } else {
+            throw block_error("input port too high");
+        }
+    }
+
+    void get_output(size_t port_num, Argument* value) const override {
+        if (port_num == 0) {
+            get_output_value<DT>(s_out.value, value);
+        } else {
+            throw block_error("output port too high");
+        }
+    }
+
+    size_t get_input_num() const noexcept override {
+        return 1;
+    }
+
+    bool get_input_type_settable(size_t port_num) const noexcept override {
+        return port_num == 0;
+    }
+
+    size_t get_output_num() const noexcept override {
+        return 1;
+    }
+
+    DataType get_input_type(size_t port_num) const override {
+        if (port_num == 0) {
+            return DT;
+        } else {
+            throw block_error("input port too high");
+        }
+    }
+
+    DataType get_output_type(size_t port_num) const override {
+        if (port_num == 0) {
+            return DT;
+        } else {
+            throw block_error("output port too high");
+        }
+    }
+
+    std::string get_input_name(size_t port_num) const override {
+        if (port_num == 0) {
+            return "value";
+        } else {
+            throw block_error("input port too high");
+        }
+    }
+
+    std::string get_output_name(size_t port_num) const override {
+        if (port_num == 0) {
+            return "value";
+        } else {
+            throw block_error("output port too high");
+        }
+    }
+
+    size_t get_state_size() const noexcept override {
+        return sizeof(s_out) + order * sizeof(data_t);
+    }
+
+    void save_state(void* data) const noexcept override {
+        write_state_values(data, s_out);
+        std::memcpy(static_cast<unsigned char*>(data) + sizeof(s_out), states, order * sizeof(data_t));
+    }
+
+    void load_state(const void* data) noexcept override {
+        read_state_values(data, s_out);
+        std::memcpy(states, static_cast<const unsigned char*>(data) + sizeof(s_out), order * sizeof(data_t));
+    }
+
+    std::string get_parameters() const override {
+        std::ostringstream oss;
+        for (size_t i = 0; i <= order; ++i) {
+            oss << (i > 0 ? ", " : "") << parameter_to_string<DT>(numerator[i]);
+        }
+        for (size_t i = 0; i < order; ++i) {
+            oss << ", " << parameter_to_string<DT>(denominator[i]);
+        }
+        return oss.str();
+    }
+
+protected:
+    std::string get_class_name() const override {
+        std::ostringstream oss;
+        oss << "transfer_function_block_dynamic<" << datatype_to_string(DT) << '>';
+        return oss.str();
+    }
+
+    std::string get_class_name_codegen() const override {
+        std::ostringstream oss;
+        oss << "transfer_function_block<" << datatype_to_string(DT) << ", " << order << '>';
+        return oss.str();
+    }
+
+public:
+    std::string get_block_name() const override {
+        return BLK_NAME_TRANSFER_FCN;
+    }
+#endif
+
+protected:
+    void copy_from(const transfer_function_block_dynamic& other) noexcept {
+        std::copy(other.numerator, other.numerator + order + 1, numerator);
+        std::copy(other.denominator, other.denominator + order, denominator);
+        std::copy(other.states, other.states + order, states);
+
+        s_in = other.s_in;
+        s_out = other.s_out;
+    }
+
+    data_t* states;
+    size_t order;
+};
+
+template <DataType DT, size_t ORDER>
+struct transfer_function_block : public transfer_function_block_dynamic<DT> {
+    using data_t = typename type_info<DT>::type_t;
+
+    transfer_function_block() : _numerator_array{}, _denominator_array{}, _state_array{} {
+        _numerator_array[0] = 1;
+        this->numerator = _numerator_array.data();
+        this->denominator = _denominator_array.data();
+        this->states = _state_array.data();
+        this->order = ORDER;
+    }
+
+    transfer_function_block(const std::array<data_t, ORDER + 1>& numerator, const std::array<data_t, ORDER>& denominator) : transfer_function_block() {
+        _numerator_array = numerator;
+        _denominator_array = denominator;
+    }
+
+    transfer_function_block(const transfer_function_block&) = delete;
+    transfer_function_block& operator=(const transfer_function_block&) = delete;
+
+#ifdef MTEA_USE_FULL_LIB
+protected:
+    std::string get_class_name() const override {
+        std::ostringstream oss;
+        oss << "transfer_function_block<" << datatype_to_string(DT) << ", " << ORDER << '>';
+        return oss.str();
+    }
+
+public:
+    std::unique_ptr<block_interface> clone() const override {
+        auto blk = std::make_unique<transfer_function_block>();
+        blk->copy_from(*this);
+        return blk;
+    }
+#endif
+
+private:
+    std::array<data_t, ORDER + 1> _numerator_array;
+    std::array<data_t, ORDER> _denominator_array;
+    std::array<data_t, ORDER> _state_array;
+};
+
+template <typename T>
+struct pid_parameters {
+    T kp;
+    T ki;
+    T kd;
+    T filter_time;
+    T lower;
+    T upper;
+
+    // Evaluates a parallel PID controller with a first-order filtered derivative, where integration is paused while
+    // the output is saturated and the error would drive it further into saturation. On the first step after a reset
+    // there is no previous error, which is treated as an unchanged error to avoid a derivative kick.
+    T evaluate(const T error, const T dt, T& integral, T& derivative, T& prev_error, const bool first) const noexcept {
+        const T delta = first ? T(0) : error - prev_error;
+        derivative = (filter_time * derivative + kd * delta) / (filter_time + dt);
+        prev_error = error;
+
+        const T unsat = kp * error + integral + derivative;
+        const T value = unsat > upper ? upper : (unsat < lower ? lower : unsat);
+
+        const bool windup = (unsat > upper && error > 0) || (unsat < lower && error < 0);
+        integral += windup ? T(0) : ki * dt * error;
+
+        return value;
+    }
+
+#ifdef MTEA_USE_FULL_LIB
+    std::string to_string() const {
+        std::ostringstream oss;
+        oss << std::setprecision(std::numeric_limits<T>::max_digits10);
+        const T values[] = {kp, ki, kd, filter_time, lower, upper};
+        for (size_t i = 0; i < sizeof(values) / sizeof(values[0]); ++i) {
+            oss << (i > 0 ? ", " : "") << +values[i];
+        }
+        return oss.str();
+    }
+#endif
+};
+
+#ifdef MTEA_USE_FULL_LIB
+struct pid_block_types {
+    static constexpr bool uses_integral = false;
+    static constexpr bool uses_float = true;
+    static constexpr bool uses_logical = false;
+};
+#endif // MTEA_USE_FULL_LIB
+
+template <DataType DT>
+struct pid_block MT_COMPAT_SUBCLASS {
+    using data_t = typename type_info<DT>::type_t;
+
+    struct input_t {
+        data_t error;
+        bool reset_flag;
+    };
+
+    struct output_t {
+        data_t value;
+    };
+
+    explicit pid_block(const data_t dt, const data_t kp = 1, const data_t ki = 0, const data_t kd = 0, const data_t filter_time = 0, const data_t lower = -std::numeric_limits<data_t>::infinity(), const data_t upper = std::numeric_limits<data_t>::infinity()) : s_in{}, s_out{}, params{kp, ki, kd, filter_time, lower, upper}, time_step{dt}, integral{0}, derivative{0}, prev_error{0}, started{false} {
+        static_assert(type_info<DT>::is_float, "data type must be a float");
+    }
+
+    pid_block(const pid_block&) = delete;
+    pid_block& operator=(const pid_block&) = delete;
+
+    void reset() noexcept MT_COMPAT_OVERRIDE {
+        integral = 0;
+        derivative = 0;
+        prev_error = 0;
+        started = false;
+        s_out.value = 0;
+    }
+
+    void step() noexcept MT_COMPAT_OVERRIDE {
+        if (s_in.reset_flag) {
+            reset();
+        }
+
+        s_out.value = params.evaluate(s_in.error, time_step, integral, derivative, prev_error, !started);
+        started = true;
+    }
+
+    input_t s_in;
+    output_t s_out;
+
+    pid_parameters<data_t> params;
+    data_t time_step;
+
+#ifdef MTEA_USE_FULL_LIB
+    static const size_t PORT_ERROR_NUM = 0;
+    static const size_t PORT_FLAG_NUM = 1;
+
+    explicit pid_block(const Argument* dt) : pid_block(get_model_value<DT>(dt)) {}
+
+    void set_time_step(double dt) noexcept override { time_step = static_cast<data_t>(dt); }
+
+    using type_info_t = pid_block_types;
+    block_types get_supported_types() const noexcept override {
+        return block_types{
+            .uses_integral = type_info_t::uses_integral,
+            .uses_float = type_info_t::uses_float,
+            .uses_logical = type_info_t::uses_logical,
+        };
+    }
+
+    DataType get_current_type() const noexcept override {
+        return DT;
+    }
+
+    void set_input(size_t port_num, const Argument* value) override {
+        if (port_num == PORT_ERROR_NUM) {
+            set_input_value<DT>(s_in.error, value);
+        } else if (port_num == PORT_FLAG_NUM) {
+            set_input_value<DataType::BOOL>(s_in.reset_flag, value);
+        } else {
+            throw block_error("input port too high");
+        }
+    }
+
+    void get_output(size_t port_num, Argument* value) const override {
+        if (port_num == 0) {
+            get_output_value<DT>(s_out.value, value);
+        } else {
+            throw block_error("output port too high");
+        }
+    }
+
+    size_t get_input_num() const noexcept override {
+        return 2;
+    }
+
+    bool get_input_type_settable(size_t port_num) const noexcept override {
+        return port_num == PORT_ERROR_NUM;
+    }
+
+    size_t get_output_num() const noexcept override {
+        return 1;
+    }
+
+    DataType get_input_type(size_t port_num) const override {
+        if (port_num == PORT_ERROR_NUM) {
+            return DT;
+        } else if (port_num == PORT_FLAG_NUM) {
+            return DataType::BOOL;
+        } else {
+            throw block_error("input port too high");
+        }
+    }
+
+    DataType get_output_type(size_t port_num) const override {
+        if (port_num == 0) {
+            return DT;
+        } else {
+            throw block_error("output port too high");
+        }
+    }
+
+    std::string get_input_name(size_t port_num) const override {
+        if (port_num == PORT_ERROR_NUM) {
+            return "error";
+        } else if (port_num == PORT_FLAG_NUM) {
+            return "reset_flag";
+        } else {
+            throw block_error("input port too high");
+        }
+    }
+
+    std::string get_output_name(size_t port_num) const override {
+        if (port_num == 0) {
+            return "value";
+        } else {
+            throw block_error("output port too high");
+        }
+    }
+
+    size_t get_state_size() const noexcept override {
+        return sizeof(s_out) + sizeof(integral) + sizeof(derivative) + sizeof(prev_error) + sizeof(started);
+    }
+
+    void save_state(void* data) const noexcept override {
+        write_state_values(data, s_out, integral, derivative, prev_error, started);
+    }
+
+    void load_state(const void* data) noexcept override {
+        read_state_values(data, s_out, integral, derivative, prev_error, started);
+    }
+
+    std::string get_parameters() const override {
+        return params.to_string() + ", " + parameter_to_string<DT>(time_step);
+    }
+
+protected:
+    std::string get_class_name() const override {
+        std::ostringstream oss;
+        oss << "pid_block<" << datatype_to_string(DT) << '>';
+        return oss.str();
+    }
+
+public:
+    std::string get_block_name() const override {
+        return BLK_NAME_PID;
+    }
+
+    std::unique_ptr<block_interface> clone() const override {
+        auto blk = std::make_unique<pid_block>(time_step);
+        blk->params = params;
+        blk->s_in = s_in;
+        blk->s_out = s_out;
+        blk->integral = integral;
+        blk->derivative = derivative;
+        blk->prev_error = prev_error;
+        blk->started = started;
+        return blk;
+    }
+#endif
+
+protected:
+    data_t integral;
+    data_t derivative;
+    data_t prev_error;
+    bool started;
+};
+
+template <DataType DT>
+struct pid_bank_block_dynamic MT_COMPAT_SUBCLASS {
+    using data_t = typename type_info<DT>::type_t;
+
+    struct input_t {
+        data_t* errors;
+        size_t size;
+        bool reset_flag;
+    };
+
+    struct output_t {
+        data_t* values;
+        size_t size;
+    };
+
+    pid_bank_block_dynamic() : s_in{nullptr, 0, false}, s_out{nullptr, 0}, params{1, 0, 0, 0, -std::numeric_limits<data_t>::infinity(), std::numeric_limits<data_t>::infinity()}, time_step{1}, integrals{nullptr}, derivatives{nullptr}, prev_errors{nullptr}, started{false} {
+        static_assert(type_info<DT>::is_float, "data type must be a float");
+    }
+
+    pid_bank_block_dynamic(const pid_bank_block_dynamic&) = delete;
+    pid_bank_block_dynamic& operator=(const pid_bank_block_dynamic&) = delete;
+
+    void reset() noexcept MT_COMPAT_OVERRIDE {
+        for (size_t i = 0; i < s_out.size; ++i) {
+            integrals[i] = 0;
+            derivatives[i] = 0;
+            prev_errors[i] = 0;
+            s_out.values[i] = 0;
+        }
+
+        started = false;
+    }
+
+    void step() noexcept MT_COMPAT_OVERRIDE {
+        if (s_in.reset_flag) {
+            reset();
+        }
+
+        // Every loop shares the same parameters and keeps its state in separate arrays, such that the loop body has no
+        // dependencies between controllers
+        const pid_parameters<data_t> p = params;
+        const data_t dt = time_step;
+        const bool first = !started;
+        for (size_t i = 0; i < s_out.size; ++i) {
+            s_out.values[i] = p.evaluate(s_in.errors[i], dt, integrals[i], derivatives[i], prev_errors[i], first);
+        }
+
+        started = true;
+    }
+
+    input_t s_in;
+    output_t s_out;
+
+    pid_parameters<data_t> params;
+    data_t time_step;
+
+#ifdef MTEA_USE_FULL_LIB
+    void set_time_step(double dt) noexcept override { time_step = static_cast<data_t>(dt); }
+
+    using type_info_t = pid_block_types;
+    block_types get_supported_types() const noexcept override {
+        return block_types{
+            .uses_integral = type_info_t::uses_integral,
+            .uses_float = type_info_t::uses_float,
+            .uses_logical = type_info_t::uses_logical,
+        };
+    }
+
+    DataType get_current_type() const noexcept override {
+        return DT;
+    }
+
+    void set_input(size_t port_num, const Argument* value) override {
+        if (port_num < s_in.size) {
+            set_input_value<DT>(s_in.errors[port_num], value);
+        } else if (port_num == s_in.size) {
+            set_input_value<DataType::BOOL>(s_in.reset_flag, value);
+        } else {
+            throw block_error("input port too high");
+        }
+    }
+
+    void get_output(size_t port_num, Argument* value) const override {
+        if (port_num < s_out.size) {
+            get_output_value<DT>(s_out.values[port_num], value);
+        } else {
+            throw block_error("output port too high");
+        }
+    }
+
+    size_t get_input_num() const noexcept override {
+        return s_in.size + 1;
+    }
+
+    bool get_input_type_settable(size_t port_num) const noexcept override {
+        return port_num < s_in.size;
+    }
+
+    size_t get_output_num() const noexcept override {
+        return s_out.size;
+    }
+
+    DataType get_input_type(size_t port_num) const override {
+        if (port_num < s_in.size) {
+            return DT;
+        } else if (port_num == s_in.size) {
+            return DataType::BOOL;
+        } else {
+            throw block_error("input port too high");
+        }
+    }
+
+    DataType get_output_type(size_t port_num) const override {
+        if (port_num < s_out.size) {
+            return DT;
+        } else {
+            throw block_error("output port too high");
+        }
+    }
+
+    std::string get_input_name(size_t port_num) const override {
+        if (port_num < s_in.size) {
+            return (std::ostringstream() << "errors[" << port_num << "]").str();
+        } else if (port_num == s_in.size) {
+            return "reset_flag";
+        } else {
+            throw block_error("input port too high");
+        }
+    }
+
+    std::string get_output_name(size_t port_num) const override {
+        if (port_num < s_out.size) {
+            return (std::ostringstream() << "values[" << port_num << "]").str();
+        } else {
+            throw block_error("output port too high");
+        }
+    }
+
+    size_t get_state_size() const noexcept override {
+        return 4 * s_out.size * sizeof(data_t) + sizeof(started);
+    }
+
+    void save_state(void* data) const noexcept override {
+        const size_t size = s_out.size * sizeof(data_t);
+        auto* ptr = static_cast<unsigned char*>(data);
+        std::memcpy(ptr, s_out.values, size);
+        std::memcpy(ptr + size, integrals, size);
+        std::memcpy(ptr + 2 * size, derivatives, size);
+        std::memcpy(ptr + 3 * size, prev_errors, size);
+        std::memcpy(ptr + 4 * size, &started, sizeof(started));
+    }
+
+    void load_state(const void* data) noexcept override {
+        const size_t size = s_out.size * sizeof(data_t);
+        const auto* ptr = static_cast<const unsigned char*>(data);
+        std::memcpy(s_out.values, ptr, size);
+        std::memcpy(integrals, ptr + size, size);
+        std::memcpy(derivatives, ptr + 2 * size, size);
+        std::memcpy(prev_errors, ptr + 3 * size, size);
+        std::memcpy(&started, ptr + 4 * size, sizeof(started));
+    }
+
+    std::string get_parameters() const override {
+        return params.to_string() + ", " + parameter_to_string<DT>(time_step);
+    }
+
+protected:
+    std::string get_class_name() const override {
+        std::ostringstream oss;
+        oss << "pid_bank_block_dynamic<" << datatype_to_string(DT) << '>';
+        return oss.str();
+    }
+
+    std::string get_class_name_codegen() const override {
+        std::ostringstream oss;
+        oss << "pid_bank_block<" << datatype_to_string(DT) << ", " << s_out.size << '>';
+        return oss.str();
+    }
+
+public:
+    std::string get_block_name() const override {
+        return BLK_NAME_PID_BANK;
+    }
+#endif
+
+protected:
+    void copy_from(const pid_bank_block_dynamic& other) noexcept {
+        const size_t n = s_out.size;
+        std::copy(other.s_in.errors, other.s_in.errors + n, s_in.errors);
+        std::copy(other.s_out.values, other.s_out.values + n, s_out.values);
+        std::copy(other.integrals, other.integrals + n, integrals);
+        std::copy(other.derivatives, other.derivatives + n, derivatives);
+        std::copy(other.prev_errors, other.prev_errors + n, prev_errors);
+
+        s_in.reset_flag = other.s_in.reset_flag;
+        params = other.params;
+        time_step = other.time_step;
+        started = other.started;
+    }
+
+    data_t* integrals;
+    data_t* derivatives;
+    data_t* prev_errors;
+    bool started;
+};
+
+template <DataType DT, size_t SIZE>
+struct pid_bank_block : public pid_bank_block_dynamic<DT> {
+    using data_t = typename type_info<DT>::type_t;
+
+    explicit pid_bank_block(const data_t dt = 1) : _error_array{}, _value_array{}, _integral_array{}, _derivative_array{}, _prev_error_array{} {
+        static_assert(SIZE > 0, "bank must contain at least one controller");
+        this->time_step = dt;
+        this->s_in.errors = _error_array.data();
+        this->s_in.size = SIZE;
+        this->s_out.values = _value_array.data();
+        this->s_out.size = SIZE;
+        this->integrals = _integral_array.data();
+        this->derivatives = _derivative_array.data();
+        this->prev_errors = _prev_error_array.data();
+    }
+
+    pid_bank_block(const pid_bank_block&) = delete;
+    pid_bank_block& operator=(const pid_bank_block&) = delete;
+
+#ifdef MTEA_USE_FULL_LIB
+protected:
+    std::string get_class_name() const override {
+        std::ostringstream oss;
+        oss << "pid_bank_block<" << datatype_to_string(DT) << ", " << SIZE << '>';
+        return oss.str();
+    }
+
+public:
+    std::unique_ptr<block_interface> clone() const override {
+        auto blk = std::make_unique<pid_bank_block>();
+        blk->copy_from(*this);
+        return blk;
+    }
+#endif
+
+private:
+    std::array<data_t, SIZE> _error_array;
+    std::array<data_t, SIZE> _value_array;
+    std::array<data_t, SIZE> _integral_array;
+    std::array<data_t, SIZE> _derivative_array;
+    std::array<data_t, SIZE> _prev_error_array;
+};
+
+template <typename T>
+struct rotation_oscillator {
+    static const uint32_t RENORMALIZE_INTERVAL = 64;
+
+    void set(const T phase, const T increment) noexcept {
+        cos_value = t_cos(phase);
+        sin_value = t_sin(phase);
+        set_increment(increment);
+        count = 0;
+    }
+
+    // Changes the angle of each rotation, keeping the current phasor
+    void set_increment(const T increment) noexcept {
+        rotation_cos = t_cos(increment);
+        rotation_sin = t_sin(increment);
+    }
+
+    void rotate(const T rc, const T rs) noexcept {
+        const T c = cos_value * rc - sin_value * rs;
+        const T s = sin_value * rc + cos_value * rs;
+        cos_value = c;
+        sin_value = s;
+
+        // Rounding errors slowly change the phasor magnitude, which is pulled back towards one with a single Newton step
+        // of the inverse square root, such that no square root is needed
+        if (++count == RENORMALIZE_INTERVAL) {
+            const T gain = (T(3) - (c * c + s * s)) / T(2);
+            cos_value *= gain;
+            sin_value *= gain;
+            count = 0;
+        }
+    }
+
+    void advance() noexcept {
+        rotate(rotation_cos, rotation_sin);
+    }
+
+    T cos_value;
+    T sin_value;
+    T rotation_cos;
+    T rotation_sin;
+    uint32_t count;
+};
+
+#ifdef MTEA_USE_FULL_LIB
+struct generator_block_types {
+    static constexpr bool uses_integral = false;
+    static constexpr bool uses_float = true;
+    static constexpr bool uses_logical = false;
+};
+#endif // MTEA_USE_FULL_LIB
+
+// Generates a sine and cosine pair by rotating a unit phasor each step, with parameter changes applied on reset
+template <DataType DT>
+struct sine_wave_block MT_COMPAT_SUBCLASS {
+    using data_t = typename type_info<DT>::type_t;
+
+    struct output_t {
+        data_t value;
+        data_t quadrature;
+    };
+
+    explicit sine_wave_block(const data_t dt, const data_t frequency = 1, const data_t amplitude = 1, const data_t phase = 0, const data_t offset = 0) : s_out{}, frequency{frequency}, amplitude{amplitude}, phase{phase}, offset{offset}, time_step{dt}, osc{} {
+        static_assert(type_info<DT>::is_float, "data type must be a float");
+    }
+
+    sine_wave_block(const sine_wave_block&) = delete;
+    sine_wave_block& operator=(const sine_wave_block&) = delete;
+
+    void reset() noexcept MT_COMPAT_OVERRIDE {
+        osc.set(phase, 2 * t_pi<data_t>() * frequency * time_step);
+        update_output();
+    }
+
+    void step() noexcept MT_COMPAT_OVERRIDE {
+        osc.advance();
+        update_output();
+    }
+
+    // Fills values with the outputs of the following steps, equivalent to calling step for each. The phasor is advanced
+    // in a local copy, such that it stays in registers, and the block state is only written once at the end.
+    void generate(data_t* values, const size_t num) noexcept {
+        rotation_oscillator<data_t> local = osc;
+        for (size_t i = 0; i < num; ++i) {
+            local.advance();
+            values[i] = amplitude * local.sin_value + offset;
+        }
+
+        if (num > 0) {
+            osc = local;
+            update_output();
+        }
+    }
+
+    output_t s_out;
+
+    data_t frequency;
+    data_t amplitude;
+    data_t phase;
+    data_t offset;
+    data_t time_step;
+
+#ifdef MTEA_USE_FULL_LIB
+    explicit sine_wave_block(const Argument* dt) : sine_wave_block(get_model_value<DT>(dt)) {}
+
+    // The rotation is recomputed when the step size changes, such that the phase follows the variable-step solver time
+    void set_time_step(double dt) noexcept override {
+        const data_t new_step = static_cast<data_t>(dt);
+        if (new_step != time_step) {
+            time_step = new_step;
+            osc.set_increment(2 * t_pi<data_t>() * frequency * time_step);
+        }
+    }
+
+    using type_info_t = generator_block_types;
+    block_types get_supported_types() const noexcept override {
+        return block_types{
+            .uses_integral = type_info_t::uses_integral,
+            .uses_float = type_info_t::uses_float,
+            .uses_logical = type_info_t::uses_logical,
+        };
+    }
+
+    DataType get_current_type() const noexcept override {
+        return DT;
+    }
+
+    void set_input(size_t port_num, const Argument* value) override {
+        throw block_error("input port too high");
+    }
+
+    void get_output(size_t port_num, Argument* value) const override {
+        if (port_num == 0) {
+            get_output_value<DT>(s_out.value, value);
+        } else if (port_num == 1) {
+            get_output_value<DT>(s_out.quadrature, value);
+        } else {
+            throw block_error("output port too high");
+        }
+    }
+
+    size_t get_input_num() const noexcept override {
+        return 0;
+    }
+
+    bool get_input_type_settable(size_t port_num) const noexcept override {
+        return false;
+    }
+
+    size_t get_output_num() const noexcept override {
+        return 2;
+    }
+
+    DataType get_input_type(size_t port_num) const override {
+        throw block_error("input port too high");
+    }
+
+    DataType get_output_type(size_t port_num) const override {
+        if (port_num < 2) {
+            return DT;
+        } else {
+            throw block_error("output port too high");
+        }
+    }
+
+    std::string get_input_name(size_t port_num) const override {
+        throw block_error("input port too high");
+    }
+
+    std::string get_output_name(size_t port_num) const override {
+        if (port_num == 0) {
+            return "value";
+        } else if (port_num == 1) {
+            return "quadrature";
+        } else {
+            throw block_error("output port too high");
+        }
+    }
+
+    size_t get_state_size() const noexcept override {
+        return sizeof(s_out) + sizeof(osc);
+    }
+
+    void save_state(void* data) const noexcept override {
+        write_state_values(data, s_out, osc);
+    }
+
+    void load_state(const void* data) noexcept override {
+        read_state_values(data, s_out, osc);
+    }
+
+    std::string get_parameters() const override {
+        return parameter_to_string<DT>(frequency) + ", " + parameter_to_string<DT>(amplitude) + ", " + parameter_to_string<DT>(phase) + ", " + parameter_to_string<DT>(offset) + ", " + parameter_to_string<DT>(time_step);
+    }
+
+protected:
+    std::string get_class_name() const override {
+        std::ostringstream oss;
+        oss << "sine_wave_block<" << datatype_to_string(DT) << '>';
+        return oss.str();
+    }
+
+public:
+    std::string get_block_name() const override {
+        return BLK_NAME_SINE_WAVE;
+    }
+
+    std::unique_ptr<block_interface> clone() const override {
+        auto blk = std::make_unique<sine_wave_block>(time_step);
+        blk->frequency = frequency;
+        blk->amplitude = amplitude;
+        blk->phase = phase;
+        blk->offset = offset;
+        blk->s_out = s_out;
+        blk->osc = osc;
+        return blk;
+    }
+#endif
+
+protected:
+    void update_output() noexcept {
+        s_out.value = amplitude * osc.sin_value + offset;
+        s_out.quadrature = amplitude * osc.cos_value + offset;
+    }
+
+    rotation_oscillator<data_t> osc;
+};
+
+template <DataType DT>
+struct square_wave_block MT_COMPAT_SUBCLASS {
+    using data_t = typename type_info<DT>::type_t;
+
+    struct output_t {
+        data_t value;
+    };
+
+    explicit square_wave_block(const data_t dt, const data_t frequency = 1, const data_t amplitude = 1, const data_t offset = 0) : s_out{}, frequency{frequency}, amplitude{amplitude}, offset{offset}, time_step{dt}, cycle{0} {
+        static_assert(type_info<DT>::is_float, "data type must be a float");
+    }
+
+    square_wave_block(const square_wave_block&) = delete;
+    square_wave_block& operator=(const square_wave_block&) = delete;
+
+    void reset() noexcept MT_COMPAT_OVERRIDE {
+        cycle = 0;
+        s_out.value = offset + amplitude;
+    }
+
+    void step() noexcept MT_COMPAT_OVERRIDE {
+        cycle += frequency * time_step;
+        cycle -= static_cast<data_t>(static_cast<int64_t>(cycle));
+        s_out.value = offset + (cycle < data_t(0.5) ? amplitude : -amplitude);
+    }
+
+    // Fills values with the outputs of the following steps, equivalent to calling step for each
+    void generate(data_t* values, const size_t num) noexcept {
+        data_t c = cycle;
+        for (size_t i = 0; i < num; ++i) {
+            c += frequency * time_step;
+            c -= static_cast<data_t>(static_cast<int64_t>(c));
+            values[i] = offset + (c < data_t(0.5) ? amplitude : -amplitude);
+        }
+
+        if (num > 0) {
+            cycle = c;
+            s_out.value = values[num - 1];
+        }
+    }
+
+    output_t s_out;
+
+    data_t frequency;
+    data_t amplitude;
+    data_t offset;
+    data_t time_step;
+
+#ifdef MTEA_USE_FULL_LIB
+    explicit square_wave_block(const Argument* dt) : square_wave_block(get_model_value<DT>(dt)) {}
+
+    void set_time_step(double dt) noexcept override { time_step = static_cast<data_t>(dt); }
+
+    using type_info_t = generator_block_types;
+    block_types get_supported_types() const noexcept override {
+        return block_types{
+            .uses_integral = type_info_t::uses_integral,
+            .uses_float = type_info_t::uses_float,
+            .uses_logical = type_info_t::uses_logical,
+        };
+    }
+
+    DataType get_current_type() const noexcept override {
+        return DT;
+    }
+
+    void set_input(size_t port_num, const Argument* value) override {
+        throw block_error("input port too high");
+    }
+
+    void get_output(size_t port_num, Argument* value) const override {
+        if (port_num == 0) {
+            get_output_value<DT>(s_out.value, value);
+        } else {
+            throw block_error("output port too high");
+        }
+    }
+
+    size_t get_input_num() const noexcept override {
+        return 0;
+    }
+
+    bool get_input_type_settable(size_t port_num) const noexcept override {
+        return false;
+    }
+
+    size_t get_output_num() const noexcept override {
+        return 1;
+    }
+
+    DataType get_input_type(size_t port_num) const override {
+        throw block_error("input port too high");
+    }
+
+    DataType get_output_type(size_t port_num) const override {
+        if (port_num < 1) {
+            return DT;
+        } else {
+            throw block_error("output port too high");
+        }
+    }
+
+    std::string get_input_name(size_t port_num) const override {
+        throw block_error("input port too high");
+    }
+
+    std::string get_output_name(size_t port_num) const override {
+        if (port_num == 0) {
+            return "value";
+        } else {
+            throw block_error("output port too high");
+        }
+    }
+
+    size_t get_state_size() const noexcept override {
+        return sizeof(s_out) + sizeof(cycle);
+    }
+
+    void save_state(void* data) const noexcept override {
+        write_state_values(data, s_out, cycle);
+    }
+
+    void load_state(const void* data) noexcept override {
+        read_state_values(data, s_out, cycle);
+    }
+
+    std::string get_parameters() const override {
+        return parameter_to_string<DT>(frequency) + ", " + parameter_to_string<DT>(amplitude) + ", " + parameter_to_string<DT>(offset) + ", " + parameter_to_string<DT>(time_step);
+    }
+
+protected:
+    std::string get_class_name() const override {
+        std::ostringstream oss;
+        oss << "square_wave_block<" << datatype_to_string(DT) << '>';
+        return oss.str();
+    }
+
+public:
+    std::string get_block_name() const override {
+        return BLK_NAME_SQUARE_WAVE;
+    }
+
+    std::unique_ptr<block_interface> clone() const override {
+        auto blk = std::make_unique<square_wave_block>(time_step);
+        blk->frequency = frequency;
+        blk->amplitude = amplitude;
+        blk->offset = offset;
+        blk->s_out = s_out;
+        blk->cycle = cycle;
+        return blk;
+    }
+#endif
+
+protected:
+    data_t cycle;
+};
+
+template <DataType DT>
+struct pulse_block MT_COMPAT_SUBCLASS {
+    using data_t = typename type_info<DT>::type_t;
+
+    struct output_t {
+        data_t value;
+    };
+
+    explicit pulse_block(const data_t dt, const data_t frequency = 1, const data_t amplitude = 1, const data_t duty = data_t(0.5)) : s_out{}, frequency{frequency}, amplitude{amplitude}, duty{duty}, time_step{dt}, cycle{0} {
+        static_assert(type_info<DT>::is_float, "data type must be a float");
+    }
+
+    pulse_block(const pulse_block&) = delete;
+    pulse_block& operator=(const pulse_block&) = delete;
+
+    void reset() noexcept MT_COMPAT_OVERRIDE {
+        cycle = 0;
+        s_out.value = duty > 0 ? amplitude : data_t(0);
+    }
+
+    void step() noexcept MT_COMPAT_OVERRIDE {
+        cycle += frequency * time_step;
+        cycle -= static_cast<data_t>(static_cast<int64_t>(cycle));
+        s_out.value = cycle < duty ? amplitude : data_t(0);
+    }
+
+    // Fills values with the outputs of the following steps, equivalent to calling step for each
+    void generate(data_t* values, const size_t num) noexcept {
+        data_t c = cycle;
+        for (size_t i = 0; i < num; ++i) {
+            c += frequency * time_step;
+            c -= static_cast<data_t>(static_cast<int64_t>(c));
+            values[i] = c < duty ? amplitude : data_t(0);
+        }
+
+        if (num > 0) {
+            cycle = c;
+            s_out.value = values[num - 1];
+        }
+    }
+
+    output_t s_out;
+
+    data_t frequency;
+    data_t amplitude;
+    data_t duty;
+    data_t time_step;
+
+#ifdef MTEA_USE_FULL_LIB
+    explicit pulse_block(const Argument* dt) : pulse_block(get_model_value<DT>(dt)) {}
+
+    void set_time_step(double dt) noexcept override { time_step = static_cast<data_t>(dt); }
+
+    using type_info_t = generator_block_types;
+    block_types get_supported_types() const noexcept override {
+        return block_types{
+            .uses_integral = type_info_t::uses_integral,
+            .uses_float = type_info_t::uses_float,
+            .uses_logical = type_info_t::uses_logical,
+        };
+    }
+
+    DataType get_current_type() const noexcept override {
+        return DT;
+    }
+
+    void set_input(size_t port_num, const Argument* value) override {
+        throw block_error("input port too high");
+    }
+
+    void get_output(size_t port_num, Argument* value) const override {
+        if (port_num == 0) {
+            get_output_value<DT>(s_out.value, value);
+        } else {
+            throw block_error("output port too high");
+        }
+    }
+
+    size_t get_input_num() const noexcept override {
+        return 0;
+    }
+
+    bool get_input_type_settable(size_t port_num) const noexcept override {
+        return false;
+    }
+
+    size_t get_output_num() const noexcept override {
+        return 1;
+    }
+
+    DataType get_input_type(size_t port_num) const override {
+        throw block_error("input port too high");
+    }
+
+    DataType get_output_type(size_t port_num) const override {
+        if (port_num < 1) {
+            return DT;
+        } else {
+            throw block_error("output port too high");
+        }
+    }
+
+    std::string get_input_name(size_t port_num) const override {
+        throw block_error("input port too high");
+    }
+
+    std::string get_output_name(size_t port_num) const override {
+        if (port_num == 0) {
+            return "value";
+        } else {
+            throw block_error("output port too high");
+        }
+    }
+
+    size_t get_state_size() const noexcept override {
+        return sizeof(s_out) + sizeof(cycle);
+    }
+
+    void save_state(void* data) const noexcept override {
+        write_state_values(data, s_out, cycle);
+    }
+
+    void load_state(const void* data) noexcept override {
+        read_state_values(data, s_out, cycle);
+    }
+
+    std::string get_parameters() const override {
+        return parameter_to_string<DT>(frequency) + ", " + parameter_to_string<DT>(amplitude) + ", " + parameter_to_string<DT>(duty) + ", " + parameter_to_string<DT>(time_step);
+    }
+
+protected:
+    std::string get_class_name() const override {
+        std::ostringstream oss;
+        oss << "pulse_block<" << datatype_to_string(DT) << '>';
+        return oss.str();
+    }
+
+public:
+    std::string get_block_name() const override {
+        return BLK_NAME_PULSE;
+    }
+
+    std::unique_ptr<block_interface> clone() const override {
+        auto blk = std::make_unique<pulse_block>(time_step);
+        blk->frequency = frequency;
+        blk->amplitude = amplitude;
+        blk->duty = duty;
+        blk->s_out = s_out;
+        blk->cycle = cycle;
+        return blk;
+    }
+#endif
+
+protected:
+    data_t cycle;
+};
+
+// Computes the ramp from an integer step count rather than accumulating the time step, such that it does not drift. The
+// elapsed time is moved into origin_time whenever the step size changes.
+template <DataType DT>
+struct ramp_block MT_COMPAT_SUBCLASS {
+    using data_t = typename type_info<DT>::type_t;
+
+    struct output_t {
+        data_t value;
+    };
+
+    explicit ramp_block(const data_t dt, const data_t slope = 1, const data_t start_time = 0, const data_t initial = 0) : s_out{}, slope{slope}, start_time{start_time}, initial{initial}, time_step{dt}, origin_time{0}, step_count{0} {
+        static_assert(type_info<DT>::is_float, "data type must be a float");
+    }
+
+    ramp_block(const ramp_block&) = delete;
+    ramp_block& operator=(const ramp_block&) = delete;
+
+    void reset() noexcept MT_COMPAT_OVERRIDE {
+        origin_time = 0;
+        step_count = 0;
+        update_output();
+    }
+
+    void step() noexcept MT_COMPAT_OVERRIDE {
+        step_count += 1;
+        update_output();
+    }
+
+    // Fills values with the outputs of the following steps, equivalent to calling step for each. Each value only
+    // depends on its own step count, such that the loop carries no dependencies between iterations.
+    void generate(data_t* values, const size_t num) noexcept {
+        for (size_t i = 0; i < num; ++i) {
+            const data_t elapsed = origin_time + static_cast<data_t>(step_count + i + 1) * time_step - start_time;
+            values[i] = initial + slope * std::max(elapsed, data_t(0));
+        }
+
+        if (num > 0) {
+            step_count += num;
+            s_out.value = values[num - 1];
+        }
+    }
+
+    output_t s_out;
+
+    data_t slope;
+    data_t start_time;
+    data_t initial;
+    data_t time_step;
+
+#ifdef MTEA_USE_FULL_LIB
+    explicit ramp_block(const Argument* dt) : ramp_block(get_model_value<DT>(dt)) {}
+
+    void set_time_step(double dt) noexcept override {
+        const data_t new_step = static_cast<data_t>(dt);
+        if (new_step != time_step) {
+            origin_time += static_cast<data_t>(step_count) * time_step;
+            step_count = 0;
+            time_step = new_step;
+        }
+    }
+
+    using type_info_t = generator_block_types;
+    block_types get_supported_types() const noexcept override {
+        return block_types{
+            .uses_integral = type_info_t::uses_integral,
+            .uses_float = type_info_t::uses_float,
+            .uses_logical = type_info_t::uses_logical,
+        };
+    }
+
+    DataType get_current_type() const noexcept override {
+        return DT;
+    }
+
+    void set_input(size_t port_num, const Argument* value) override {
+        throw block_error("input port too high");
+    }
+
+    void get_output(size_t port_num, Argument* value) const override {
+        if (port_num == 0) {
+            get_output_value<DT>(s_out.value, value);
+        } else {
+            throw block_error("output port too high");
+        }
+    }
+
+    size_t get_input_num() const noexcept override {
+        return 0;
+    }
+
+    bool get_input_type_settable(size_t port_num) const noexcept override {
+        return false;
+    }
+
+    size_t get_output_num() const noexcept override {
+        return 1;
+    }
+
+    DataType get_input_type(size_t port_num) const override {
+        throw block_error("input port too high");
+    }
+
+    DataType get_output_type(size_t port_num) const override {
+        if (port_num < 1) {
+            return DT;
+        } else {
+            throw block_error("output port too high");
+        }
+    }
+
+    std::string get_input_name(size_t port_num) const override {
+        throw block_error("input port too high");
+    }
+
+    std::string get_output_name(size_t port_num) const override {
+        if (port_num == 0) {
+            return "value";
+        } else {
+            throw block_error("output port too high");
+        }
+    }
+
+    size_t get_state_size() const noexcept override {
+        return sizeof(s_out) + sizeof(origin_time) + sizeof(step_count);
+    }
+
+    void save_state(void* data) const noexcept override {
+        write_state_values(data, s_out, origin_time, step_count);
+    }
+
+    void load_state(const void* data) noexcept override {
+        read_state_values(data, s_out, origin_time, step_count);
+    }
+
+    std::string get_parameters() const override {
+        return parameter_to_string<DT>(slope) + ", " + parameter_to_string<DT>(start_time) + ", " + parameter_to_string<DT>(initial) + ", " + parameter_to_string<DT>(time_step);
+    }
+
+protected:
+    std::string get_class_name() const override {
+        std::ostringstream oss;
+        oss << "ramp_block<" << datatype_to_string(DT) << '>';
+        return oss.str();
+    }
+
+public:
+    std::string get_block_name() const override {
+        return BLK_NAME_RAMP;
+    }
+
+    std::unique_ptr<block_interface> clone() const override {
+        auto blk = std::make_unique<ramp_block>(time_step);
+        blk->slope = slope;
+        blk->start_time = start_time;
+        blk->initial = initial;
+        blk->s_out = s_out;
+        blk->origin_time = origin_time;
+        blk->step_count = step_count;
+        return blk;
+    }
+#endif
+
+protected:
+    void update_output() noexcept {
+        const data_t elapsed = origin_time + static_cast<data_t>(step_count) * time_step - start_time;
+        s_out.value = initial + slope * std::max(elapsed, data_t(0));
+    }
+
+    data_t origin_time;
+    uint64_t step_count;
+};
+
+// Generates a linear frequency sweep. The phase increment itself grows by a constant angle each step, so both the phase
+// and the increment are tracked as rotating phasors. After sweep_time the frequency is held at end_frequency. When the
+// step size changes, the increment is restarted from the frequency at the sweep time reached so far.
+template <DataType DT>
+struct chirp_block MT_COMPAT_SUBCLASS {
+    using data_t = typename type_info<DT>::type_t;
+
+    struct output_t {
+        data_t value;
+    };
+
+    explicit chirp_block(const data_t dt, const data_t start_frequency = 1, const data_t end_frequency = 10, const data_t sweep_time = 1, const data_t amplitude = 1) : s_out{}, start_frequency{start_frequency}, end_frequency{end_frequency}, sweep_time{sweep_time}, amplitude{amplitude}, time_step{dt}, phase_osc{}, increment_osc{}, sweep_origin{0}, origin_count{0}, sweep_steps{0}, step_count{0} {
+        static_assert(type_info<DT>::is_float, "data type must be a float");
+    }
+
+    chirp_block(const chirp_block&) = delete;
+    chirp_block& operator=(const chirp_block&) = delete;
+
+    void reset() noexcept MT_COMPAT_OVERRIDE {
+        phase_osc.set(0, 0);
+        step_count = 0;
+        start_sweep(0);
+        s_out.value = 0;
+    }
+
+    void step() noexcept MT_COMPAT_OVERRIDE {
+        phase_osc.rotate(increment_osc.cos_value, increment_osc.sin_value);
+        if (step_count < sweep_steps) {
+            increment_osc.advance();
+            step_count += 1;
+        }
+
+        s_out.value = amplitude * phase_osc.sin_value;
+    }
+
+    // Fills values with the outputs of the following steps, equivalent to calling step for each. Both phasors are
+    // advanced in local copies and written back once at the end.
+    void generate(data_t* values, const size_t num) noexcept {
+        rotation_oscillator<data_t> phase_local = phase_osc;
+        rotation_oscillator<data_t> increment_local = increment_osc;
+        uint64_t count = step_count;
+        for (size_t i = 0; i < num; ++i) {
+            phase_local.rotate(increment_local.cos_value, increment_local.sin_value);
+            if (count < sweep_steps) {
+                increment_local.advance();
+                count += 1;
+            }
+
+            values[i] = amplitude * phase_local.sin_value;
+        }
+
+        if (num > 0) {
+            phase_osc = phase_local;
+            increment_osc = increment_local;
+            step_count = count;
+            s_out.value = values[num - 1];
+        }
+    }
+
+    output_t s_out;
+
+    data_t start_frequency;
+    data_t end_frequency;
+    data_t sweep_time;
+    data_t amplitude;
+    data_t time_step;
+
+#ifdef MTEA_USE_FULL_LIB
+    explicit chirp_block(const Argument* dt) : chirp_block(get_model_value<DT>(dt)) {}
+
+    void set_time_step(double dt) noexcept override {
+        const data_t new_step = static_cast<data_t>(dt);
+        if (new_step != time_step) {
+            const data_t elapsed = step_count < sweep_steps ? sweep_origin + static_cast<data_t>(step_count - origin_count) * time_step : sweep_time;
+            time_step = new_step;
+            start_sweep(elapsed);
+        }
+    }
+
+    using type_info_t = generator_block_types;
+    block_types get_supported_types() const noexcept override {
+        return block_types{
+            .uses_integral = type_info_t::uses_integral,
+            .uses_float = type_info_t::uses_float,
+            .uses_logical = type_info_t::uses_logical,
+        };
+    }
+
+    DataType get_current_type() const noexcept override {
+        return DT;
+    }
+
+    void set_input(size_t port_num, const Argument* value) override {
+        throw block_error("input port too high");
+    }
+
+    void get_output(size_t port_num, Argument* value) const override {
+        if (port_num == 0) {
+            get_output_value<DT>(s_out.value, value);
+        } else {
+            throw block_error("output port too high");
+        }
+    }
+
+    size_t get_input_num() const noexcept override {
+        return 0;
+    }
+
+    bool get_input_type_settable(size_t port_num) const noexcept override {
+        return false;
+    }
+
+    size_t get_output_num() const noexcept override {
+        return 1;
+    }
+
+    DataType get_input_type(size_t port_num) const override {
+        throw block_error("input port too high");
+    }
+
+    DataType get_output_type(size_t port_num) const override {
+        if (port_num < 1) {
+            return DT;
+        } else {
+            throw block_error("output port too high");
+        }
+    }
+
+    std::string get_input_name(size_t port_num) const override {
+        throw block_error("input port too high");
+    }
+
+    std::string get_output_name(size_t port_num) const override {
+        if (port_num == 0) {
+            return "value";
+        } else {
+            throw block_error("output port too high");
+        }
+    }
+
+    size_t get_state_size() const noexcept override {
+        return sizeof(s_out) + sizeof(phase_osc) + sizeof(increment_osc) + sizeof(sweep_origin) + sizeof(origin_count) + sizeof(sweep_steps) + sizeof(step_count);
+    }
+
+    void save_state(void* data) const noexcept override {
+        write_state_values(data, s_out, phase_osc, increment_osc, sweep_origin, origin_count, sweep_steps, step_count);
+    }
+
+    void load_state(const void* data) noexcept override {
+        read_state_values(data, s_out, phase_osc, increment_osc, sweep_origin, origin_count, sweep_steps, step_count);
+    }
+
+    std::string get_parameters() const override {
+        return parameter_to_string<DT>(start_frequency) + ", " + parameter_to_string<DT>(end_frequency) + ", " + parameter_to_string<DT>(sweep_time) + ", " + parameter_to_string<DT>(amplitude) + ", " + parameter_to_string<DT>(time_step);
+    }
+
+protected:
+    std::string get_class_name() const override {
+        std::ostringstream oss;
+        oss << "chirp_block<" << datatype_to_string(DT) << '>';
+        return oss.str();
+    }
+
+public:
+    std::string get_block_name() const override {
+        return BLK_NAME_CHIRP;
+    }
+
+    std::unique_ptr<block_interface> clone() const override {
+        auto blk = std::make_unique<chirp_block>(time_step);
+        blk->start_frequency = start_frequency;
+        blk->end_frequency = end_frequency;
+        blk->sweep_time = sweep_time;
+        blk->amplitude = amplitude;
+        blk->s_out = s_out;
+        blk->phase_osc = phase_osc;
+        blk->increment_osc = increment_osc;
+        blk->sweep_origin = sweep_origin;
+        blk->origin_count = origin_count;
+        blk->sweep_steps = sweep_steps;
+        blk->step_count = step_count;
+        return blk;
+    }
+#endif
+
+protected:
+    // Sets the phase increment for the following steps from the sweep time elapsed at the current step count
+    void start_sweep(const data_t elapsed) noexcept {
+        const data_t rate = sweep_time > 0 ? (end_frequency - start_frequency) / sweep_time : data_t(0);
+        const data_t two_pi = 2 * t_pi<data_t>();
+        const data_t dt = time_step;
+
+        if (elapsed < sweep_time) {
+            const data_t frequency = start_frequency + rate * elapsed;
+            increment_osc.set(two_pi * (frequency * dt + rate * dt * dt / 2), two_pi * rate * dt * dt);
+            sweep_steps = step_count + (dt > 0 ? static_cast<uint64_t>((sweep_time - elapsed) / dt) : 0);
+        } else {
+            increment_osc.set(two_pi * (start_frequency + rate * sweep_time) * dt, 0);
+            sweep_steps = step_count;
+        }
+
+        sweep_origin = elapsed;
+        origin_count = step_count;
+    }
+
+    rotation_oscillator<data_t> phase_osc;
+    rotation_oscillator<data_t> increment_osc;
+    data_t sweep_origin;
+    uint64_t origin_count;
+    uint64_t sweep_steps;
+    uint64_t step_count;
+};
+
+// Generates many independent sine waves, with each phasor component held in a separate array such that the rotation
+// loop has no dependencies between channels
+template <DataType DT>
+struct sine_bank_block_dynamic MT_COMPAT_SUBCLASS {
+    using data_t = typename type_info<DT>::type_t;
+
+    struct output_t {
+        data_t* values;
+        size_t size;
+    };
+
+    sine_bank_block_dynamic() : s_out{nullptr, 0}, frequencies{nullptr}, amplitudes{nullptr}, phases{nullptr}, time_step{1}, cos_values{nullptr}, sin_values{nullptr}, rotation_cos{nullptr}, rotation_sin{nullptr}, count{0} {
+        static_assert(type_info<DT>::is_float, "data type must be a float");
+    }
+
+    sine_bank_block_dynamic(const sine_bank_block_dynamic&) = delete;
+    sine_bank_block_dynamic& operator=(const sine_bank_block_dynamic&) = delete;
+
+    void reset() noexcept MT_COMPAT_OVERRIDE {
+        for (size_t i = 0; i < s_out.size; ++i) {
+            cos_values[i] = t_cos(phases[i]);
+            sin_values[i] = t_sin(phases[i]);
+            s_out.values[i] = amplitudes[i] * sin_values[i];
+        }
+
+        update_rotation();
+        count = 0;
+    }
+
+    void step() noexcept MT_COMPAT_OVERRIDE {
+        for (size_t i = 0; i < s_out.size; ++i) {
+            const data_t c = cos_values[i] * rotation_cos[i] - sin_values[i] * rotation_sin[i];
+            const data_t s = sin_values[i] * rotation_cos[i] + cos_values[i] * rotation_sin[i];
+            cos_values[i] = c;
+            sin_values[i] = s;
+        }
+
+        if (++count == rotation_oscillator<data_t>::RENORMALIZE_INTERVAL) {
+            for (size_t i = 0; i < s_out.size; ++i) {
+                const data_t gain = (data_t(3) - (cos_values[i] * cos_values[i] + sin_values[i] * sin_values[i])) / data_t(2);
+                cos_values[i] *= gain;
+                sin_values[i] *= gain;
+            }
+
+            count = 0;
+        }
+
+        for (size_t i = 0; i < s_out.size; ++i) {
+            s_out.values[i] = amplitudes[i] * sin_values[i];
+        }
+    }
+
+    output_t s_out;
+
+    data_t* frequencies;
+    data_t* amplitudes;
+    data_t* phases;
+    data_t time_step;
+
+#ifdef MTEA_USE_FULL_LIB
+    void set_time_step(double dt) noexcept override {
+        const data_t new_step = static_cast<data_t>(dt);
+        if (new_step != time_step) {
+            time_step = new_step;
+            update_rotation();
+        }
+    }
+
+    using type_info_t = generator_block_types;
+    block_types get_supported_types() const noexcept override {
+        return block_types{
+            .uses_integral = type_info_t::uses_integral,
+            .uses_float = type_info_t::uses_float,
+            .uses_logical = type_info_t::uses_logical,
+        };
+    }
+
+    DataType get_current_type() const noexcept override {
+        return DT;
+    }
+
+    void set_input(size_t port_num, const Argument* value) override {
+        throw block_error("input port too high");
+    }
+
+    void get_output(size_t port_num, Argument* value) const override {
+        if (port_num < s_out.size) {
+            get_output_value<DT>(s_out.values[port_num], value);
+        } else {
+            throw block_error("output port too high");
+        }
+    }
+
+    size_t get_input_num() const noexcept override {
+        return 0;
+    }
+
+    bool get_input_type_settable(size_t port_num) const noexcept override {
+        return false;
+    }
+
+    size_t get_output_num() const noexcept override {
+        return s_out.size;
+    }
+
+    DataType get_input_type(size_t port_num) const override {
+        throw block_error("input port too high");
+    }
+
+    DataType get_output_type(size_t port_num) const override {
+        if (port_num < s_out.size) {
+            return DT;
+        } else {
+            throw block_error("output port too high");
+        }
+    }
+
+    std::string get_input_name(size_t port_num) const override {
+        throw block_error("input port too high");
+    }
+
+    std::string get_output_name(size_t port_num) const override {
+        if (port_num < s_out.size) {
+            return (std::ostringstream() << "values[" << port_num << "]").str();
+        } else {
+            throw block_error("output port too high");
+        }
+    }
+
+    size_t get_state_size() const noexcept override {
+        return 5 * s_out.size * sizeof(data_t) + sizeof(count);
+    }
+
+    void save_state(void* data) const noexcept override {
+        const size_t size = s_out.size * sizeof(data_t);
+        auto* ptr = static_cast<unsigned char*>(data);
+        std::memcpy(ptr, s_out.values, size);
+        std::memcpy(ptr + size, cos_values, size);
+        std::memcpy(ptr + 2 * size, sin_values, size);
+        std::memcpy(ptr + 3 * size, rotation_cos, size);
+        std::memcpy(ptr + 4 * size, rotation_sin, size);
+        write_state_values(ptr + 5 * size, count);
+    }
+
+    void load_state(const void* data) noexcept override {
+        const size_t size = s_out.size * sizeof(data_t);
+        const auto* ptr = static_cast<const unsigned char*>(data);
+        std::memcpy(s_out.values, ptr, size);
+        std::memcpy(cos_values, ptr + size, size);
+        std::memcpy(sin_values, ptr + 2 * size, size);
+        std::memcpy(rotation_cos, ptr + 3 * size, size);
+        std::memcpy(rotation_sin, ptr + 4 * size, size);
+        read_state_values(ptr + 5 * size, count);
+    }
+
+    std::string get_parameters() const override {
+        return parameter_to_string<DT>(time_step);
+    }
+
+protected:
+    std::string get_class_name() const override {
+        std::ostringstream oss;
+        oss << "sine_bank_block_dynamic<" << datatype_to_string(DT) << '>';
+        return oss.str();
+    }
+
+    std::string get_class_name_codegen() const override {
+        std::ostringstream oss;
+        oss << "sine_bank_block<" << datatype_to_string(DT) << ", " << s_out.size << '>';
+        return oss.str();
+    }
+
+public:
+    std::string get_block_name() const override {
+        return BLK_NAME_SINE_BANK;
+    }
+#endif
+
+protected:
+    void update_rotation() noexcept {
+        const data_t two_pi = 2 * t_pi<data_t>();
+        for (size_t i = 0; i < s_out.size; ++i) {
+            rotation_cos[i] = t_cos(two_pi * frequencies[i] * time_step);
+            rotation_sin[i] = t_sin(two_pi * frequencies[i] * time_step);
+        }
+    }
+
+    void copy_from(const sine_bank_block_dynamic& other) noexcept {
+        const size_t n = s_out.size;
+        std::copy(other.s_out.values, other.s_out.values + n, s_out.values);
+        std::copy(other.frequencies, other.frequencies + n, frequencies);
+        std::copy(other.amplitudes, other.amplitudes + n, amplitudes);
+        std::copy(other.phases, other.phases + n, phases);
+        std::copy(other.cos_values, other.cos_values + n, cos_values);
+        std::copy(other.sin_values, other.sin_values + n, sin_values);
+        std::copy(other.rotation_cos, other.rotation_cos + n, rotation_cos);
+        std::copy(other.rotation_sin, other.rotation_sin + n, rotation_sin);
+
+        time_step = other.time_step;
+        count = other.count;
+    }
+
+    data_t* cos_values;
+    data_t* sin_values;
+    data_t* rotation_cos;
+    data_t* rotation_sin;
+    uint32_t count;
+};
+
+template <DataType DT, size_t SIZE>
+struct sine_bank_block : public sine_bank_block_dynamic<DT> {
+    using data_t = typename type_info<DT>::type_t;
+
+    explicit sine_bank_block(const data_t dt = 1) : _value_array{}, _frequency_array{}, _amplitude_array{}, _phase_array{}, _cos_array{}, _sin_array{}, _rotation_cos_array{}, _rotation_sin_array{} {
+        static_assert(SIZE > 0, "bank must contain at least one generator");
+        _frequency_array.fill(1);
+        _amplitude_array.fill(1);
+
+        this->time_step = dt;
+        this->s_out.values = _value_array.data();
+        this->s_out.size = SIZE;
+        this->frequencies = _frequency_array.data();
+        this->amplitudes = _amplitude_array.data();
+        this->phases = _phase_array.data();
+        this->cos_values = _cos_array.data();
+        this->sin_values = _sin_array.data();
+        this->rotation_cos = _rotation_cos_array.data();
+        this->rotation_sin = _rotation_sin_array.data();
+    }
+
+    sine_bank_block(const sine_bank_block&) = delete;
+    sine_bank_block& operator=(const sine_bank_block&) = delete;
+
+#ifdef MTEA_USE_FULL_LIB
+protected:
+    std::string get_class_name() const override {
+        std::ostringstream oss;
+        oss << "sine_bank_block<" << datatype_to_string(DT) << ", " << SIZE << '>';
+        return oss.str();
+    }
+
+public:
+    std::unique_ptr<block_interface> clone() const override {
+        auto blk = std::make_unique<sine_bank_block>();
+        blk->copy_from(*this);
+        return blk;
+    }
+#endif
+
+private:
+    std::array<data_t, SIZE> _value_array;
+    std::array<data_t, SIZE> _frequency_array;
+    std::array<data_t, SIZE> _amplitude_array;
+    std::array<data_t, SIZE> _phase_array;
+    std::array<data_t, SIZE> _cos_array;
+    std::array<data_t, SIZE> _sin_array;
+    std::array<data_t, SIZE> _rotation_cos_array;
+    std::array<data_t, SIZE> _rotation_sin_array;
+};
+
+// Philox4x32-10 counter-based generator, mapping a 128-bit counter and 64-bit key to four random words
+inline std::array<uint32_t, 4> philox4x32(std::array<uint32_t, 4> counter, std::array<uint32_t, 2> key) noexcept {
+    for (size_t round = 0; round < 10; ++round) {
+        if (round > 0) {
+            key[0] += 0x9E3779B9u;
+            key[1] += 0xBB67AE85u;
+        }
+
+        const uint64_t p0 = uint64_t(0xD2511F53u) * counter[0];
+        const uint64_t p1 = uint64_t(0xCD9E8D57u) * counter[2];
+
+        counter = {
+            static_cast<uint32_t>(p1 >> 32) ^ counter[1] ^ key[0],
+            static_cast<uint32_t>(p1),
+            static_cast<uint32_t>(p0 >> 32) ^ counter[3] ^ key[1],
+            static_cast<uint32_t>(p0),
+        };
+    }
+
+    return counter;
+}
+
+// Provides the random words for a step of a stream. As each value depends only on the seed, instance, and step index,
+// streams are reproducible regardless of the order or thread in which steps are evaluated.
+inline std::array<uint32_t, 4> random_words(const uint64_t seed, const uint64_t instance, const uint64_t step) noexcept {
+    return philox4x32(
+        {static_cast<uint32_t>(step), static_cast<uint32_t>(step >> 32), static_cast<uint32_t>(instance), static_cast<uint32_t>(instance >> 32)},
+        {static_cast<uint32_t>(seed), static_cast<uint32_t>(seed >> 32)});
+}
+
+template <typename T>
+T random_unit(const uint32_t hi, const uint32_t, std::true_type) noexcept {
+    return static_cast<T>(hi >> 8) * (T(1) / T(1 << 24));
+}
+
+template <typename T>
+T random_unit(const uint32_t hi, const uint32_t lo, std::false_type) noexcept {
+    const uint64_t bits = (uint64_t(hi) << 32) | lo;
+    return static_cast<T>(bits >> 11) * (T(1) / T(uint64_t(1) << 53));
+}
+
+// Converts random words to a value in [0, 1) with the full precision of the type
+template <typename T>
+T random_unit(const uint32_t hi, const uint32_t lo) noexcept {
+    return random_unit<T>(hi, lo, std::integral_constant<bool, sizeof(T) <= sizeof(uint32_t)>{});
+}
+
+#ifdef MTEA_USE_FULL_LIB
+struct noise_block_types {
+    static constexpr bool uses_integral = false;
+    static constexpr bool uses_float = true;
+    static constexpr bool uses_logical = false;
+};
+#endif // MTEA_USE_FULL_LIB
+
+template <DataType DT>
+struct uniform_noise_block MT_COMPAT_SUBCLASS {
+    using data_t = typename type_info<DT>::type_t;
+
+    struct output_t {
+        data_t value;
+    };
+
+    explicit uniform_noise_block(const uint64_t seed = 0, const uint64_t instance = 0, const data_t lower = 0, const data_t upper = 1) : s_out{}, seed{seed}, instance{instance}, lower{lower}, upper{upper}, step_index{0} {
+        static_assert(type_info<DT>::is_float, "data type must be a float");
+    }
+
+    uniform_noise_block(const uniform_noise_block&) = delete;
+    uniform_noise_block& operator=(const uniform_noise_block&) = delete;
+
+    void reset() noexcept MT_COMPAT_OVERRIDE {
+        seek(0);
+    }
+
+    void step() noexcept MT_COMPAT_OVERRIDE {
+        step_index += 1;
+        s_out.value = sample(step_index);
+    }
+
+    // Fills values with the samples of the following steps, equivalent to calling step for each. Samples are independent
+    // of each other, such that the loop carries no dependencies between iterations.
+    void generate(data_t* values, const size_t num) noexcept {
+        const uint64_t start = step_index + 1;
+        for (size_t i = 0; i < num; ++i) {
+            values[i] = sample(start + i);
+        }
+
+        if (num > 0) {
+            step_index += num;
+            s_out.value = values[num - 1];
+        }
+    }
+
+    void seek(const uint64_t index) noexcept {
+        step_index = index;
+        s_out.value = sample(step_index);
+    }
+
+    uint64_t get_step_index() const noexcept {
+        return step_index;
+    }
+
+    data_t sample(const uint64_t index) const noexcept {
+        const auto words = random_words(seed, instance, index);
+        return lower + (upper - lower) * random_unit<data_t>(words[0], words[1]);
+    }
+
+    output_t s_out;
+
+    uint64_t seed;
+    uint64_t instance;
+    data_t lower;
+    data_t upper;
+
+#ifdef MTEA_USE_FULL_LIB
+    using type_info_t = noise_block_types;
+    block_types get_supported_types() const noexcept override {
+        return block_types{
+            .uses_integral = type_info_t::uses_integral,
+            .uses_float = type_info_t::uses_float,
+            .uses_logical = type_info_t::uses_logical,
+        };
+    }
+
+    DataType get_current_type() const noexcept override {
+        return DT;
+    }
+
+    void set_input(size_t port_num, const Argument* value) override {
+        throw block_error("input port too high");
+    }
+
+    void get_output(size_t port_num, Argument* value) const override {
+        if (port_num == 0) {
+            get_output_value<DT>(s_out.value, value);
+        } else {
+            throw block_error("output port too high");
+        }
+    }
+
+    size_t get_input_num() const noexcept override {
+        return 0;
+    }
+
+    bool get_input_type_settable(size_t port_num) const noexcept override {
+        return false;
+    }
+
+    size_t get_output_num() const noexcept override {
+        return 1;
+    }
+
+    DataType get_input_type(size_t port_num) const override {
+        throw block_error("input port too high");
+    }
+
+    DataType get_output_type(size_t port_num) const override {
+        if (port_num < 1) {
+            return DT;
+        } else {
+            throw block_error("output port too high");
+        }
+    }
+
+    std::string get_input_name(size_t port_num) const override {
+        throw block_error("input port too high");
+    }
+
+    std::string get_output_name(size_t port_num) const override {
+        if (port_num == 0) {
+            return "value";
+        } else {
+            throw block_error("output port too high");
+        }
+    }
+
+    size_t get_state_size() const noexcept override {
+        return sizeof(s_out) + sizeof(step_index);
+    }
+
+    void save_state(void* data) const noexcept override {
+        write_state_values(data, s_out, step_index);
+    }
+
+    void load_state(const void* data) noexcept override {
+        read_state_values(data, s_out, step_index);
+    }
+
+    void set_instance(const uint64_t id) noexcept override {
+        instance = id;
+        s_out.value = sample(step_index);
+    }
+
+    std::string get_parameters() const override {
+        return std::to_string(seed) + ", " + std::to_string(instance) + ", " + parameter_to_string<DT>(lower) + ", " + parameter_to_string<DT>(upper);
+    }
+
+protected:
+    std::string get_class_name() const override {
+        std::ostringstream oss;
+        oss << "uniform_noise_block<" << datatype_to_string(DT) << '>';
+        return oss.str();
+    }
+
+public:
+    std::string get_block_name() const override {
+        return BLK_NAME_UNIFORM_NOISE;
+    }
+
+    std::unique_ptr<block_interface> clone() const override {
+        auto blk = std::make_unique<uniform_noise_block>();
+        blk->seed = seed;
+        blk->instance = instance;
+        blk->lower = lower;
+        blk->upper = upper;
+        blk->s_out = s_out;
+        blk->step_index = step_index;
+        return blk;
+    }
+#endif
+
+protected:
+    uint64_t step_index;
+};
+
+// Generates normally distributed samples with the Box-Muller transform of two uniform values drawn for each step
+template <DataType DT>
+struct gaussian_noise_block MT_COMPAT_SUBCLASS {
+    using data_t = typename type_info<DT>::type_t;
+
+    struct output_t {
+        data_t value;
+    };
+
+    explicit gaussian_noise_block(const uint64_t seed = 0, const uint64_t instance = 0, const data_t mean = 0, const data_t deviation = 1) : s_out{}, seed{seed}, instance{instance}, mean{mean}, deviation{deviation}, step_index{0} {
+        static_assert(type_info<DT>::is_float, "data type must be a float");
+    }
+
+    gaussian_noise_block(const gaussian_noise_block&) = delete;
+    gaussian_noise_block& operator=(const gaussian_noise_block&) = delete;
+
+    void reset() noexcept MT_COMPAT_OVERRIDE {
+        seek(0);
+    }
+
+    void step() noexcept MT_COMPAT_OVERRIDE {
+        step_index += 1;
+        s_out.value = sample(step_index);
+    }
+
+    // Fills values with the samples of the following steps, equivalent to calling step for each. Samples are independent
+    // of each other, such that the loop carries no dependencies between iterations.
+    void generate(data_t* values, const size_t num) noexcept {
+        const uint64_t start = step_index + 1;
+        for (size_t i = 0; i < num; ++i) {
+            values[i] = sample(start + i);
+        }
+
+        if (num > 0) {
+            step_index += num;
+            s_out.value = values[num - 1];
+        }
+    }
+
+    void seek(const uint64_t index) noexcept {
+        step_index = index;
+        s_out.value = sample(step_index);
+    }
+
+    uint64_t get_step_index() const noexcept {
+        return step_index;
+    }
+
+    data_t sample(const uint64_t index) const noexcept {
+        const auto words = random_words(seed, instance, index);
+        const data_t u1 = data_t(1) - random_unit<data_t>(words[0], words[1]);
+        const data_t u2 = random_unit<data_t>(words[2], words[3]);
+        return mean + deviation * t_sqrt(data_t(-2) * t_log(u1)) * t_cos(2 * t_pi<data_t>() * u2);
+    }
+
+    output_t s_out;
+
+    uint64_t seed;
+    uint64_t instance;
+    data_t mean;
+    data_t deviation;
+
+#ifdef MTEA_USE_FULL_LIB
+    using type_info_t = noise_block_types;
+    block_types get_supported_types() const noexcept override {
+        return block_types{
+            .uses_integral = type_info_t::uses_integral,
+            .uses_float = type_info_t::uses_float,
+            .uses_logical = type_info_t::uses_logical,
+        };
+    }
+
+    DataType get_current_type() const noexcept override {
+        return DT;
+    }
+
+    void set_input(size_t port_num, const Argument* value) override {
+        throw block_error("input port too high");
+    }
+
+    void get_output(size_t port_num, Argument* value) const override {
+        if (port_num == 0) {
+            get_output_value<DT>(s_out.value, value);
+        } else {
+            throw block_error("output port too high");
+        }
+    }
+
+    size_t get_input_num() const noexcept override {
+        return 0;
+    }
+
+    bool get_input_type_settable(size_t port_num) const noexcept override {
+        return false;
+    }
+
+    size_t get_output_num() const noexcept override {
+        return 1;
+    }
+
+    DataType get_input_type(size_t port_num) const override {
+        throw block_error("input port too high");
+    }
+
+    DataType get_output_type(size_t port_num) const override {
+        if (port_num < 1) {
+            return DT;
+        } else {
+            throw block_error("output port too high");
+        }
+    }
+
+    std::string get_input_name(size_t port_num) const override {
+        throw block_error("input port too high");
+    }
+
+    std::string get_output_name(size_t port_num) const override {
+        if (port_num == 0) {
+            return "value";
+        } else {
+            throw block_error("output port too high");
+        }
+    }
+
+    size_t get_state_size() const noexcept override {
+        return sizeof(s_out) + sizeof(step_index);
+    }
+
+    void save_state(void* data) const noexcept override {
+        write_state_values(data, s_out, step_index);
+    }
+
+    void load_state(const void* data) noexcept override {
+        read_state_values(data, s_out, step_index);
+    }
+
+    void set_instance(const uint64_t id) noexcept override {
+        instance = id;
+        s_out.value = sample(step_index);
+    }
+
+    std::string get_parameters() const override {
+        return std::to_string(seed) + ", " + std::to_string(instance) + ", " + parameter_to_string<DT>(mean) + ", " + parameter_to_string<DT>(deviation);
+    }
+
+protected:
+    std::string get_class_name() const override {
+        std::ostringstream oss;
+        oss << "gaussian_noise_block<" << datatype_to_string(DT) << '>';
+        return oss.str();
+    }
+
+public:
+    std::string get_block_name() const override {
+        return BLK_NAME_GAUSSIAN_NOISE;
+    }
+
+    std::unique_ptr<block_interface> clone() const override {
+        auto blk = std::make_unique<gaussian_noise_block>();
+        blk->seed = seed;
+        blk->instance = instance;
+        blk->mean = mean;
+        blk->deviation = deviation;
+        blk->s_out = s_out;
+        blk->step_index = step_index;
+        return blk;
+    }
+#endif
+
+protected:
+    uint64_t step_index;
+};
+
+#ifdef MTEA_USE_FULL_LIB
+struct statistics_block_types {
+    static constexpr bool uses_integral = true;
+    static constexpr bool uses_float = true;
+    static constexpr bool uses_logical = false;
+};
+#endif // MTEA_USE_FULL_LIB
+
+// Statistics of integer signals are provided as double values, while float signals keep their own precision
+template <DataType DT>
+struct statistics_type {
+    static constexpr DataType data_type = type_info<DT>::is_float ? DT : DataType::F64;
+    using type_t = typename type_info<data_type>::type_t;
+};
+
+// Tracks the mean and sample variance with Welford's algorithm, along with the minimum, maximum, and root mean square of
+// all values since the last reset
+template <DataType DT>
+struct running_stats_block MT_COMPAT_SUBCLASS {
+    using data_t = typename type_info<DT>::type_t;
+    using stat_t = typename statistics_type<DT>::type_t;
+
+    struct input_t {
+        data_t value;
+        bool reset_flag;
+    };
+
+    struct output_t {
+        stat_t mean;
+        stat_t variance;
+        data_t min;
+        data_t max;
+        stat_t rms;
+    };
+
+    running_stats_block() : s_in{}, s_out{}, count{0}, m2{0}, mean_sq{0} {
+        static_assert(type_info<DT>::is_numeric, "data type must be numeric");
+    }
+
+    running_stats_block(const running_stats_block&) = delete;
+    running_stats_block& operator=(const running_stats_block&) = delete;
+
+    void reset() noexcept MT_COMPAT_OVERRIDE {
+        s_out = output_t{0, 0, std::numeric_limits<data_t>::max(), std::numeric_limits<data_t>::lowest(), 0};
+        count = 0;
+        m2 = 0;
+        mean_sq = 0;
+    }
+
+    void step() noexcept MT_COMPAT_OVERRIDE {
+        if (s_in.reset_flag) {
+            reset();
+        }
+
+        const stat_t x = static_cast<stat_t>(s_in.value);
+        count += 1;
+        const stat_t n = static_cast<stat_t>(count);
+
+        const stat_t delta = x - s_out.mean;
+        s_out.mean += delta / n;
+        m2 += delta * (x - s_out.mean);
+        mean_sq += (x * x - mean_sq) / n;
+
+        s_out.variance = count > 1 ? m2 / (n - 1) : stat_t(0);
+        s_out.min = std::min(s_out.min, s_in.value);
+        s_out.max = std::max(s_out.max, s_in.value);
+        s_out.rms = t_sqrt(mean_sq);
+    }
+
+    uint64_t get_count() const noexcept {
+        return count;
+    }
+
+    input_t s_in;
+    output_t s_out;
+
+#ifdef MTEA_USE_FULL_LIB
+    static const size_t PORT_VALUE_NUM = 0;
+    static const size_t PORT_FLAG_NUM = 1;
+
+    using type_info_t = statistics_block_types;
+    block_types get_supported_types() const noexcept override {
+        return block_types{
+            .uses_integral = type_info_t::uses_integral,
+            .uses_float = type_info_t::uses_float,
+            .uses_logical = type_info_t::uses_logical,
+        };
+    }
+
+    DataType get_current_type() const noexcept override {
+        return DT;
+    }
+
+    void set_input(size_t port_num, const Argument* value) override {
+        if (port_num == PORT_VALUE_NUM) {
+            set_input_value<DT>(s_in.value, value);
+        } else if (port_num == PORT_FLAG_NUM) {
+            set_input_value<DataType::BOOL>(s_in.reset_flag, value);
+        } else {
+            throw block_error("input port too high");
+        }
+    }
+
+    void get_output(size_t port_num, Argument* value) const override {
+        constexpr auto ST = statistics_type<DT>::data_type;
+
+        if (port_num == 0) {
+            get_output_value<ST>(s_out.mean, value);
+        } else if (port_num == 1) {
+            get_output_value<ST>(s_out.variance, value);
+        } else if (port_num == 2) {
+            get_output_value<DT>(s_out.min, value);
+        } else if (port_num == 3) {
+            get_output_value<DT>(s_out.max, value);
+        } else if (port_num == 4) {
+            get_output_value<ST>(s_out.rms, value);
+        } else {
+            throw block_error("output port too high");
+        }
+    }
+
+    size_t get_input_num() const noexcept override {
+        return 2;
+    }
+
+    bool get_input_type_settable(size_t port_num) const noexcept override {
+        return port_num == PORT_VALUE_NUM;
+    }
+
+    size_t get_output_num() const noexcept override {
+        return 5;
+    }
+
+    DataType get_input_type(size_t port_num) const override {
+        if (port_num == PORT_VALUE_NUM) {
+            return DT;
+        } else if (port_num == PORT_FLAG_NUM) {
+            return DataType::BOOL;
+        } else {
+            throw block_error("input port too high");
+        }
+    }
+
+    DataType get_output_type(size_t port_num) const override {
+        if (port_num == 2 || port_num == 3) {
+            return DT;
+        } else if (port_num < 5) {
+            return statistics_type<DT>::data_type;
+        } else {
+            throw block_error("output port too high");
+        }
+    }
+
+    std::string get_input_name(size_t port_num) const override {
+        if (port_num == PORT_VALUE_NUM) {
+            return "value";
+        } else if (port_num == PORT_FLAG_NUM) {
+            return "reset_flag";
+        } else {
+            throw block_error("input port too high");
+        }
+    }
+
+    std::string get_output_name(size_t port_num) const override {
+        if (port_num == 0) {
+            return "mean";
+        } else if (port_num == 1) {
+            return "variance";
+        } else if (port_num == 2) {
+            return "min";
+        } else if (port_num == 3) {
+            return "max";
+        } else if (port_num == 4) {
+            return "rms";
+        } else {
+            throw block_error("output port too high");
+        }
+    }
+
+    size_t get_state_size() const noexcept override {
+        return sizeof(s_out) + sizeof(count) + sizeof(m2) + sizeof(mean_sq);
+    }
+
+    void save_state(void* data) const noexcept override {
+        write_state_values(data, s_out, count, m2, mean_sq);
+    }
+
+    void load_state(const void* data) noexcept override {
+        read_state_values(data, s_out, count, m2, mean_sq);
+    }
+
+protected:
+    std::string get_class_name() const override {
+        std::ostringstream oss;
+        oss << "running_stats_block<" << datatype_to_string(DT) << '>';
+        return oss.str();
+    }
+
+public:
+    std::string get_block_name() const override {
+        return BLK_NAME_RUNNING_STATS;
+    }
+
+    std::unique_ptr<block_interface> clone() const override {
+        auto blk = std::make_unique<running_stats_block>();
+        blk->s_in = s_in;
+        blk->s_out = s_out;
+        blk->count = count;
+        blk->m2 = m2;
+        blk->mean_sq = mean_sq;
+        return blk;
+    }
+#endif
+
+protected:
+    uint64_t count;
+    stat_t m2;
+    stat_t mean_sq;
+};
+
+// Tracks the running statistics of many signals that are sampled together, sharing a single sample count
+template <DataType DT>
+struct running_stats_bank_block_dynamic MT_COMPAT_SUBCLASS {
+    using data_t = typename type_info<DT>::type_t;
+    using stat_t = typename statistics_type<DT>::type_t;
+
+    struct input_t {
+        data_t* values;
+        size_t size;
+        bool reset_flag;
+    };
+
+    struct output_t {
+        stat_t* means;
+        stat_t* variances;
+        data_t* mins;
+        data_t* maxs;
+        stat_t* rms;
+        size_t size;
+    };
+
+    static const size_t STATISTIC_NUM = 5;
+
+    running_stats_bank_block_dynamic() : s_in{nullptr, 0, false}, s_out{nullptr, nullptr, nullptr, nullptr, nullptr, 0}, count{0}, m2s{nullptr}, mean_sqs{nullptr} {
+        static_assert(type_info<DT>::is_numeric, "data type must be numeric");
+    }
+
+    running_stats_bank_block_dynamic(const running_stats_bank_block_dynamic&) = delete;
+    running_stats_bank_block_dynamic& operator=(const running_stats_bank_block_dynamic&) = delete;
+
+    void reset() noexcept MT_COMPAT_OVERRIDE {
+        const size_t n = s_out.size;
+        std::fill(s_out.means, s_out.means + n, stat_t(0));
+        std::fill(s_out.variances, s_out.variances + n, stat_t(0));
+        std::fill(s_out.mins, s_out.mins + n, std::numeric_limits<data_t>::max());
+        std::fill(s_out.maxs, s_out.maxs + n, std::numeric_limits<data_t>::lowest());
+        std::fill(s_out.rms, s_out.rms + n, stat_t(0));
+        std::fill(m2s, m2s + n, stat_t(0));
+        std::fill(mean_sqs, mean_sqs + n, stat_t(0));
+        count = 0;
+    }
+
+    void step() noexcept MT_COMPAT_OVERRIDE {
+        if (s_in.reset_flag) {
+            reset();
+        }
+
+        count += 1;
+        const stat_t inv_n = stat_t(1) / static_cast<stat_t>(count);
+        const stat_t inv_n1 = count > 1 ? stat_t(1) / static_cast<stat_t>(count - 1) : stat_t(0);
+
+        for (size_t i = 0; i < s_out.size; ++i) {
+            const stat_t x = static_cast<stat_t>(s_in.values[i]);
+            const stat_t delta = x - s_out.means[i];
+            s_out.means[i] += delta * inv_n;
+            m2s[i] += delta * (x - s_out.means[i]);
+            mean_sqs[i] += (x * x - mean_sqs[i]) * inv_n;
+
+            s_out.variances[i] = m2s[i] * inv_n1;
+            s_out.mins[i] = std::min(s_out.mins[i], s_in.values[i]);
+            s_out.maxs[i] = std::max(s_out.maxs[i], s_in.values[i]);
+        }
+
+        for (size_t i = 0; i < s_out.size; ++i) {
+            s_out.rms[i] = t_sqrt(mean_sqs[i]);
+        }
+    }
+
+    uint64_t get_count() const noexcept {
+        return count;
+    }
+
+    input_t s_in;
+    output_t s_out;
+
+#ifdef MTEA_USE_FULL_LIB
+    using type_info_t = statistics_block_types;
+    block_types get_supported_types() const noexcept override {
+        return block_types{
+            .uses_integral = type_info_t::uses_integral,
+            .uses_float = type_info_t::uses_float,
+            .uses_logical = type_info_t::uses_logical,
+        };
+    }
+
+    DataType get_current_type() const noexcept override {
+        return DT;
+    }
+
+    void set_input(size_t port_num, const Argument* value) override {
+        if (port_num < s_in.size) {
+            set_input_value<DT>(s_in.values[port_num], value);
+        } else if (port_num == s_in.size) {
+            set_input_value<DataType::BOOL>(s_in.reset_flag, value);
+        } else {
+            throw block_error("input port too high");
+        }
+    }
+
+    void get_output(size_t port_num, Argument* value) const override {
+        constexpr auto ST = statistics_type<DT>::data_type;
+        const size_t n = s_out.size;
+
+        if (port_num < n) {
+            get_output_value<ST>(s_out.means[port_num], value);
+        } else if (port_num < 2 * n) {
+            get_output_value<ST>(s_out.variances[port_num - n], value);
+        } else if (port_num < 3 * n) {
+            get_output_value<DT>(s_out.mins[port_num - 2 * n], value);
+        } else if (port_num < 4 * n) {
+            get_output_value<DT>(s_out.maxs[port_num - 3 * n], value);
+        } else if (port_num < 5 * n) {
+            get_output_value<ST>(s_out.rms[port_num - 4 * n], value);
+        } else {
+            throw block_error("output port too high");
+        }
+    }
+
+    size_t get_input_num() const noexcept override {
+        return s_in.size + 1;
+    }
+
+    bool get_input_type_settable(size_t port_num) const noexcept override {
+        return port_num < s_in.size;
+    }
+
+    size_t get_output_num() const noexcept override {
+        return STATISTIC_NUM * s_out.size;
+    }
+
+    DataType get_input_type(size_t port_num) const override {
+        if (port_num < s_in.size) {
+            return DT;
+        } else if (port_num == s_in.size) {
+            return DataType::BOOL;
+        } else {
+            throw block_error("input port too high");
+        }
+    }
+
+    DataType get_output_type(size_t port_num) const override {
+        const size_t n = s_out.size;
+
+        if (port_num >= 2 * n && port_num < 4 * n) {
+            return DT;
+        } else if (port_num < STATISTIC_NUM * n) {
+            return statistics_type<DT>::data_type;
+        } else {
+            throw block_error("output port too high");
+        }
+    }
+
+    std::string get_input_name(size_t port_num) const override {
+        if (port_num < s_in.size) {
+            return (std::ostringstream() << "values[" << port_num << "]").str();
+        } else if (port_num == s_in.size) {
+            return "reset_flag";
+        } else {
+            throw block_error("input port too high");
+        }
+    }
+
+    std::string get_output_name(size_t port_num) const override {
+        static const char* names[STATISTIC_NUM] = {"means", "variances", "mins", "maxs", "rms"};
+
+        if (port_num < STATISTIC_NUM * s_out.size) {
+            return (std::ostringstream() << names[port_num / s_out.size] << '[' << port_num % s_out.size << ']').str();
+        } else {
+            throw block_error("output port too high");
+        }
+    }
+
+    size_t get_state_size() const noexcept override {
+        return sizeof(count) + s_out.size * (5 * sizeof(stat_t) + 2 * sizeof(data_t));
+    }
+
+    void save_state(void* data) const noexcept override {
+        const size_t stat_size = s_out.size * sizeof(stat_t);
+        const size_t data_size = s_out.size * sizeof(data_t);
+
+        auto* ptr = static_cast<unsigned char*>(data);
+        write_state_values(ptr, count);
+        ptr += sizeof(count);
+
+        for (const stat_t* arr : {s_out.means, s_out.variances, s_out.rms, m2s, mean_sqs}) {
+            std::memcpy(ptr, arr, stat_size);
+            ptr += stat_size;
+        }
+
+        for (const data_t* arr : {s_out.mins, s_out.maxs}) {
+            std::memcpy(ptr, arr, data_size);
+            ptr += data_size;
+        }
+    }
 
-template <>
-struct relational_block_types<RelationalOperator::EQUAL> {
-    static constexpr bool uses_integral = true;
-    static constexpr bool uses_float = true;
-    static constexpr bool uses_logical = true;
-};
+    void load_state(const void* data) noexcept override {
+        const size_t stat_size = s_out.size * sizeof(stat_t);
+        const size_t data_size = s_out.size * sizeof(data_t);
 
-template <>
-struct relational_block_types<RelationalOperator::NOT_EQUAL> {
-    static constexpr bool uses_integral = true;
-    static constexpr bool uses_float = true;
-    static constexpr bool uses_logical = true;
-};
-#endif // MTEA_USE_FULL_LIB
+        const auto* ptr = static_cast<const unsigned char*>(data);
+        read_state_values(ptr, count);
+        ptr += sizeof(count);
 
-template <DataType DT, RelationalOperator OP>
-struct relational_block MT_COMPAT_SUBCLASS {
-    using data_t = typename type_info<DT>::type_t;
+        for (stat_t* arr : {s_out.means, s_out.variances, s_out.rms, m2s, mean_sqs}) {
+            std::memcpy(arr, ptr, stat_size);
+            ptr += stat_size;
+        }
 
-    struct input_t {
-        data_t value_a;
-        data_t value_b;
-    };
+        for (data_t* arr : {s_out.mins, s_out.maxs}) {
+            std::memcpy(arr, ptr, data_size);
+            ptr += data_size;
+        }
+    }
 
-    struct output_t {
-        bool value;
-    };
+protected:
+    std::string get_class_name() const override {
+        std::ostringstream oss;
+        oss << "running_stats_bank_block_dynamic<" << datatype_to_string(DT) << '>';
+        return oss.str();
+    }
 
-    relational_block() = default;
-    relational_block(const relational_block&) = delete;
-    relational_block& operator=(const relational_block&) = delete;
+    std::string get_class_name_codegen() const override {
+        std::ostringstream oss;
+        oss << "running_stats_bank_block<" << datatype_to_string(DT) << ", " << s_out.size << '>';
+        return oss.str();
+    }
 
-    void reset() noexcept MT_COMPAT_OVERRIDE { step(); }
+public:
+    std::string get_block_name() const override {
+        return BLK_NAME_STATS_BANK;
+    }
+#endif
 
-    void step() noexcept MT_COMPAT_OVERRIDE {
-        s_out.value = RelationalOperation<DT, OP>::operation(s_in.value_a, s_in.value_b);
+protected:
+    void copy_from(const running_stats_bank_block_dynamic& other) noexcept {
+        const size_t n = s_out.size;
+        std::copy(other.s_in.values, other.s_in.values + n, s_in.values);
+        std::copy(other.s_out.means, other.s_out.means + n, s_out.means);
+        std::copy(other.s_out.variances, other.s_out.variances + n, s_out.variances);
+        std::copy(other.s_out.mins, other.s_out.mins + n, s_out.mins);
+        std::copy(other.s_out.maxs, other.s_out.maxs + n, s_out.maxs);
+        std::copy(other.s_out.rms, other.s_out.rms + n, s_out.rms);
+        std::copy(other.m2s, other.m2s + n, m2s);
+        std::copy(other.mean_sqs, other.mean_sqs + n, mean_sqs);
+
+        s_in.reset_flag = other.s_in.reset_flag;
+        count = other.count;
+    }
+
+    uint64_t count;
+    stat_t* m2s;
+    stat_t* mean_sqs;
+};
+
+template <DataType DT, size_t SIZE>
+struct running_stats_bank_block : public running_stats_bank_block_dynamic<DT> {
+    using data_t = typename type_info<DT>::type_t;
+    using stat_t = typename statistics_type<DT>::type_t;
+
+    running_stats_bank_block() : _value_array{}, _mean_array{}, _variance_array{}, _min_array{}, _max_array{}, _rms_array{}, _m2_array{}, _mean_sq_array{} {
+        static_assert(SIZE > 0, "bank must contain at least one signal");
+        this->s_in.values = _value_array.data();
+        this->s_in.size = SIZE;
+        this->s_out.means = _mean_array.data();
+        this->s_out.variances = _variance_array.data();
+        this->s_out.mins = _min_array.data();
+        this->s_out.maxs = _max_array.data();
+        this->s_out.rms = _rms_array.data();
+        this->s_out.size = SIZE;
+        this->m2s = _m2_array.data();
+        this->mean_sqs = _mean_sq_array.data();
     }
 
+    running_stats_bank_block(const running_stats_bank_block&) = delete;
+    running_stats_bank_block& operator=(const running_stats_bank_block&) = delete;
+
 #ifdef MTEA_USE_FULL_LIB
 protected:
     std::string get_class_name() const override {
         std::ostringstream oss;
-        oss << "relational_block<" << datatype_to_string(DT) << ", " << relational_to_string(OP) << '>';
+        oss << "running_stats_bank_block<" << datatype_to_string(DT) << ", " << SIZE << '>';
         return oss.str();
     }
 
 public:
-    std::string get_block_name() const override {
-        if constexpr (OP == RelationalOperator::EQUAL) {
-            return BLK_NAME_REL_EQ;
-        } else if constexpr (OP == RelationalOperator::NOT_EQUAL) {
-            return BLK_NAME_REL_NEQ;
-        } else if constexpr (OP == RelationalOperator::GREATER_THAN) {
-            return BLK_NAME_REL_GT;
-        } else if constexpr (OP == RelationalOperator::GREATER_THAN_EQUAL) {
-            return BLK_NAME_REL_GEQ;
-        } else if constexpr (OP == RelationalOperator::LESS_THAN) {
-            return BLK_NAME_REL_LT;
-        } else if constexpr (OP == RelationalOperator::LESS_THAN_EQUAL) {
-            return BLK_NAME_REL_LEQ;
-        } else {
-            static_assert("unknown relational operation provided");
+    std::unique_ptr<block_interface> clone() const override {
+        auto blk = std::make_unique<running_stats_bank_block>();
+        blk->copy_from(*this);
+        return blk;
+    }
+#endif
+
+private:
+    std::array<data_t, SIZE> _value_array;
+    std::array<stat_t, SIZE> _mean_array;
+    std::array<stat_t, SIZE> _variance_array;
+    std::array<data_t, SIZE> _min_array;
+    std::array<data_t, SIZE> _max_array;
+    std::array<stat_t, SIZE> _rms_array;
+    std::array<stat_t, SIZE> _m2_array;
+    std::array<stat_t, SIZE> _mean_sq_array;
+};
+
+// Averages the most recent window of values, keeping a running sum over a ring buffer such that each step is constant
+// time. Integer sums are exact, while float sums are recomputed from the buffer once per window to remove the rounding
+// error accumulated by the additions and subtractions.
+template <DataType DT>
+struct moving_average_block_dynamic MT_COMPAT_SUBCLASS {
+    using data_t = typename type_info<DT>::type_t;
+    using stat_t = typename statistics_type<DT>::type_t;
+    using sum_t = typename std::conditional<type_info<DT>::is_float, data_t, typename std::conditional<type_info<DT>::is_signed, int64_t, uint64_t>::type>::type;
+
+    struct input_t {
+        data_t value;
+        bool reset_flag;
+    };
+
+    struct output_t {
+        stat_t value;
+    };
+
+    moving_average_block_dynamic() : s_in{}, s_out{}, window{nullptr}, window_size{0}, index{0}, count{0}, sum{0} {
+        static_assert(type_info<DT>::is_numeric, "data type must be numeric");
+    }
+
+    moving_average_block_dynamic(const moving_average_block_dynamic&) = delete;
+    moving_average_block_dynamic& operator=(const moving_average_block_dynamic&) = delete;
+
+    void reset() noexcept MT_COMPAT_OVERRIDE {
+        std::fill(window, window + window_size, data_t(0));
+        index = 0;
+        count = 0;
+        sum = 0;
+        s_out.value = 0;
+    }
+
+    void step() noexcept MT_COMPAT_OVERRIDE {
+        if (s_in.reset_flag) {
+            reset();
+        }
+
+        sum += static_cast<sum_t>(s_in.value);
+        sum -= static_cast<sum_t>(window[index]);
+        window[index] = s_in.value;
+
+        index += 1;
+        if (index == window_size) {
+            index = 0;
+            recompute_sum(std::integral_constant<bool, type_info<DT>::is_float>{});
         }
+
+        count += count < window_size ? 1 : 0;
+        s_out.value = static_cast<stat_t>(sum) / static_cast<stat_t>(count);
     }
 
-    using type_info_t = relational_block_types<OP>;
+    size_t get_window_size() const noexcept {
+        return window_size;
+    }
+
+    input_t s_in;
+    output_t s_out;
+
+#ifdef MTEA_USE_FULL_LIB
+    static const size_t PORT_VALUE_NUM = 0;
+    static const size_t PORT_FLAG_NUM = 1;
+
+    using type_info_t = statistics_block_types;
     block_types get_supported_types() const noexcept override {
         return block_types{
             .uses_integral = type_info_t::uses_integral,
@@ -1553,10 +7921,10 @@ public:
     }
 
     void set_input(size_t port_num, const Argument* value) override {
-        if (port_num == 0) {
-            set_input_value<DT>(s_in.value_a, value);
-        } else if (port_num == 1) {
-            set_input_value<DT>(s_in.value_b, value);
+        if (port_num == PORT_VALUE_NUM) {
+            set_input_value<DT>(s_in.value, value);
+        } else if (port_num == PORT_FLAG_NUM) {
+            set_input_value<DataType::BOOL>(s_in.reset_flag, value);
         } else {
             throw block_error("input port too high");
         }
@@ -1564,7 +7932,7 @@ public:
 
     void get_output(size_t port_num, Argument* value) const override {
         if (port_num == 0) {
-            get_output_value<DataType::BOOL>(s_out.value, value);
+            get_output_value<statistics_type<DT>::data_type>(s_out.value, value);
         } else {
             throw block_error("output port too high");
         }
@@ -1575,7 +7943,7 @@ public:
     }
 
     bool get_input_type_settable(size_t port_num) const noexcept override {
-        return port_num < get_input_num();
+        return port_num == PORT_VALUE_NUM;
     }
 
     size_t get_output_num() const noexcept override {
@@ -1583,8 +7951,10 @@ public:
     }
 
     DataType get_input_type(size_t port_num) const override {
-        if (port_num < get_input_num()) {
+        if (port_num == PORT_VALUE_NUM) {
             return DT;
+        } else if (port_num == PORT_FLAG_NUM) {
+            return DataType::BOOL;
         } else {
             throw block_error("input port too high");
         }
@@ -1592,17 +7962,17 @@ public:
 
     DataType get_output_type(size_t port_num) const override {
         if (port_num == 0) {
-            return DataType::BOOL;
+            return statistics_type<DT>::data_type;
         } else {
             throw block_error("output port too high");
         }
     }
 
     std::string get_input_name(size_t port_num) const override {
-        if (port_num == 0) {
-            return "value_a";
-        } else if (port_num == 1) {
-            return "value_b";
+        if (port_num == PORT_VALUE_NUM) {
+            return "value";
+        } else if (port_num == PORT_FLAG_NUM) {
+            return "reset_flag";
         } else {
             throw block_error("input port too high");
         }
@@ -1615,127 +7985,204 @@ public:
             throw block_error("output port too high");
         }
     }
-#endif
 
-    input_t s_in;
-    output_t s_out;
-};
+    size_t get_state_size() const noexcept override {
+        return sizeof(s_out) + sizeof(index) + sizeof(count) + sizeof(sum) + window_size * sizeof(data_t);
+    }
 
-template <TrigFunction FCN>
-struct TrigInfo {
-    static const size_t input_count = 1;
-};
+    void save_state(void* data) const noexcept override {
+        auto* ptr = static_cast<unsigned char*>(data);
+        write_state_values(ptr, s_out, index, count, sum);
+        std::memcpy(ptr + sizeof(s_out) + sizeof(index) + sizeof(count) + sizeof(sum), window, window_size * sizeof(data_t));
+    }
 
-template <>
-struct TrigInfo<TrigFunction::ATAN2> {
-    static const size_t input_count = 2;
-};
+    void load_state(const void* data) noexcept override {
+        const auto* ptr = static_cast<const unsigned char*>(data);
+        read_state_values(ptr, s_out, index, count, sum);
+        std::memcpy(window, ptr + sizeof(s_out) + sizeof(index) + sizeof(count) + sizeof(sum), window_size * sizeof(data_t));
+    }
 
-template <DataType DT, size_t N, TrigFunction FCN>
-struct TrigOperation {};
+protected:
+    std::string get_class_name() const override {
+        std::ostringstream oss;
+        oss << "moving_average_block_dynamic<" << datatype_to_string(DT) << '>';
+        return oss.str();
+    }
 
-template <DataType DT, size_t N>
-struct TrigOperation<DT, N, TrigFunction::SIN> {
-    using data_t = typename type_info<DT>::type_t;
-    static data_t operation(const data_t values[N]) {
-        static_assert(N == 1, "sin requires a single argument");
-        static_assert(type_info<DT>::is_numeric, "sin requires a numeric data type");
-        return t_sin(values[0]);
+    std::string get_class_name_codegen() const override {
+        std::ostringstream oss;
+        oss << "moving_average_block<" << datatype_to_string(DT) << ", " << window_size << '>';
+        return oss.str();
     }
-};
 
-template <DataType DT, size_t N>
-struct TrigOperation<DT, N, TrigFunction::COS> {
-    using data_t = typename type_info<DT>::type_t;
-    static data_t operation(const data_t values[N]) {
-        static_assert(N == 1, "cos requires a single argument");
-        static_assert(type_info<DT>::is_numeric, "cos requires a numeric data type");
-        return t_cos(values[0]);
+public:
+    std::string get_block_name() const override {
+        return BLK_NAME_MOVING_AVERAGE;
     }
-};
+#endif
 
-template <DataType DT, size_t N>
-struct TrigOperation<DT, N, TrigFunction::TAN> {
-    using data_t = typename type_info<DT>::type_t;
-    static data_t operation(const data_t values[N]) {
-        static_assert(N == 1, "tan requires a single argument");
-        static_assert(type_info<DT>::is_numeric, "tan requires a numeric data type");
-        return t_tan(values[0]);
+protected:
+    void recompute_sum(std::true_type) noexcept {
+        sum = 0;
+        for (size_t i = 0; i < window_size; ++i) {
+            sum += window[i];
+        }
     }
-};
 
-template <DataType DT, size_t N>
-struct TrigOperation<DT, N, TrigFunction::ASIN> {
-    using data_t = typename type_info<DT>::type_t;
-    static data_t operation(const data_t values[N]) {
-        static_assert(N == 1, "arcsin requires a single argument");
-        static_assert(type_info<DT>::is_numeric, "arcsin requires a numeric data type");
-        return t_asin(values[0]);
+    void recompute_sum(std::false_type) noexcept {}
+
+    void copy_from(const moving_average_block_dynamic& other) noexcept {
+        std::copy(other.window, other.window + window_size, window);
+        s_in = other.s_in;
+        s_out = other.s_out;
+        index = other.index;
+        count = other.count;
+        sum = other.sum;
     }
+
+    data_t* window;
+    size_t window_size;
+    size_t index;
+    size_t count;
+    sum_t sum;
 };
 
-template <DataType DT, size_t N>
-struct TrigOperation<DT, N, TrigFunction::ACOS> {
+template <DataType DT, size_t WINDOW>
+struct moving_average_block : public moving_average_block_dynamic<DT> {
     using data_t = typename type_info<DT>::type_t;
-    static data_t operation(const data_t values[N]) {
-        static_assert(N == 1, "arccos requires a single argument");
-        static_assert(type_info<DT>::is_numeric, "arccos requires a numeric data type");
-        return t_acos(values[0]);
+
+    moving_average_block() : _window_array{} {
+        static_assert(WINDOW > 0, "window must contain at least one value");
+        this->window = _window_array.data();
+        this->window_size = WINDOW;
     }
-};
 
-template <DataType DT, size_t N>
-struct TrigOperation<DT, N, TrigFunction::ATAN> {
-    using data_t = typename type_info<DT>::type_t;
-    static data_t operation(const data_t values[N]) {
-        static_assert(N == 1, "arctan requires a single argument");
-        static_assert(type_info<DT>::is_numeric, "arctan requires a numeric data type");
-        return t_atan(values[0]);
+    moving_average_block(const moving_average_block&) = delete;
+    moving_average_block& operator=(const moving_average_block&) = delete;
+
+#ifdef MTEA_USE_FULL_LIB
+protected:
+    std::string get_class_name() const override {
+        std::ostringstream oss;
+        oss << "moving_average_block<" << datatype_to_string(DT) << ", " << WINDOW << '>';
+        return oss.str();
     }
-};
 
-template <DataType DT, size_t N>
-struct TrigOperation<DT, N, TrigFunction::ATAN2> {
-    using data_t = typename type_info<DT>::type_t;
-    static data_t operation(const data_t values[N]) {
-        static_assert(N == 2, "arctan2 requires a single argument");
-        static_assert(type_info<DT>::is_numeric, "arctan2 requires a numeric data type");
-        return t_atan2(values[0], values[1]);
+public:
+    std::unique_ptr<block_interface> clone() const override {
+        auto blk = std::make_unique<moving_average_block>();
+        blk->copy_from(*this);
+        return blk;
     }
+#endif
+
+private:
+    std::array<data_t, WINDOW> _window_array;
 };
 
 #ifdef MTEA_USE_FULL_LIB
-struct trig_block_types {
-    static constexpr bool uses_integral = false;
+struct order_statistic_block_types {
+    static constexpr bool uses_integral = true;
     static constexpr bool uses_float = true;
     static constexpr bool uses_logical = false;
 };
 #endif // MTEA_USE_FULL_LIB
 
-template <DataType DT, TrigFunction FCN>
-struct trig_block MT_COMPAT_SUBCLASS {
+// Provides a percentile of the most recent window of values, such as the median, using the nearest-rank definition. The
+// window is split between a max-heap of the lower values and a min-heap of the upper values, with the output at the top
+// of the lower heap. Each heap entry refers to a ring buffer slot and each slot tracks its heap position, so the oldest
+// value is replaced in place and the heaps are repaired in O(log N) without searching. The percentile takes effect on
+// reset.
+template <DataType DT>
+struct order_statistic_block_dynamic MT_COMPAT_SUBCLASS {
     using data_t = typename type_info<DT>::type_t;
 
     struct input_t {
-        data_t values[TrigInfo<FCN>::input_count];
+        data_t value;
+        bool reset_flag;
     };
 
     struct output_t {
         data_t value;
     };
 
-    trig_block() = default;
-    trig_block(const trig_block&) = delete;
-    trig_block& operator=(const trig_block&) = delete;
+    order_statistic_block_dynamic() : s_in{}, s_out{}, percentile{0.5}, values{nullptr}, low_heap{nullptr}, high_heap{nullptr}, positions{nullptr}, in_low{nullptr}, window_size{0}, low_size{0}, high_size{0}, head{0}, count{0} {
+        static_assert(type_info<DT>::is_numeric, "data type must be numeric");
+    }
+
+    order_statistic_block_dynamic(const order_statistic_block_dynamic&) = delete;
+    order_statistic_block_dynamic& operator=(const order_statistic_block_dynamic&) = delete;
+
+    void reset() noexcept MT_COMPAT_OVERRIDE {
+        low_size = 0;
+        high_size = 0;
+        head = 0;
+        count = 0;
+        s_out.value = 0;
+    }
+
+    void step() noexcept MT_COMPAT_OVERRIDE {
+        if (s_in.reset_flag) {
+            reset();
+        }
+
+        const size_t slot = head;
+        values[slot] = s_in.value;
+        head = head + 1 == window_size ? 0 : head + 1;
+
+        if (count < window_size) {
+            count += 1;
+
+            if (low_size > 0 && s_in.value > values[low_heap[0]]) {
+                push(false, slot);
+            } else {
+                push(true, slot);
+            }
+
+            const size_t target = get_rank(count) + 1;
+            while (low_size > target) {
+                push(false, pop(true));
+            }
+
+            while (low_size < target) {
+                push(true, pop(false));
+            }
+        } else {
+            const bool low = in_low[slot];
+            sift_up(low, positions[slot]);
+            sift_down(low, positions[slot]);
+
+            if (high_size > 0 && values[low_heap[0]] > values[high_heap[0]]) {
+                const size_t a = low_heap[0];
+                const size_t b = high_heap[0];
+                place(true, 0, b);
+                place(false, 0, a);
+                sift_down(true, 0);
+                sift_down(false, 0);
+            }
+        }
+
+        s_out.value = values[low_heap[0]];
+    }
 
-    void reset() noexcept MT_COMPAT_OVERRIDE { step(); }
+    size_t get_window_size() const noexcept {
+        return window_size;
+    }
 
-    void step() noexcept MT_COMPAT_OVERRIDE {
-        s_out.value = TrigOperation<DT, TrigInfo<FCN>::input_count, FCN>::operation(s_in.values);
+    size_t get_count() const noexcept {
+        return count;
     }
 
+    input_t s_in;
+    output_t s_out;
+
+    double percentile;
+
 #ifdef MTEA_USE_FULL_LIB
-    using type_info_t = trig_block_types;
+    static const size_t PORT_VALUE_NUM = 0;
+    static const size_t PORT_FLAG_NUM = 1;
+
+    using type_info_t = order_statistic_block_types;
     block_types get_supported_types() const noexcept override {
         return block_types{
             .uses_integral = type_info_t::uses_integral,
@@ -1749,8 +8196,10 @@ struct trig_block MT_COMPAT_SUBCLASS {
     }
 
     void set_input(size_t port_num, const Argument* value) override {
-        if (port_num < get_input_num()) {
-            set_input_value<DT>(s_in.values[port_num], value);
+        if (port_num == PORT_VALUE_NUM) {
+            set_input_value<DT>(s_in.value, value);
+        } else if (port_num == PORT_FLAG_NUM) {
+            set_input_value<DataType::BOOL>(s_in.reset_flag, value);
         } else {
             throw block_error("input port too high");
         }
@@ -1765,11 +8214,11 @@ struct trig_block MT_COMPAT_SUBCLASS {
     }
 
     size_t get_input_num() const noexcept override {
-        return TrigInfo<FCN>::input_count;
+        return 2;
     }
 
     bool get_input_type_settable(size_t port_num) const noexcept override {
-        return port_num < get_input_num();
+        return port_num == PORT_VALUE_NUM;
     }
 
     size_t get_output_num() const noexcept override {
@@ -1777,8 +8226,10 @@ struct trig_block MT_COMPAT_SUBCLASS {
     }
 
     DataType get_input_type(size_t port_num) const override {
-        if (port_num < get_input_num()) {
+        if (port_num == PORT_VALUE_NUM) {
             return DT;
+        } else if (port_num == PORT_FLAG_NUM) {
+            return DataType::BOOL;
         } else {
             throw block_error("input port too high");
         }
@@ -1793,8 +8244,10 @@ struct trig_block MT_COMPAT_SUBCLASS {
     }
 
     std::string get_input_name(size_t port_num) const override {
-        if (port_num < get_input_num()) {
-            return (std::ostringstream() << "values[" << port_num << "]").str();
+        if (port_num == PORT_VALUE_NUM) {
+            return "value";
+        } else if (port_num == PORT_FLAG_NUM) {
+            return "reset_flag";
         } else {
             throw block_error("input port too high");
         }
@@ -1808,73 +8261,368 @@ struct trig_block MT_COMPAT_SUBCLASS {
         }
     }
 
+    size_t get_state_size() const noexcept override {
+        return sizeof(s_out) + sizeof(low_size) + sizeof(high_size) + sizeof(head) + sizeof(count) + window_size * (sizeof(data_t) + 3 * sizeof(size_t) + sizeof(bool));
+    }
+
+    void save_state(void* data) const noexcept override {
+        auto* ptr = static_cast<unsigned char*>(data);
+        write_state_values(ptr, s_out, low_size, high_size, head, count);
+        ptr += sizeof(s_out) + sizeof(low_size) + sizeof(high_size) + sizeof(head) + sizeof(count);
+
+        std::memcpy(ptr, values, window_size * sizeof(data_t));
+        ptr += window_size * sizeof(data_t);
+
+        for (const size_t* arr : {low_heap, high_heap, positions}) {
+            std::memcpy(ptr, arr, window_size * sizeof(size_t));
+            ptr += window_size * sizeof(size_t);
+        }
+
+        std::memcpy(ptr, in_low, window_size * sizeof(bool));
+    }
+
+    void load_state(const void* data) noexcept override {
+        const auto* ptr = static_cast<const unsigned char*>(data);
+        read_state_values(ptr, s_out, low_size, high_size, head, count);
+        ptr += sizeof(s_out) + sizeof(low_size) + sizeof(high_size) + sizeof(head) + sizeof(count);
+
+        std::memcpy(values, ptr, window_size * sizeof(data_t));
+        ptr += window_size * sizeof(data_t);
+
+        for (size_t* arr : {low_heap, high_heap, positions}) {
+            std::memcpy(arr, ptr, window_size * sizeof(size_t));
+            ptr += window_size * sizeof(size_t);
+        }
+
+        std::memcpy(in_low, ptr, window_size * sizeof(bool));
+    }
+
+    std::string get_parameters() const override {
+        return parameter_to_string<DataType::F64>(percentile);
+    }
+
 protected:
     std::string get_class_name() const override {
         std::ostringstream oss;
-        oss << "trig_block<" << datatype_to_string(DT) << ", " << trig_func_to_string(FCN) << '>';
+        oss << "order_statistic_block_dynamic<" << datatype_to_string(DT) << '>';
+        return oss.str();
+    }
+
+    std::string get_class_name_codegen() const override {
+        std::ostringstream oss;
+        oss << "order_statistic_block<" << datatype_to_string(DT) << ", " << window_size << '>';
         return oss.str();
     }
 
 public:
     std::string get_block_name() const override {
-        if constexpr (FCN == TrigFunction::SIN) {
-            return BLK_NAME_TRIG_SIN;
-        } else if (FCN == TrigFunction::COS) {
-            return BLK_NAME_TRIG_COS;
-        } else if (FCN == TrigFunction::TAN) {
-            return BLK_NAME_TRIG_TAN;
-        } else if (FCN == TrigFunction::ASIN) {
-            return BLK_NAME_TRIG_ASIN;
-        } else if (FCN == TrigFunction::ACOS) {
-            return BLK_NAME_TRIG_ACOS;
-        } else if (FCN == TrigFunction::ATAN) {
-            return BLK_NAME_TRIG_ATAN;
-        } else if (FCN == TrigFunction::ATAN2) {
-            return BLK_NAME_TRIG_ATAN2;
-        } else {
-            static_assert("unknown trig block type");
+        return BLK_NAME_ORDER_STATISTIC;
+    }
+#endif
+
+protected:
+    size_t get_rank(const size_t n) const noexcept {
+        const double p = std::min(std::max(percentile, 0.0), 1.0);
+        return static_cast<size_t>(p * static_cast<double>(n - 1) + 0.5);
+    }
+
+    // Determines if slot a belongs above slot b in the given heap
+    bool is_above(const bool low, const size_t a, const size_t b) const noexcept {
+        return low ? values[a] > values[b] : values[a] < values[b];
+    }
+
+    void place(const bool low, const size_t pos, const size_t slot) noexcept {
+        (low ? low_heap : high_heap)[pos] = slot;
+        positions[slot] = pos;
+        in_low[slot] = low;
+    }
+
+    void sift_up(const bool low, size_t pos) noexcept {
+        size_t* heap = low ? low_heap : high_heap;
+        const size_t slot = heap[pos];
+
+        while (pos > 0) {
+            const size_t parent = (pos - 1) / 2;
+            if (!is_above(low, slot, heap[parent])) {
+                break;
+            }
+
+            place(low, pos, heap[parent]);
+            pos = parent;
+        }
+
+        place(low, pos, slot);
+    }
+
+    void sift_down(const bool low, size_t pos) noexcept {
+        size_t* heap = low ? low_heap : high_heap;
+        const size_t size = low ? low_size : high_size;
+        const size_t slot = heap[pos];
+
+        while (true) {
+            size_t child = 2 * pos + 1;
+            if (child >= size) {
+                break;
+            } else if (child + 1 < size && is_above(low, heap[child + 1], heap[child])) {
+                child += 1;
+            }
+
+            if (!is_above(low, heap[child], slot)) {
+                break;
+            }
+
+            place(low, pos, heap[child]);
+            pos = child;
+        }
+
+        place(low, pos, slot);
+    }
+
+    void push(const bool low, const size_t slot) noexcept {
+        size_t& size = low ? low_size : high_size;
+        place(low, size, slot);
+        size += 1;
+        sift_up(low, size - 1);
+    }
+
+    size_t pop(const bool low) noexcept {
+        size_t* heap = low ? low_heap : high_heap;
+        size_t& size = low ? low_size : high_size;
+
+        const size_t slot = heap[0];
+        size -= 1;
+        if (size > 0) {
+            place(low, 0, heap[size]);
+            sift_down(low, 0);
         }
+
+        return slot;
+    }
+
+    void copy_from(const order_statistic_block_dynamic& other) noexcept {
+        std::copy(other.values, other.values + window_size, values);
+        std::copy(other.low_heap, other.low_heap + window_size, low_heap);
+        std::copy(other.high_heap, other.high_heap + window_size, high_heap);
+        std::copy(other.positions, other.positions + window_size, positions);
+        std::copy(other.in_low, other.in_low + window_size, in_low);
+
+        s_in = other.s_in;
+        s_out = other.s_out;
+        percentile = other.percentile;
+        low_size = other.low_size;
+        high_size = other.high_size;
+        head = other.head;
+        count = other.count;
+    }
+
+    data_t* values;
+    size_t* low_heap;
+    size_t* high_heap;
+    size_t* positions;
+    bool* in_low;
+
+    size_t window_size;
+    size_t low_size;
+    size_t high_size;
+    size_t head;
+    size_t count;
+};
+
+template <DataType DT, size_t WINDOW>
+struct order_statistic_block : public order_statistic_block_dynamic<DT> {
+    using data_t = typename type_info<DT>::type_t;
+
+    explicit order_statistic_block(const double percentile = 0.5) : _value_array{}, _low_heap_array{}, _high_heap_array{}, _position_array{}, _in_low_array{} {
+        static_assert(WINDOW > 0, "window must contain at least one value");
+        this->percentile = percentile;
+        this->values = _value_array.data();
+        this->low_heap = _low_heap_array.data();
+        this->high_heap = _high_heap_array.data();
+        this->positions = _position_array.data();
+        this->in_low = _in_low_array.data();
+        this->window_size = WINDOW;
+    }
+
+    order_statistic_block(const order_statistic_block&) = delete;
+    order_statistic_block& operator=(const order_statistic_block&) = delete;
+
+#ifdef MTEA_USE_FULL_LIB
+protected:
+    std::string get_class_name() const override {
+        std::ostringstream oss;
+        oss << "order_statistic_block<" << datatype_to_string(DT) << ", " << WINDOW << '>';
+        return oss.str();
     }
 
+public:
+    std::unique_ptr<block_interface> clone() const override {
+        auto blk = std::make_unique<order_statistic_block>();
+        blk->copy_from(*this);
+        return blk;
+    }
 #endif
 
-    input_t s_in;
-    output_t s_out;
+private:
+    std::array<data_t, WINDOW> _value_array;
+    std::array<size_t, WINDOW> _low_heap_array;
+    std::array<size_t, WINDOW> _high_heap_array;
+    std::array<size_t, WINDOW> _position_array;
+    std::array<bool, WINDOW> _in_low_array;
+};
+
+// Computes an in-place forward radix-2 FFT of n complex values held as separate real and imaginary arrays, where n is a
+// power of two and the tables hold cos and sin of 2 pi k / n for k < n / 2
+template <typename T>
+void fft_radix2(T* re, T* im, const size_t n, const T* cos_table, const T* sin_table) noexcept {
+    for (size_t i = 1, j = 0; i < n; ++i) {
+        size_t bit = n >> 1;
+        for (; j & bit; bit >>= 1) {
+            j ^= bit;
+        }
+        j ^= bit;
+
+        if (i < j) {
+            std::swap(re[i], re[j]);
+            std::swap(im[i], im[j]);
+        }
+    }
+
+    for (size_t len = 2; len <= n; len <<= 1) {
+        const size_t half = len / 2;
+        const size_t stride = n / len;
+
+        for (size_t i = 0; i < n; i += len) {
+            T* re_a = re + i;
+            T* im_a = im + i;
+            T* re_b = re_a + half;
+            T* im_b = im_a + half;
+
+            for (size_t k = 0; k < half; ++k) {
+                const T c = cos_table[k * stride];
+                const T s = sin_table[k * stride];
+                const T tr = re_b[k] * c + im_b[k] * s;
+                const T ti = im_b[k] * c - re_b[k] * s;
+
+                re_b[k] = re_a[k] - tr;
+                im_b[k] = im_a[k] - ti;
+                re_a[k] += tr;
+                im_a[k] += ti;
+            }
+        }
+    }
+}
+
+enum class WindowFunction : int32_t {
+    RECTANGULAR = 0,
+    HANN,
+    HAMMING,
+    BLACKMAN,
 };
 
 #ifdef MTEA_USE_FULL_LIB
-struct conversion_block_types {
-    static constexpr bool uses_integral = true;
+struct spectrum_block_types {
+    static constexpr bool uses_integral = false;
     static constexpr bool uses_float = true;
-    static constexpr bool uses_logical = true;
+    static constexpr bool uses_logical = false;
 };
 #endif // MTEA_USE_FULL_LIB
 
-template <DataType DT_IN, DataType DT_OUT>
-struct conversion_block MT_COMPAT_SUBCLASS {
-    using data_t_in = typename type_info<DT_IN>::type_t;
-    using data_t_out = typename type_info<DT_OUT>::type_t;
+// Accumulates the most recent window of samples and, every hop steps once the window is full, provides the single-sided
+// amplitude and phase spectrum of the windowed samples. Amplitudes are normalized by the window sum, such that a sine
+// at a bin frequency produces its amplitude in that bin. The window function takes effect on reset.
+template <DataType DT>
+struct spectrum_block_dynamic MT_COMPAT_SUBCLASS {
+    using data_t = typename type_info<DT>::type_t;
 
     struct input_t {
-        data_t_in value;
+        data_t value;
     };
 
     struct output_t {
-        data_t_out value;
+        data_t* magnitudes;
+        data_t* phases;
+        size_t bin_num;
+        bool ready;
     };
 
-    conversion_block() = default;
-    conversion_block(const conversion_block&) = delete;
-    conversion_block& operator=(const conversion_block&) = delete;
+    spectrum_block_dynamic() : s_in{}, s_out{nullptr, nullptr, 0, false}, hop{0}, window_function{WindowFunction::HANN}, size{0}, history{nullptr}, window{nullptr}, work_re{nullptr}, work_im{nullptr}, cos_table{nullptr}, sin_table{nullptr}, window_scale{1}, head{0}, count{0}, since_hop{0} {
+        static_assert(type_info<DT>::is_float, "data type must be a float");
+    }
 
-    void reset() noexcept MT_COMPAT_OVERRIDE { step(); }
+    spectrum_block_dynamic(const spectrum_block_dynamic&) = delete;
+    spectrum_block_dynamic& operator=(const spectrum_block_dynamic&) = delete;
+
+    void reset() noexcept MT_COMPAT_OVERRIDE {
+        const data_t two_pi = 2 * t_pi<data_t>();
+        const data_t n = static_cast<data_t>(size);
+
+        data_t window_sum = 0;
+        for (size_t i = 0; i < size; ++i) {
+            const data_t x = two_pi * static_cast<data_t>(i) / n;
+
+            switch (window_function) {
+            case WindowFunction::HANN:
+                window[i] = data_t(0.5) - data_t(0.5) * t_cos(x);
+                break;
+            case WindowFunction::HAMMING:
+                window[i] = data_t(0.54) - data_t(0.46) * t_cos(x);
+                break;
+            case WindowFunction::BLACKMAN:
+                window[i] = data_t(0.42) - data_t(0.5) * t_cos(x) + data_t(0.08) * t_cos(2 * x);
+                break;
+            default:
+                window[i] = 1;
+                break;
+            }
+
+            window_sum += window[i];
+        }
+
+        for (size_t k = 0; k < size / 2; ++k) {
+            cos_table[k] = t_cos(two_pi * static_cast<data_t>(k) / n);
+            sin_table[k] = t_sin(two_pi * static_cast<data_t>(k) / n);
+        }
+
+        window_scale = window_sum > 0 ? data_t(1) / window_sum : data_t(0);
+
+        std::fill(history, history + size, data_t(0));
+        std::fill(s_out.magnitudes, s_out.magnitudes + s_out.bin_num, data_t(0));
+        std::fill(s_out.phases, s_out.phases + s_out.bin_num, data_t(0));
+        s_out.ready = false;
+
+        head = 0;
+        count = 0;
+        since_hop = 0;
+    }
 
     void step() noexcept MT_COMPAT_OVERRIDE {
-        s_out.value = static_cast<data_t_out>(s_in.value);
+        history[head] = s_in.value;
+        head = head + 1 == size ? 0 : head + 1;
+
+        count += count < size ? 1 : 0;
+        since_hop += 1;
+
+        const size_t hop_size = hop > 0 && hop < size ? hop : size;
+        s_out.ready = count == size && since_hop >= hop_size;
+
+        if (s_out.ready) {
+            since_hop = 0;
+            compute_spectrum();
+        }
+    }
+
+    size_t get_size() const noexcept {
+        return size;
     }
 
+    input_t s_in;
+    output_t s_out;
+
+    size_t hop;
+    WindowFunction window_function;
+
 #ifdef MTEA_USE_FULL_LIB
-    using type_info_t = conversion_block_types;
+    using type_info_t = spectrum_block_types;
     block_types get_supported_types() const noexcept override {
         return block_types{
             .uses_integral = type_info_t::uses_integral,
@@ -1884,20 +8632,26 @@ struct conversion_block MT_COMPAT_SUBCLASS {
     }
 
     DataType get_current_type() const noexcept override {
-        return DT_IN;
+        return DT;
     }
 
     void set_input(size_t port_num, const Argument* value) override {
-        if (port_num < get_input_num()) {
-            set_input_value<DT_IN>(s_in.value, value);
+        if (port_num == 0) {
+            set_input_value<DT>(s_in.value, value);
         } else {
             throw block_error("input port too high");
         }
     }
 
     void get_output(size_t port_num, Argument* value) const override {
-        if (port_num < get_output_num()) {
-            get_output_value<DT_OUT>(s_out.value, value);
+        const size_t bins = s_out.bin_num;
+
+        if (port_num < bins) {
+            get_output_value<DT>(s_out.magnitudes[port_num], value);
+        } else if (port_num < 2 * bins) {
+            get_output_value<DT>(s_out.phases[port_num - bins], value);
+        } else if (port_num == 2 * bins) {
+            get_output_value<DataType::BOOL>(s_out.ready, value);
         } else {
             throw block_error("output port too high");
         }
@@ -1908,31 +8662,33 @@ struct conversion_block MT_COMPAT_SUBCLASS {
     }
 
     bool get_input_type_settable(size_t port_num) const noexcept override {
-        return port_num < get_output_num();
+        return port_num == 0;
     }
 
     size_t get_output_num() const noexcept override {
-        return 1;
+        return 2 * s_out.bin_num + 1;
     }
 
     DataType get_input_type(size_t port_num) const override {
-        if (port_num < get_input_num()) {
-            return DT_IN;
+        if (port_num == 0) {
+            return DT;
         } else {
             throw block_error("input port too high");
         }
     }
 
     DataType get_output_type(size_t port_num) const override {
-        if (port_num < get_output_num()) {
-            return DT_OUT;
+        if (port_num < 2 * s_out.bin_num) {
+            return DT;
+        } else if (port_num == 2 * s_out.bin_num) {
+            return DataType::BOOL;
         } else {
             throw block_error("output port too high");
         }
     }
 
     std::string get_input_name(size_t port_num) const override {
-        if (port_num < get_input_num()) {
+        if (port_num == 0) {
             return "value";
         } else {
             throw block_error("input port too high");
@@ -1940,31 +8696,175 @@ struct conversion_block MT_COMPAT_SUBCLASS {
     }
 
     std::string get_output_name(size_t port_num) const override {
-        if (port_num < get_output_num()) {
-            return "value";
+        const size_t bins = s_out.bin_num;
+
+        if (port_num < bins) {
+            return (std::ostringstream() << "magnitudes[" << port_num << "]").str();
+        } else if (port_num < 2 * bins) {
+            return (std::ostringstream() << "phases[" << port_num - bins << "]").str();
+        } else if (port_num == 2 * bins) {
+            return "ready";
         } else {
             throw block_error("output port too high");
         }
     }
 
+    size_t get_state_size() const noexcept override {
+        return sizeof(s_out.ready) + sizeof(head) + sizeof(count) + sizeof(since_hop) + (size + 2 * s_out.bin_num) * sizeof(data_t);
+    }
+
+    void save_state(void* data) const noexcept override {
+        auto* ptr = static_cast<unsigned char*>(data);
+        write_state_values(ptr, s_out.ready, head, count, since_hop);
+        ptr += sizeof(s_out.ready) + sizeof(head) + sizeof(count) + sizeof(since_hop);
+
+        std::memcpy(ptr, history, size * sizeof(data_t));
+        ptr += size * sizeof(data_t);
+        std::memcpy(ptr, s_out.magnitudes, s_out.bin_num * sizeof(data_t));
+        ptr += s_out.bin_num * sizeof(data_t);
+        std::memcpy(ptr, s_out.phases, s_out.bin_num * sizeof(data_t));
+    }
+
+    void load_state(const void* data) noexcept override {
+        const auto* ptr = static_cast<const unsigned char*>(data);
+        read_state_values(ptr, s_out.ready, head, count, since_hop);
+        ptr += sizeof(s_out.ready) + sizeof(head) + sizeof(count) + sizeof(since_hop);
+
+        std::memcpy(history, ptr, size * sizeof(data_t));
+        ptr += size * sizeof(data_t);
+        std::memcpy(s_out.magnitudes, ptr, s_out.bin_num * sizeof(data_t));
+        ptr += s_out.bin_num * sizeof(data_t);
+        std::memcpy(s_out.phases, ptr, s_out.bin_num * sizeof(data_t));
+    }
+
+    std::string get_parameters() const override {
+        return std::to_string(hop) + ", " + std::to_string(static_cast<int32_t>(window_function));
+    }
+
 protected:
     std::string get_class_name() const override {
         std::ostringstream oss;
-        oss << "conversion_block<" << datatype_to_string(DT_IN) << ", " << datatype_to_string(DT_OUT) << '>';
+        oss << "spectrum_block_dynamic<" << datatype_to_string(DT) << '>';
+        return oss.str();
+    }
+
+    std::string get_class_name_codegen() const override {
+        std::ostringstream oss;
+        oss << "spectrum_block<" << datatype_to_string(DT) << ", " << size << '>';
         return oss.str();
     }
 
 public:
     std::string get_block_name() const override {
-        return BLK_NAME_CONVERSION;
+        return BLK_NAME_SPECTRUM;
     }
-
 #endif
 
-    input_t s_in;
-    output_t s_out;
+protected:
+    void compute_spectrum() noexcept {
+        // The oldest sample is at the head of the ring buffer
+        const size_t first = size - head;
+        for (size_t i = 0; i < first; ++i) {
+            work_re[i] = history[head + i] * window[i];
+        }
+
+        for (size_t i = first; i < size; ++i) {
+            work_re[i] = history[i - first] * window[i];
+        }
+
+        std::fill(work_im, work_im + size, data_t(0));
+        fft_radix2(work_re, work_im, size, cos_table, sin_table);
+
+        for (size_t k = 0; k < s_out.bin_num; ++k) {
+            const data_t scale = k == 0 || 2 * k == size ? window_scale : 2 * window_scale;
+            s_out.magnitudes[k] = scale * t_sqrt(work_re[k] * work_re[k] + work_im[k] * work_im[k]);
+            s_out.phases[k] = t_atan2(work_im[k], work_re[k]);
+        }
+    }
+
+    void copy_from(const spectrum_block_dynamic& other) noexcept {
+        std::copy(other.history, other.history + size, history);
+        std::copy(other.window, other.window + size, window);
+        std::copy(other.cos_table, other.cos_table + size / 2, cos_table);
+        std::copy(other.sin_table, other.sin_table + size / 2, sin_table);
+        std::copy(other.s_out.magnitudes, other.s_out.magnitudes + s_out.bin_num, s_out.magnitudes);
+        std::copy(other.s_out.phases, other.s_out.phases + s_out.bin_num, s_out.phases);
+
+        s_in = other.s_in;
+        s_out.ready = other.s_out.ready;
+        hop = other.hop;
+        window_function = other.window_function;
+        window_scale = other.window_scale;
+        head = other.head;
+        count = other.count;
+        since_hop = other.since_hop;
+    }
+
+    size_t size;
+    data_t* history;
+    data_t* window;
+    data_t* work_re;
+    data_t* work_im;
+    data_t* cos_table;
+    data_t* sin_table;
+    data_t window_scale;
+
+    size_t head;
+    size_t count;
+    size_t since_hop;
 };
 
+template <DataType DT, size_t SIZE>
+struct spectrum_block : public spectrum_block_dynamic<DT> {
+    using data_t = typename type_info<DT>::type_t;
+
+    static constexpr size_t BIN_NUM = SIZE / 2 + 1;
+
+    explicit spectrum_block(const size_t hop = SIZE, const WindowFunction window_function = WindowFunction::HANN) : _history_array{}, _window_array{}, _re_array{}, _im_array{}, _cos_array{}, _sin_array{}, _magnitude_array{}, _phase_array{} {
+        static_assert(SIZE >= 2 && (SIZE & (SIZE - 1)) == 0, "size must be a power of two");
+        this->hop = hop;
+        this->window_function = window_function;
+        this->size = SIZE;
+        this->history = _history_array.data();
+        this->window = _window_array.data();
+        this->work_re = _re_array.data();
+        this->work_im = _im_array.data();
+        this->cos_table = _cos_array.data();
+        this->sin_table = _sin_array.data();
+        this->s_out.magnitudes = _magnitude_array.data();
+        this->s_out.phases = _phase_array.data();
+        this->s_out.bin_num = BIN_NUM;
+    }
+
+    spectrum_block(const spectrum_block&) = delete;
+    spectrum_block& operator=(const spectrum_block&) = delete;
+
+#ifdef MTEA_USE_FULL_LIB
+protected:
+    std::string get_class_name() const override {
+        std::ostringstream oss;
+        oss << "spectrum_block<" << datatype_to_string(DT) << ", " << SIZE << '>';
+        return oss.str();
+    }
+
+public:
+    std::unique_ptr<block_interface> clone() const override {
+        auto blk = std::make_unique<spectrum_block>();
+        blk->copy_from(*this);
+        return blk;
+    }
+#endif
+
+private:
+    std::array<data_t, SIZE> _history_array;
+    std::array<data_t, SIZE> _window_array;
+    std::array<data_t, SIZE> _re_array;
+    std::array<data_t, SIZE> _im_array;
+    std::array<data_t, SIZE / 2> _cos_array;
+    std::array<data_t, SIZE / 2> _sin_array;
+    std::array<data_t, BIN_NUM> _magnitude_array;
+    std::array<data_t, BIN_NUM> _phase_array;
+};
 }
 
 #endif // MTEA_H
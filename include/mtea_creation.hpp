@@ -23,6 +23,7 @@ struct BlockInformation {
         VALUE,
         VALUE_PTR,
         TIMESTEP,
+        SEED,
     };
 
     BlockInformation(std::string_view name, ConstructorOptions constructor, const block_interface::block_types& types);
@@ -61,6 +62,17 @@ std::unique_ptr<block_interface> create_block(
     std::span<const DataType> data_type,
     const Argument* argument = nullptr);
 
+std::unique_ptr<Argument> create_argument(DataType data_type);
+
+// Creates a const_block holding the current value of the provided output port, such that a subgraph of stateless
+// blocks fed only by constants may be evaluated once and replaced by its result
+std::unique_ptr<block_interface> create_const_block(const block_interface& blk, size_t port_num);
+
+// Creates a variant of the provided block that holds the constant inputs as members, where const_inputs provides the
+// constant value for each input port or nullptr if the port is not constant. The remaining inputs keep their relative
+// order in the returned block. Returns nullptr if no specialized variant applies.
+std::unique_ptr<block_interface> create_specialized_block(const block_interface& blk, std::span<const Argument* const> const_inputs);
+
 }
 
 #endif // MTEA_USE_FULL_LIB
@@ -0,0 +1,105 @@
+// SPDX-License-Identifier: MIT
+
+#ifndef MTEA_CSV_H
+#define MTEA_CSV_H
+
+#ifdef MTEA_USE_FULL_LIB
+
+#include <cstddef>
+#include <future>
+#include <istream>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "mtea_except.hpp"
+#include "mtea_types.hpp"
+
+namespace mtea {
+
+struct csv_options {
+    char delimiter{','};
+    bool has_header{true};
+    size_t chunk_rows{65536};
+    bool prefetch{true};
+};
+
+// Parses delimited text into typed columns, one chunk of rows at a time. With prefetch enabled, the chunk following the
+// current one is parsed on a background thread, such that parsing overlaps with the consumer of the current chunk.
+class csv_reader {
+public:
+    csv_reader(std::istream& stream, std::span<const DataType> column_types, const csv_options& options = {});
+
+    csv_reader(const csv_reader&) = delete;
+    csv_reader& operator=(const csv_reader&) = delete;
+
+    ~csv_reader();
+
+    // Makes the next chunk current, returning false if no rows remain. Column data from the previous chunk is
+    // invalidated.
+    bool next_chunk();
+
+    size_t get_column_num() const noexcept;
+
+    const std::vector<std::string>& get_column_names() const noexcept;
+
+    size_t get_row_num() const noexcept;
+
+    size_t get_start_row() const noexcept;
+
+    template <DataType DT>
+    std::span<const typename type_info<DT>::type_t> get_column(const size_t index) const {
+        using data_t = typename type_info<DT>::type_t;
+
+        if (index >= column_types.size()) {
+            throw block_error("csv column index too high");
+        } else if (column_types[index] != DT) {
+            throw block_error("csv column type mismatch");
+        }
+
+        return std::span<const data_t>(reinterpret_cast<const data_t*>(current.columns[index].data()), current.row_num);
+    }
+
+private:
+    struct chunk {
+        std::vector<std::vector<std::byte>> columns;
+        size_t row_num{0};
+        size_t start_row{0};
+    };
+
+    using parse_fn_t = bool (*)(std::string_view, std::byte*);
+
+    bool fill();
+
+    bool next_line(std::string_view& line);
+
+    void parse_line(std::string_view line, chunk& c);
+
+    void parse_chunk(chunk& c);
+
+    void start_prefetch();
+
+    std::istream& stream;
+    csv_options options;
+
+    std::vector<DataType> column_types;
+    std::vector<std::string> column_names;
+    std::vector<parse_fn_t> parsers;
+    std::vector<size_t> value_sizes;
+
+    std::vector<char> text;
+    size_t text_offset;
+    size_t line_num;
+    size_t row_num;
+
+    chunk current;
+    chunk pending;
+    std::future<void> pending_result;
+};
+
+}
+
+#endif // MTEA_USE_FULL_LIB
+
+#endif // MTEA_CSV_H
@@ -0,0 +1,180 @@
+// SPDX-License-Identifier: MIT
+
+#ifndef MTEA_LOG_H
+#define MTEA_LOG_H
+
+#ifdef MTEA_USE_FULL_LIB
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "mtea_except.hpp"
+#include "mtea_types.hpp"
+
+namespace mtea {
+
+struct log_signal {
+    std::string name;
+    DataType type;
+};
+
+template <DataType DT>
+uint64_t log_value_to_bits(const typename type_info<DT>::type_t value) noexcept {
+    if constexpr (DT == DataType::BOOL) {
+        return value ? 1 : 0;
+    } else if constexpr (DT == DataType::F32) {
+        return std::bit_cast<uint32_t>(value);
+    } else if constexpr (DT == DataType::F64) {
+        return std::bit_cast<uint64_t>(value);
+    } else if constexpr (type_info<DT>::is_signed) {
+        return static_cast<uint64_t>(static_cast<int64_t>(value));
+    } else {
+        return static_cast<uint64_t>(value);
+    }
+}
+
+template <DataType DT>
+typename type_info<DT>::type_t log_bits_to_value(const uint64_t bits) noexcept {
+    using data_t = typename type_info<DT>::type_t;
+
+    if constexpr (DT == DataType::BOOL) {
+        return bits != 0;
+    } else if constexpr (DT == DataType::F32) {
+        return std::bit_cast<float>(static_cast<uint32_t>(bits));
+    } else if constexpr (DT == DataType::F64) {
+        return std::bit_cast<double>(bits);
+    } else {
+        return static_cast<data_t>(bits);
+    }
+}
+
+// Writes signal samples column-wise in chunks of chunk_size steps. Each column in a chunk is encoded independently of
+// previous chunks, with booleans bit-packed, integers as zig-zag delta varints, and floats as the significant bytes of
+// the XOR with the previous value.
+class log_writer {
+public:
+    static const uint32_t MAGIC = 0x474c544d;
+    static const uint32_t CHUNK_MAGIC = 0x4b4e4843;
+    static const uint32_t VERSION = 1;
+
+    log_writer(std::ostream& stream, std::span<const log_signal> signals, size_t chunk_size = 4096);
+
+    log_writer(const log_writer&) = delete;
+    log_writer& operator=(const log_writer&) = delete;
+
+    ~log_writer();
+
+    template <DataType DT>
+    void write(const size_t index, const typename type_info<DT>::type_t value) {
+        if (index >= signals.size()) {
+            throw block_error("log signal index too high");
+        } else if (signals[index].type != DT) {
+            throw block_error("log signal type mismatch");
+        }
+
+        columns[index].push_back(log_value_to_bits<DT>(value));
+    }
+
+    // Completes the current step, which requires a value to have been written for every signal
+    void end_step();
+
+    // Writes any buffered steps as a final partial chunk
+    void flush();
+
+    size_t get_step_num() const noexcept;
+
+private:
+    void write_chunk();
+
+    std::ostream& stream;
+    std::vector<log_signal> signals;
+    size_t chunk_size;
+
+    std::vector<std::vector<uint64_t>> columns;
+    std::vector<std::byte> encoded;
+
+    size_t chunk_steps;
+    size_t step_num;
+};
+
+// Reads a log directly from its serialized form, such as a mapped_file, without copying. Only the chunks overlapping the
+// requested range are decoded.
+class log_reader {
+public:
+    explicit log_reader(std::span<const std::byte> data);
+
+    size_t get_signal_num() const noexcept;
+
+    const log_signal& get_signal(size_t index) const;
+
+    size_t find_signal(const std::string& name) const;
+
+    size_t get_step_num() const noexcept;
+
+    size_t get_chunk_num() const noexcept;
+
+    // Reads values.size() samples of the signal starting at step start, returning the number of samples read
+    template <DataType DT>
+    size_t read(const size_t index, const size_t start, std::span<typename type_info<DT>::type_t> values) const {
+        if (index >= signals.size()) {
+            throw block_error("log signal index too high");
+        } else if (signals[index].type != DT) {
+            throw block_error("log signal type mismatch");
+        }
+
+        std::vector<uint64_t> bits(values.size());
+        const size_t num = read_bits(index, start, bits.data(), values.size());
+
+        for (size_t i = 0; i < num; ++i) {
+            values[i] = log_bits_to_value<DT>(bits[i]);
+        }
+
+        return num;
+    }
+
+private:
+    struct chunk_info {
+        uint64_t start_step;
+        size_t sample_num;
+        size_t column_offset;
+    };
+
+    size_t read_bits(size_t index, size_t start, uint64_t* values, size_t num) const;
+
+    std::span<const std::byte> data;
+    std::vector<log_signal> signals;
+    std::vector<chunk_info> chunks;
+    std::vector<std::span<const std::byte>> columns;
+    size_t step_num;
+};
+
+// Provides read-only access to the contents of a file, memory-mapped where the platform supports it. Mappings use the
+// default paging, which suits random access to any signal and time range. Reading the whole file in order, such as
+// for a conversion, may request sequential paging instead, under which pages behind the read point are dropped.
+class mapped_file {
+public:
+    explicit mapped_file(const std::string& path, bool sequential = false);
+
+    mapped_file(const mapped_file&) = delete;
+    mapped_file& operator=(const mapped_file&) = delete;
+
+    ~mapped_file();
+
+    std::span<const std::byte> get_data() const noexcept;
+
+private:
+    const std::byte* ptr;
+    size_t size;
+    std::vector<std::byte> fallback;
+};
+
+}
+
+#endif // MTEA_USE_FULL_LIB
+
+#endif // MTEA_LOG_H
@@ -28,11 +28,22 @@ double t_atan(double x);
 float t_atan2(float y, float x);
 double t_atan2(double y, double x);
 
+float t_sqrt(float x);
+double t_sqrt(double x);
+
+float t_log(float x);
+double t_log(double x);
+
 uint32_t t_mod(uint32_t x, uint32_t y);
 int32_t t_mod(int32_t x, int32_t y);
 float t_mod(float x, float y);
 double t_mod(double x, double y);
 
+template <typename T>
+constexpr T t_pi() {
+    return static_cast<T>(3.141592653589793238462643383279502884L);
+}
+
 }
 
 #endif // MTEA_MATH_H
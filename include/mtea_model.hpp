@@ -0,0 +1,182 @@
+// SPDX-License-Identifier: MIT
+
+#ifndef MTEA_MODEL_H
+#define MTEA_MODEL_H
+
+#ifdef MTEA_USE_FULL_LIB
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <span>
+#include <vector>
+
+#include "mtea_solver.hpp"
+#include "mtea_state.hpp"
+#include "mtea_types.hpp"
+
+namespace mtea {
+
+struct model_port {
+    size_t block;
+    size_t port;
+};
+
+// Owns a set of blocks and the connections between their ports, and steps the blocks in dependency order. Blocks are
+// ordered such that each block is stepped after the blocks feeding its inputs. A cycle is only permitted if it passes
+// through a block whose outputs are delayed, which is then stepped first with the input values of the previous step.
+class block_model {
+public:
+    size_t add_block(std::unique_ptr<block_interface> blk);
+
+    void connect(model_port source, size_t block_num, size_t port_num);
+
+    bool has_block(size_t block_num) const noexcept;
+
+    block_interface& get_block(size_t block_num) const;
+
+    std::optional<model_port> get_source(size_t block_num, size_t port_num) const;
+
+    // Marks an output port as observed outside of the model, which keeps its block from being removed. Passes that
+    // replace the block update the marked port, such that get_outputs() always refers to the current source.
+    void add_output(model_port port);
+
+    std::span<const model_port> get_outputs() const noexcept;
+
+    size_t get_block_num() const noexcept;
+
+    // Adds a recorder block with the provided capacity that records the values of an output port, keeping every n-th
+    // enabled step for a decimation of n. Recording is gated by the enable port if provided, and otherwise always
+    // enabled through an added constant block. Returns the block number of the recorder.
+    size_t attach_recorder(model_port port, size_t capacity, size_t decimation = 1, std::optional<model_port> enable = std::nullopt);
+
+    void set_time_step(double dt) noexcept;
+
+    // When enabled, a stateless block is only stepped if the value of at least one of its inputs changed since it was
+    // last stepped. Stateful blocks are stepped every time, so the model outputs match those of eager evaluation.
+    void set_lazy_evaluation(bool lazy) noexcept;
+
+    bool get_lazy_evaluation() const noexcept;
+
+    // Orders the blocks, resets each block with the outputs of its sources applied, and must be called after any
+    // change to the model structure before stepping
+    void reset();
+
+    void step();
+
+    void get_output(model_port port, Argument* value) const;
+
+    // Provides the number of block step() calls performed since the last reset
+    size_t get_evaluation_num() const noexcept;
+
+    // Provides the number of continuous states, which are the outputs of the integrator blocks in block number order
+    size_t get_continuous_state_num() const;
+
+    // Provides the total number of block zero crossings, in block number order, as checked by step_variable()
+    size_t get_zero_crossing_num() const noexcept;
+
+    // Advances the continuous states from time t by a single accepted step of the solver and returns the step size
+    // taken. Within the step, the integrator states are set by the solver and their derivatives are read from their
+    // value inputs after evaluating the stateless blocks, while the outputs of other stateful blocks are held. The step
+    // size is then published to every block by set_time_step() and the blocks are stepped once, such that a clock_block
+    // advances with the solver time. If a detector is provided, the logical outputs of blocks with zero crossings are
+    // held within a step, and a step in which any block zero crossing changes sign is repeated up to the located event
+    // time, with the guards between the step ends evaluated from the linearly interpolated states.
+    double step_variable(variable_step_solver& solver, double t, zero_crossing_detector* detector = nullptr);
+
+    // Advances the continuous states from time t to t + h with the implicit solver, evaluating the derivatives and
+    // publishing the step size as for step_variable()
+    void step_implicit(implicit_solver& solver, double t, double h);
+
+    // Captures the state of every block, in block number order. The image may be restored into any model with the same
+    // blocks, such as this model as long as its structure has not changed since.
+    state_image save_state() const;
+
+    void restore_state(const state_image& image);
+
+    // Creates an ensemble over the blocks of the model, where each instance starts from the current block states
+    state_ensemble create_ensemble(size_t instance_num);
+
+    // Loads an instance of an ensemble created by create_ensemble() and updates the port values seen by the connected
+    // blocks, such that the next step() continues from that instance. The instance is stored with ensemble.store().
+    void load_instance(const state_ensemble& ensemble, size_t index);
+
+    // Creates an independent copy of the model, with each block cloned along with its current state
+    block_model clone() const;
+
+    // Evaluates each stateless block whose inputs are all fed by constant blocks once, using its own step(), and
+    // replaces it with one const_block per output port. Folding proceeds in dependency order, so whole chains of
+    // parameter derivations collapse into constants. Returns the number of blocks replaced.
+    size_t fold_constants();
+
+    // Removes stateless blocks whose outputs are neither connected nor marked as model outputs, including the blocks
+    // that only fed removed blocks. Stateful blocks are kept. Returns the number of blocks removed.
+    size_t remove_unused_blocks();
+
+    // Merges stateless blocks with an equal signature, equal parameters and equal input sources into the first such
+    // block, rewiring the consumers of each duplicate. Stateful blocks are never merged, as each holds its own state. Returns the
+    // number of blocks merged away.
+    size_t merge_duplicates();
+
+    // Replaces each block with input ports fed by constant blocks by its specialized variant, if one exists, which holds
+    // the constant values as members. The remaining inputs are rewired to the variant, and constant blocks that no
+    // longer feed any block are removed. Returns the number of blocks replaced.
+    size_t specialize_blocks();
+
+private:
+    struct node {
+        std::unique_ptr<block_interface> blk;
+        std::vector<std::optional<model_port>> sources;
+        std::vector<std::unique_ptr<Argument>> values;
+        std::vector<uint64_t> versions;
+        std::vector<uint64_t> input_versions;
+        bool evaluated{false};
+    };
+
+    const node& get_node(size_t block_num) const;
+
+    std::vector<size_t> sort_blocks() const;
+
+    void apply_inputs(node& n);
+
+    void capture_outputs(node& n);
+
+    bool inputs_changed(const node& n) const;
+
+    void replace_source(model_port from, model_port to);
+
+    std::vector<block_interface*> get_live_blocks() const;
+
+    std::vector<size_t> get_integrators() const;
+
+    void read_continuous_states(std::span<const size_t> integrators, std::span<double> x) const;
+
+    void write_continuous_states(std::span<const size_t> integrators, std::span<const double> x);
+
+    void evaluate_stateless(bool hold_modes);
+
+    void evaluate_derivatives(std::span<const size_t> integrators, std::span<const double> x, std::span<double> dx, bool hold_modes);
+
+    void evaluate_crossings(std::span<double> g) const;
+
+    void commit_continuous_step(std::span<const size_t> integrators, std::span<const double> x, double h);
+
+    void refresh_outputs();
+
+    void remove_block(size_t block_num);
+
+    std::vector<node> nodes;
+    std::vector<size_t> order;
+    std::vector<model_port> outputs;
+
+    bool order_valid{false};
+    bool lazy_evaluation{false};
+    size_t evaluation_num{0};
+};
+
+}
+
+#endif // MTEA_USE_FULL_LIB
+
+#endif // MTEA_MODEL_H
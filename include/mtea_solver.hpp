@@ -0,0 +1,173 @@
+// SPDX-License-Identifier: MIT
+
+#ifndef MTEA_SOLVER_H
+#define MTEA_SOLVER_H
+
+#ifdef MTEA_USE_FULL_LIB
+
+#include <cstddef>
+#include <functional>
+#include <span>
+#include <vector>
+
+namespace mtea {
+
+// Evaluates the state derivative dx at time t for the continuous states x. For a block model, x holds the
+// integrator_block output values and dx is gathered from the integrator_block inputs after evaluating the model.
+using derivative_fn_t = std::function<void(double t, std::span<const double> x, std::span<double> dx)>;
+
+// Evaluates the zero crossing values g, as provided by block_interface::get_zero_crossing(), with the model states
+// interpolated to time t
+using crossing_fn_t = std::function<void(double t, std::span<double> g)>;
+
+struct solver_tolerance {
+    double relative{1e-6};
+    double absolute{1e-9};
+    double step_min{1e-9};
+    double step_max{1.0};
+};
+
+class variable_step_solver {
+public:
+    explicit variable_step_solver(size_t state_num, const solver_tolerance& tol = {});
+
+    // Advances the state from t by a single accepted Dormand-Prince 5(4) step, retrying with a smaller step size
+    // until the error estimate is within tolerance. Returns the step size that was taken. Throws if the derivative is
+    // still not finite at the minimum step size.
+    double step(double t, std::span<double> x, const derivative_fn_t& fcn);
+
+    // Discards the cached derivative, which must be called if the states were modified outside of step()
+    void reset() noexcept;
+
+    double get_time_step() const noexcept;
+
+    void set_time_step(double dt);
+
+    size_t get_state_num() const noexcept;
+
+    size_t get_accepted_num() const noexcept;
+
+    size_t get_rejected_num() const noexcept;
+
+    const solver_tolerance& get_tolerance() const noexcept;
+
+private:
+    double error_norm(std::span<const double> x, std::span<const double> x_new) const;
+
+    solver_tolerance tolerance;
+
+    double time_step;
+    bool first_same_as_last;
+
+    size_t accepted_num;
+    size_t rejected_num;
+
+    std::vector<double> stages;
+    std::vector<double> x_stage;
+    std::vector<double> x_next;
+    std::vector<double> x_error;
+};
+
+class zero_crossing_detector {
+public:
+    explicit zero_crossing_detector(size_t crossing_num);
+
+    // Stores the crossing values at the start of the next step, where a value of exactly zero keeps the sign stored
+    // before
+    void reset(std::span<const double> g);
+
+    // Checks whether any crossing value changed sign relative to the stored values
+    bool check(std::span<const double> g) const;
+
+    // Finds the earliest sign change within (t0, t1] by safeguarded interpolation and returns the time just after the
+    // event, within the provided time tolerance. The crossing values at the start of the interval must be stored.
+    double locate(double t0, double t1, const crossing_fn_t& fcn, double tol);
+
+    size_t get_crossing_num() const noexcept;
+
+    size_t get_event_index() const noexcept;
+
+private:
+    static double keep_sign(double previous, double value) noexcept;
+
+    static bool sign_changed(double a, double b) noexcept;
+
+    std::vector<double> g_start;
+    std::vector<double> g_low;
+    std::vector<double> g_high;
+    std::vector<double> g_mid;
+
+    size_t event_index;
+};
+
+enum class ImplicitMethod {
+    BACKWARD_EULER = 0,
+    BDF2,
+};
+
+class implicit_solver {
+public:
+    explicit implicit_solver(size_t state_num, ImplicitMethod method = ImplicitMethod::BACKWARD_EULER, const solver_tolerance& tol = {});
+
+    // Sets the states that each state derivative depends on, used to group Jacobian columns so that a single
+    // derivative evaluation estimates every column in a group. Without a pattern the Jacobian is treated as dense.
+    void set_sparsity(std::span<const std::vector<size_t>> dependencies);
+
+    // Advances the state from t to t + h, reusing the Jacobian and its factorization from previous steps until the
+    // Newton iteration fails to converge
+    void step(double t, double h, std::span<double> x, const derivative_fn_t& fcn);
+
+    // Discards the step history and the cached Jacobian
+    void reset() noexcept;
+
+    size_t get_state_num() const noexcept;
+
+    size_t get_color_num() const noexcept;
+
+    size_t get_jacobian_num() const noexcept;
+
+    size_t get_factorization_num() const noexcept;
+
+private:
+    void update_jacobian(double t, std::span<const double> x, const derivative_fn_t& fcn);
+
+    void factorize(double gamma_h);
+
+    void solve(std::span<double> b) const;
+
+    bool newton(double t, double gamma_h, std::span<const double> rhs, const derivative_fn_t& fcn);
+
+    const ImplicitMethod method;
+    solver_tolerance tolerance;
+
+    std::vector<std::vector<size_t>> column_rows;
+    std::vector<size_t> column_colors;
+    size_t color_num;
+
+    std::vector<double> jacobian;
+    std::vector<double> lu;
+    std::vector<size_t> pivots;
+
+    bool jacobian_valid;
+    bool jacobian_current;
+    double factored_gamma_h;
+
+    bool history_valid;
+    double history_h;
+    std::vector<double> x_prev;
+
+    std::vector<double> x_new;
+    std::vector<double> x_rhs;
+    std::vector<double> f_eval;
+    std::vector<double> f_pert;
+    std::vector<double> delta;
+
+    size_t jacobian_num;
+    size_t factorization_num;
+};
+
+}
+
+#endif // MTEA_USE_FULL_LIB
+
+#endif // MTEA_SOLVER_H
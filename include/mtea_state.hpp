@@ -0,0 +1,72 @@
+// SPDX-License-Identifier: MIT
+
+#ifndef MTEA_STATE_H
+#define MTEA_STATE_H
+
+#ifdef MTEA_USE_FULL_LIB
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "mtea_types.hpp"
+
+namespace mtea {
+
+class state_image {
+public:
+    static const uint32_t MAGIC = 0x5453544d;
+    static const uint32_t VERSION = 1;
+
+    state_image() = default;
+
+    explicit state_image(std::span<const std::byte> image);
+
+    void capture(std::span<block_interface* const> blocks);
+
+    void restore(std::span<block_interface* const> blocks) const;
+
+    std::span<const std::byte> get_data() const noexcept;
+
+    size_t get_block_num() const noexcept;
+
+private:
+    std::vector<std::byte> data;
+};
+
+// Shares a single set of blocks, holding the model structure and parameters, between many instances that each only
+// store their block states in one contiguous buffer. Instances are stepped by loading their state into the shared
+// blocks, stepping the blocks, and storing the state back. Loading an instance also sets its index as the instance of
+// each block, giving stochastic blocks an independent stream per instance.
+class state_ensemble {
+public:
+    // Initializes every instance with the current state of the provided blocks
+    state_ensemble(std::span<block_interface* const> blocks, size_t instance_num);
+
+    void load(size_t index) const;
+
+    void store(size_t index);
+
+    size_t get_instance_num() const noexcept;
+
+    size_t get_instance_size() const noexcept;
+
+    std::span<const std::byte> get_instance_state(size_t index) const;
+
+private:
+    std::vector<block_interface*> blocks;
+    size_t instance_num;
+    size_t instance_size;
+    std::vector<std::byte> states;
+};
+
+// Restores block states directly from a serialized image, such as a memory-mapped snapshot file, without copying the
+// image into a state_image first
+void restore_state_image(std::span<block_interface* const> blocks, std::span<const std::byte> image);
+
+}
+
+#endif // MTEA_USE_FULL_LIB
+
+#endif // MTEA_STATE_H
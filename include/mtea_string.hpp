@@ -18,10 +18,37 @@ extern constinit std::string BLK_NAME_CONST;
 extern constinit std::string BLK_NAME_CONST_PTR;
 extern constinit std::string BLK_NAME_CONVERSION;
 extern constinit std::string BLK_NAME_DELAY;
+extern constinit std::string BLK_NAME_DELAY_N;
+extern constinit std::string BLK_NAME_DELAY_CONST;
+extern constinit std::string BLK_NAME_TRANSPORT_DELAY;
 extern constinit std::string BLK_NAME_DERIV;
 extern constinit std::string BLK_NAME_INTEG;
+extern constinit std::string BLK_NAME_INTEG_CONST;
 extern constinit std::string BLK_NAME_SWITCH;
 extern constinit std::string BLK_NAME_LIMITER;
+extern constinit std::string BLK_NAME_LIMITER_CONST;
+extern constinit std::string BLK_NAME_RECORDER;
+extern constinit std::string BLK_NAME_SOURCE;
+extern constinit std::string BLK_NAME_LOOKUP;
+extern constinit std::string BLK_NAME_FIR;
+extern constinit std::string BLK_NAME_BIQUAD;
+extern constinit std::string BLK_NAME_STATE_SPACE;
+extern constinit std::string BLK_NAME_TRANSFER_FCN;
+extern constinit std::string BLK_NAME_PID;
+extern constinit std::string BLK_NAME_PID_BANK;
+extern constinit std::string BLK_NAME_SINE_WAVE;
+extern constinit std::string BLK_NAME_SINE_BANK;
+extern constinit std::string BLK_NAME_SQUARE_WAVE;
+extern constinit std::string BLK_NAME_PULSE;
+extern constinit std::string BLK_NAME_RAMP;
+extern constinit std::string BLK_NAME_CHIRP;
+extern constinit std::string BLK_NAME_UNIFORM_NOISE;
+extern constinit std::string BLK_NAME_GAUSSIAN_NOISE;
+extern constinit std::string BLK_NAME_RUNNING_STATS;
+extern constinit std::string BLK_NAME_STATS_BANK;
+extern constinit std::string BLK_NAME_MOVING_AVERAGE;
+extern constinit std::string BLK_NAME_ORDER_STATISTIC;
+extern constinit std::string BLK_NAME_SPECTRUM;
 extern constinit std::string BLK_NAME_ARITH_ADD;
 extern constinit std::string BLK_NAME_ARITH_SUB;
 extern constinit std::string BLK_NAME_ARITH_MUL;
@@ -33,6 +60,17 @@ extern constinit std::string BLK_NAME_REL_LT;
 extern constinit std::string BLK_NAME_REL_LEQ;
 extern constinit std::string BLK_NAME_REL_EQ;
 extern constinit std::string BLK_NAME_REL_NEQ;
+extern constinit std::string BLK_NAME_ARITH_ADD_CONST;
+extern constinit std::string BLK_NAME_ARITH_SUB_CONST;
+extern constinit std::string BLK_NAME_ARITH_MUL_CONST;
+extern constinit std::string BLK_NAME_ARITH_DIV_CONST;
+extern constinit std::string BLK_NAME_ARITH_MOD_CONST;
+extern constinit std::string BLK_NAME_REL_GT_CONST;
+extern constinit std::string BLK_NAME_REL_GEQ_CONST;
+extern constinit std::string BLK_NAME_REL_LT_CONST;
+extern constinit std::string BLK_NAME_REL_LEQ_CONST;
+extern constinit std::string BLK_NAME_REL_EQ_CONST;
+extern constinit std::string BLK_NAME_REL_NEQ_CONST;
 extern constinit std::string BLK_NAME_TRIG_SIN;
 extern constinit std::string BLK_NAME_TRIG_COS;
 extern constinit std::string BLK_NAME_TRIG_TAN;
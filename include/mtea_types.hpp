@@ -9,6 +9,7 @@
 #include "mtea_except.hpp"
 
 #include <cstring>
+#include <memory>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -311,7 +312,9 @@ struct ArgumentBox final : public Argument {
     }
 
     size_t as_size() const override {
-        if constexpr (type_info<DT>::is_integral) {
+        if constexpr (DT == DataType::BOOL) {
+            return value ? 1 : 0;
+        } else if constexpr (type_info<DT>::is_integral) {
             if (value >= 0) {
                 return static_cast<size_t>(value);
             } else {
@@ -358,6 +361,8 @@ struct block_interface {
 
     virtual void step() noexcept;
 
+    virtual void set_time_step(double dt) noexcept;
+
     virtual DataType get_current_type() const noexcept = 0;
 
     virtual void set_input(size_t port_num, const Argument* value) = 0;
@@ -376,6 +381,22 @@ struct block_interface {
 
     virtual bool outputs_are_delayed() const noexcept;
 
+    virtual bool is_stateless() const noexcept;
+
+    virtual size_t get_state_size() const noexcept;
+
+    virtual void save_state(void* data) const noexcept;
+
+    virtual void load_state(const void* data) noexcept;
+
+    virtual void set_instance(uint64_t instance) noexcept;
+
+    virtual std::unique_ptr<block_interface> clone() const;
+
+    virtual size_t get_zero_crossing_num() const noexcept;
+
+    virtual double get_zero_crossing(size_t index) const;
+
     virtual std::string get_input_name(size_t port_num) const = 0;
 
     virtual std::string get_output_name(size_t port_num) const = 0;
@@ -427,9 +448,29 @@ protected:
         set_model_value<DT>(output, value);
     }
 
+    template <typename... Ts>
+    static void write_state_values(void* data, const Ts&... values) noexcept {
+        auto ptr = static_cast<unsigned char*>(data);
+        ((std::memcpy(ptr, &values, sizeof(values)), ptr += sizeof(values)), ...);
+    }
+
+    template <typename... Ts>
+    static void read_state_values(const void* data, Ts&... values) noexcept {
+        auto ptr = static_cast<const unsigned char*>(data);
+        ((std::memcpy(&values, ptr, sizeof(values)), ptr += sizeof(values)), ...);
+    }
+
 public:
     std::string get_type_name(bool use_codegen_name = true) const;
 
+    std::string get_signature() const;
+
+    virtual std::string get_parameters() const;
+
+    // Compares the parameters of a block with an equal signature, for blocks whose get_parameters() only summarizes
+    // parameters that are not owned by the block
+    virtual bool has_equal_parameters(const block_interface& other) const;
+
     virtual std::string get_block_name() const = 0;
 
 protected:
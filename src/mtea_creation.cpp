@@ -133,6 +133,27 @@ const static std::vector<mtea::BlockInformation> BLK_LIST = []() {
         BlockInformation(BLK_NAME_SWITCH, BlockInformation::ConstructorOptions::NONE, create_block_types<switch_block_types>()),
         BlockInformation(BLK_NAME_LIMITER, BlockInformation::ConstructorOptions::NONE, create_block_types<limiter_block_types>()),
         BlockInformation(BLK_NAME_CONVERSION, BlockInformation::ConstructorOptions::NONE, create_block_types<const_block_types>()).with_required_type_count(2),
+        BlockInformation(BLK_NAME_RECORDER, BlockInformation::ConstructorOptions::SIZE, create_block_types<recorder_block_types>()).with_constructor_codegen(BlockInformation::ConstructorOptions::NONE),
+        BlockInformation(BLK_NAME_DELAY_N, BlockInformation::ConstructorOptions::SIZE, create_block_types<delay_block_types>()).with_constructor_codegen(BlockInformation::ConstructorOptions::NONE),
+        BlockInformation(BLK_NAME_TRANSPORT_DELAY, BlockInformation::ConstructorOptions::SIZE, create_block_types<transport_delay_block_types>()).with_constructor_codegen(BlockInformation::ConstructorOptions::NONE),
+        BlockInformation(BLK_NAME_TRANSFER_FCN, BlockInformation::ConstructorOptions::SIZE, create_block_types<linear_block_types>()).with_constructor_codegen(BlockInformation::ConstructorOptions::NONE),
+        BlockInformation(BLK_NAME_PID, BlockInformation::ConstructorOptions::TIMESTEP, create_block_types<pid_block_types>()),
+        BlockInformation(BLK_NAME_PID_BANK, BlockInformation::ConstructorOptions::SIZE, create_block_types<pid_block_types>()).with_constructor_codegen(BlockInformation::ConstructorOptions::NONE),
+        BlockInformation(BLK_NAME_SINE_WAVE, BlockInformation::ConstructorOptions::TIMESTEP, create_block_types<generator_block_types>()).with_uses_input_as_type(false),
+        BlockInformation(BLK_NAME_SQUARE_WAVE, BlockInformation::ConstructorOptions::TIMESTEP, create_block_types<generator_block_types>()).with_uses_input_as_type(false),
+        BlockInformation(BLK_NAME_PULSE, BlockInformation::ConstructorOptions::TIMESTEP, create_block_types<generator_block_types>()).with_uses_input_as_type(false),
+        BlockInformation(BLK_NAME_RAMP, BlockInformation::ConstructorOptions::TIMESTEP, create_block_types<generator_block_types>()).with_uses_input_as_type(false),
+        BlockInformation(BLK_NAME_CHIRP, BlockInformation::ConstructorOptions::TIMESTEP, create_block_types<generator_block_types>()).with_uses_input_as_type(false),
+        BlockInformation(BLK_NAME_UNIFORM_NOISE, BlockInformation::ConstructorOptions::SEED, create_block_types<noise_block_types>()).with_uses_input_as_type(false),
+        BlockInformation(BLK_NAME_GAUSSIAN_NOISE, BlockInformation::ConstructorOptions::SEED, create_block_types<noise_block_types>()).with_uses_input_as_type(false),
+        BlockInformation(BLK_NAME_RUNNING_STATS, BlockInformation::ConstructorOptions::NONE, create_block_types<statistics_block_types>()),
+        BlockInformation(BLK_NAME_STATS_BANK, BlockInformation::ConstructorOptions::SIZE, create_block_types<statistics_block_types>()).with_constructor_codegen(BlockInformation::ConstructorOptions::NONE),
+        BlockInformation(BLK_NAME_MOVING_AVERAGE, BlockInformation::ConstructorOptions::SIZE, create_block_types<statistics_block_types>()).with_constructor_codegen(BlockInformation::ConstructorOptions::NONE),
+        BlockInformation(BLK_NAME_ORDER_STATISTIC, BlockInformation::ConstructorOptions::SIZE, create_block_types<order_statistic_block_types>()).with_constructor_codegen(BlockInformation::ConstructorOptions::NONE),
+        BlockInformation(BLK_NAME_SPECTRUM, BlockInformation::ConstructorOptions::SIZE, create_block_types<spectrum_block_types>()).with_constructor_codegen(BlockInformation::ConstructorOptions::NONE),
+        BlockInformation(BLK_NAME_SINE_BANK, BlockInformation::ConstructorOptions::SIZE, create_block_types<generator_block_types>()).with_uses_input_as_type(false).with_constructor_codegen(BlockInformation::ConstructorOptions::NONE),
+        BlockInformation(BLK_NAME_FIR, BlockInformation::ConstructorOptions::SIZE, create_block_types<filter_block_types>()).with_constructor_codegen(BlockInformation::ConstructorOptions::NONE),
+        BlockInformation(BLK_NAME_BIQUAD, BlockInformation::ConstructorOptions::SIZE, create_block_types<filter_block_types>()).with_constructor_codegen(BlockInformation::ConstructorOptions::NONE),
     };
 
     // Arithmetic Blocks
@@ -310,6 +331,8 @@ struct StandardBlockFunctor {
             return create_block_of_type<switch_block, switch_block_types>(data_type);
         } else if (name == BLK_NAME_LIMITER) {
             return create_block_of_type<limiter_block, limiter_block_types>(data_type);
+        } else if (name == BLK_NAME_RUNNING_STATS) {
+            return create_block_of_type<running_stats_block, statistics_block_types>(data_type);
         } else if (name == BLK_NAME_REL_EQ) {
             return create_block_of_type<blk_rel_eq, mtea::relational_block_types<mtea::RelationalOperator::EQUAL>>(data_type);
         } else if (name == BLK_NAME_REL_NEQ) {
@@ -360,6 +383,18 @@ struct SingleArgConstructor {
             return create_block_of_type<mtea::const_block, mtea::const_block_types>(val->get_type(), val);
         } else if (name == BLK_NAME_CLOCK) {
             return create_block_of_type<mtea::clock_block, mtea::clock_block_types>(val->get_type(), val);
+        } else if (name == BLK_NAME_PID) {
+            return create_block_of_type<mtea::pid_block, mtea::pid_block_types>(val->get_type(), val);
+        } else if (name == BLK_NAME_SINE_WAVE) {
+            return create_block_of_type<mtea::sine_wave_block, mtea::generator_block_types>(val->get_type(), val);
+        } else if (name == BLK_NAME_SQUARE_WAVE) {
+            return create_block_of_type<mtea::square_wave_block, mtea::generator_block_types>(val->get_type(), val);
+        } else if (name == BLK_NAME_PULSE) {
+            return create_block_of_type<mtea::pulse_block, mtea::generator_block_types>(val->get_type(), val);
+        } else if (name == BLK_NAME_RAMP) {
+            return create_block_of_type<mtea::ramp_block, mtea::generator_block_types>(val->get_type(), val);
+        } else if (name == BLK_NAME_CHIRP) {
+            return create_block_of_type<mtea::chirp_block, mtea::generator_block_types>(val->get_type(), val);
         } else {
             std::ostringstream oss;
             oss << "unknown block name \"" << name << "\" provided";
@@ -380,6 +415,14 @@ struct ArithmeticBlockFunctor {
             this->s_in.values = data.get();
         }
 
+        std::unique_ptr<mtea::block_interface> clone() const override {
+            const size_t size = this->s_in.size;
+            auto blk = std::make_unique<arith_wrapper>(size);
+            std::copy(this->s_in.values, this->s_in.values + size, blk->s_in.values);
+            blk->s_out = this->s_out;
+            return blk;
+        }
+
     private:
         std::unique_ptr<data_t[]> data;
     };
@@ -414,6 +457,430 @@ struct ArithmeticBlockFunctor {
     }
 };
 
+template <mtea::DataType DT>
+struct RecorderBlockFunctor {
+    class recorder_wrapper final : public mtea::recorder_block_dynamic<DT> {
+        using data_t = typename mtea::type_info<DT>::type_t;
+
+    public:
+        recorder_wrapper(const size_t size) : data(std::unique_ptr<data_t[]>(new data_t[size])) {
+            this->buffer = data.get();
+            this->capacity = size;
+        }
+
+        std::unique_ptr<mtea::block_interface> clone() const override {
+            auto blk = std::make_unique<recorder_wrapper>(this->capacity);
+            blk->s_in = this->s_in;
+            blk->decimation = this->decimation;
+            blk->step_count = this->step_count;
+            return blk;
+        }
+
+    private:
+        std::unique_ptr<data_t[]> data;
+    };
+
+    std::unique_ptr<mtea::block_interface> operator()(const size_t size) {
+        if (size == 0) {
+            throw mtea::block_error("recorder capacity must be greater than zero");
+        }
+
+        return std::make_unique<recorder_wrapper>(size);
+    }
+};
+
+template <mtea::DataType DT>
+struct FirBlockFunctor {
+    class fir_wrapper final : public mtea::fir_block_dynamic<DT> {
+        using data_t = typename mtea::type_info<DT>::type_t;
+
+    public:
+        fir_wrapper(const size_t size) : data(std::unique_ptr<data_t[]>(new data_t[3 * size]())) {
+            this->coefficients = data.get();
+            this->history = data.get() + size;
+            this->tap_num = size;
+            this->coefficients[0] = 1;
+        }
+
+        std::unique_ptr<mtea::block_interface> clone() const override {
+            auto blk = std::make_unique<fir_wrapper>(this->tap_num);
+            blk->copy_from(*this);
+            return blk;
+        }
+
+    private:
+        std::unique_ptr<data_t[]> data;
+    };
+
+    std::unique_ptr<mtea::block_interface> operator()(const size_t size) {
+        if (size == 0) {
+            throw mtea::block_error("filter must have at least one tap");
+        }
+
+        return std::make_unique<fir_wrapper>(size);
+    }
+};
+
+template <mtea::DataType DT>
+struct BiquadBlockFunctor {
+    class biquad_wrapper final : public mtea::biquad_block_dynamic<DT> {
+        using data_t = typename mtea::type_info<DT>::type_t;
+        using base_t = mtea::biquad_block_dynamic<DT>;
+
+    public:
+        biquad_wrapper(const size_t size) : data(std::unique_ptr<data_t[]>(new data_t[(base_t::COEFFICIENT_NUM + 2) * size]())) {
+            this->coefficients = data.get();
+            this->states = data.get() + base_t::COEFFICIENT_NUM * size;
+            this->section_num = size;
+
+            for (size_t i = 0; i < size; ++i) {
+                this->coefficients[i * base_t::COEFFICIENT_NUM] = 1;
+            }
+        }
+
+        std::unique_ptr<mtea::block_interface> clone() const override {
+            auto blk = std::make_unique<biquad_wrapper>(this->section_num);
+            blk->copy_from(*this);
+            return blk;
+        }
+
+    private:
+        std::unique_ptr<data_t[]> data;
+    };
+
+    std::unique_ptr<mtea::block_interface> operator()(const size_t size) {
+        if (size == 0) {
+            throw mtea::block_error("filter must have at least one section");
+        }
+
+        return std::make_unique<biquad_wrapper>(size);
+    }
+};
+
+template <mtea::DataType DT>
+struct DelayNBlockFunctor {
+    class delay_wrapper final : public mtea::delay_n_block_dynamic<DT> {
+        using data_t = typename mtea::type_info<DT>::type_t;
+
+    public:
+        delay_wrapper(const size_t size) : data(std::unique_ptr<data_t[]>(new data_t[size]())) {
+            this->buffer = data.get();
+            this->delay_num = size;
+        }
+
+        std::unique_ptr<mtea::block_interface> clone() const override {
+            auto blk = std::make_unique<delay_wrapper>(this->delay_num);
+            blk->copy_from(*this);
+            return blk;
+        }
+
+    private:
+        std::unique_ptr<data_t[]> data;
+    };
+
+    std::unique_ptr<mtea::block_interface> operator()(const size_t size) {
+        if (size == 0) {
+            throw mtea::block_error("delay must be at least one step");
+        }
+
+        return std::make_unique<delay_wrapper>(size);
+    }
+};
+
+template <mtea::DataType DT>
+struct TransportDelayBlockFunctor {
+    class delay_wrapper final : public mtea::transport_delay_block_dynamic<DT> {
+        using data_t = typename mtea::type_info<DT>::type_t;
+
+    public:
+        delay_wrapper(const size_t size) : data(std::unique_ptr<data_t[]>(new data_t[size]())), time_data(std::unique_ptr<double[]>(new double[size]())) {
+            this->buffer = data.get();
+            this->times = time_data.get();
+            this->capacity = size;
+        }
+
+        std::unique_ptr<mtea::block_interface> clone() const override {
+            auto blk = std::make_unique<delay_wrapper>(this->capacity);
+            blk->copy_from(*this);
+            return blk;
+        }
+
+    private:
+        std::unique_ptr<data_t[]> data;
+        std::unique_ptr<double[]> time_data;
+    };
+
+    std::unique_ptr<mtea::block_interface> operator()(const size_t size) {
+        if (size == 0) {
+            throw mtea::block_error("delay buffer must not be empty");
+        }
+
+        return std::make_unique<delay_wrapper>(size);
+    }
+};
+
+template <mtea::DataType DT>
+struct TransferFunctionBlockFunctor {
+    class transfer_function_wrapper final : public mtea::transfer_function_block_dynamic<DT> {
+        using data_t = typename mtea::type_info<DT>::type_t;
+
+    public:
+        transfer_function_wrapper(const size_t size) : data(std::unique_ptr<data_t[]>(new data_t[3 * size + 1]())) {
+            this->numerator = data.get();
+            this->denominator = data.get() + size + 1;
+            this->states = data.get() + 2 * size + 1;
+            this->order = size;
+            this->numerator[0] = 1;
+        }
+
+        std::unique_ptr<mtea::block_interface> clone() const override {
+            auto blk = std::make_unique<transfer_function_wrapper>(this->order);
+            blk->copy_from(*this);
+            return blk;
+        }
+
+    private:
+        std::unique_ptr<data_t[]> data;
+    };
+
+    std::unique_ptr<mtea::block_interface> operator()(const size_t size) {
+        return std::make_unique<transfer_function_wrapper>(size);
+    }
+};
+
+template <mtea::DataType DT>
+struct PidBankBlockFunctor {
+    class pid_bank_wrapper final : public mtea::pid_bank_block_dynamic<DT> {
+        using data_t = typename mtea::type_info<DT>::type_t;
+
+    public:
+        pid_bank_wrapper(const size_t size) : data(std::unique_ptr<data_t[]>(new data_t[5 * size]())) {
+            this->s_in.errors = data.get();
+            this->s_in.size = size;
+            this->s_out.values = data.get() + size;
+            this->s_out.size = size;
+            this->integrals = data.get() + 2 * size;
+            this->derivatives = data.get() + 3 * size;
+            this->prev_errors = data.get() + 4 * size;
+        }
+
+        std::unique_ptr<mtea::block_interface> clone() const override {
+            auto blk = std::make_unique<pid_bank_wrapper>(this->s_out.size);
+            blk->copy_from(*this);
+            return blk;
+        }
+
+    private:
+        std::unique_ptr<data_t[]> data;
+    };
+
+    std::unique_ptr<mtea::block_interface> operator()(const size_t size) {
+        if (size == 0) {
+            throw mtea::block_error("bank must contain at least one controller");
+        }
+
+        return std::make_unique<pid_bank_wrapper>(size);
+    }
+};
+
+template <mtea::DataType DT>
+struct NoiseBlockFunctor {
+    std::unique_ptr<mtea::block_interface> operator()(std::string_view name, const uint64_t seed) {
+        if (name == mtea::BLK_NAME_UNIFORM_NOISE) {
+            return std::make_unique<mtea::uniform_noise_block<DT>>(seed);
+        } else if (name == mtea::BLK_NAME_GAUSSIAN_NOISE) {
+            return std::make_unique<mtea::gaussian_noise_block<DT>>(seed);
+        } else {
+            throw mtea::block_error((std::ostringstream{} << "unknown noise block name '" << name << "' provided").str());
+        }
+    }
+};
+
+template <mtea::DataType DT>
+struct SineBankBlockFunctor {
+    class sine_bank_wrapper final : public mtea::sine_bank_block_dynamic<DT> {
+        using data_t = typename mtea::type_info<DT>::type_t;
+
+    public:
+        sine_bank_wrapper(const size_t size) : data(std::unique_ptr<data_t[]>(new data_t[8 * size]())) {
+            this->s_out.values = data.get();
+            this->s_out.size = size;
+            this->frequencies = data.get() + size;
+            this->amplitudes = data.get() + 2 * size;
+            this->phases = data.get() + 3 * size;
+            this->cos_values = data.get() + 4 * size;
+            this->sin_values = data.get() + 5 * size;
+            this->rotation_cos = data.get() + 6 * size;
+            this->rotation_sin = data.get() + 7 * size;
+
+            std::fill(this->frequencies, this->frequencies + size, data_t(1));
+            std::fill(this->amplitudes, this->amplitudes + size, data_t(1));
+        }
+
+        std::unique_ptr<mtea::block_interface> clone() const override {
+            auto blk = std::make_unique<sine_bank_wrapper>(this->s_out.size);
+            blk->copy_from(*this);
+            return blk;
+        }
+
+    private:
+        std::unique_ptr<data_t[]> data;
+    };
+
+    std::unique_ptr<mtea::block_interface> operator()(const size_t size) {
+        if (size == 0) {
+            throw mtea::block_error("bank must contain at least one generator");
+        }
+
+        return std::make_unique<sine_bank_wrapper>(size);
+    }
+};
+
+template <mtea::DataType DT>
+struct RunningStatsBankBlockFunctor {
+    class stats_bank_wrapper final : public mtea::running_stats_bank_block_dynamic<DT> {
+        using data_t = typename mtea::type_info<DT>::type_t;
+        using stat_t = typename mtea::statistics_type<DT>::type_t;
+
+    public:
+        stats_bank_wrapper(const size_t size) : data(std::unique_ptr<data_t[]>(new data_t[3 * size]())), stats(std::unique_ptr<stat_t[]>(new stat_t[5 * size]())) {
+            this->s_in.values = data.get();
+            this->s_in.size = size;
+            this->s_out.mins = data.get() + size;
+            this->s_out.maxs = data.get() + 2 * size;
+            this->s_out.means = stats.get();
+            this->s_out.variances = stats.get() + size;
+            this->s_out.rms = stats.get() + 2 * size;
+            this->s_out.size = size;
+            this->m2s = stats.get() + 3 * size;
+            this->mean_sqs = stats.get() + 4 * size;
+        }
+
+        std::unique_ptr<mtea::block_interface> clone() const override {
+            auto blk = std::make_unique<stats_bank_wrapper>(this->s_out.size);
+            blk->copy_from(*this);
+            return blk;
+        }
+
+    private:
+        std::unique_ptr<data_t[]> data;
+        std::unique_ptr<stat_t[]> stats;
+    };
+
+    std::unique_ptr<mtea::block_interface> operator()(const size_t size) {
+        if (size == 0) {
+            throw mtea::block_error("bank must contain at least one signal");
+        }
+
+        return std::make_unique<stats_bank_wrapper>(size);
+    }
+};
+
+template <mtea::DataType DT>
+struct MovingAverageBlockFunctor {
+    class moving_average_wrapper final : public mtea::moving_average_block_dynamic<DT> {
+        using data_t = typename mtea::type_info<DT>::type_t;
+
+    public:
+        moving_average_wrapper(const size_t size) : data(std::unique_ptr<data_t[]>(new data_t[size]())) {
+            this->window = data.get();
+            this->window_size = size;
+        }
+
+        std::unique_ptr<mtea::block_interface> clone() const override {
+            auto blk = std::make_unique<moving_average_wrapper>(this->window_size);
+            blk->copy_from(*this);
+            return blk;
+        }
+
+    private:
+        std::unique_ptr<data_t[]> data;
+    };
+
+    std::unique_ptr<mtea::block_interface> operator()(const size_t size) {
+        if (size == 0) {
+            throw mtea::block_error("window must contain at least one value");
+        }
+
+        return std::make_unique<moving_average_wrapper>(size);
+    }
+};
+
+template <mtea::DataType DT>
+struct OrderStatisticBlockFunctor {
+    class order_statistic_wrapper final : public mtea::order_statistic_block_dynamic<DT> {
+        using data_t = typename mtea::type_info<DT>::type_t;
+
+    public:
+        order_statistic_wrapper(const size_t size) : data(std::unique_ptr<data_t[]>(new data_t[size]())), indices(std::unique_ptr<size_t[]>(new size_t[3 * size]())), flags(std::unique_ptr<bool[]>(new bool[size]())) {
+            this->values = data.get();
+            this->low_heap = indices.get();
+            this->high_heap = indices.get() + size;
+            this->positions = indices.get() + 2 * size;
+            this->in_low = flags.get();
+            this->window_size = size;
+        }
+
+        std::unique_ptr<mtea::block_interface> clone() const override {
+            auto blk = std::make_unique<order_statistic_wrapper>(this->window_size);
+            blk->copy_from(*this);
+            return blk;
+        }
+
+    private:
+        std::unique_ptr<data_t[]> data;
+        std::unique_ptr<size_t[]> indices;
+        std::unique_ptr<bool[]> flags;
+    };
+
+    std::unique_ptr<mtea::block_interface> operator()(const size_t size) {
+        if (size == 0) {
+            throw mtea::block_error("window must contain at least one value");
+        }
+
+        return std::make_unique<order_statistic_wrapper>(size);
+    }
+};
+
+template <mtea::DataType DT>
+struct SpectrumBlockFunctor {
+    class spectrum_wrapper final : public mtea::spectrum_block_dynamic<DT> {
+        using data_t = typename mtea::type_info<DT>::type_t;
+
+    public:
+        spectrum_wrapper(const size_t size) : data(std::unique_ptr<data_t[]>(new data_t[6 * size + 2]())) {
+            this->hop = size;
+            this->size = size;
+            this->history = data.get();
+            this->window = data.get() + size;
+            this->work_re = data.get() + 2 * size;
+            this->work_im = data.get() + 3 * size;
+            this->cos_table = data.get() + 4 * size;
+            this->sin_table = data.get() + 4 * size + size / 2;
+            this->s_out.bin_num = size / 2 + 1;
+            this->s_out.magnitudes = data.get() + 5 * size;
+            this->s_out.phases = data.get() + 5 * size + this->s_out.bin_num;
+        }
+
+        std::unique_ptr<mtea::block_interface> clone() const override {
+            auto blk = std::make_unique<spectrum_wrapper>(this->size);
+            blk->copy_from(*this);
+            return blk;
+        }
+
+    private:
+        std::unique_ptr<data_t[]> data;
+    };
+
+    std::unique_ptr<mtea::block_interface> operator()(const size_t size) {
+        if (size < 2 || (size & (size - 1)) != 0) {
+            throw mtea::block_error("spectrum size must be a power of two");
+        }
+
+        return std::make_unique<spectrum_wrapper>(size);
+    }
+};
+
 template <template <mtea::DataType> class FCN, bool USE_INTEG, bool USE_FLOAT, bool USE_OTHER, typename... Args>
 static std::unique_ptr<mtea::block_interface> create_block_with_type_inner(const mtea::DataType data_type, Args&&... args) {
     using namespace mtea;
@@ -557,6 +1024,86 @@ static std::unique_ptr<mtea::block_interface> create_double_dt_block(mtea::DataT
     }
 }
 
+template <mtea::DataType DT>
+struct SpecializedBlockFunctor {
+    using data_t = typename mtea::type_info<DT>::type_t;
+    using const_inputs_t = std::span<const mtea::Argument* const>;
+
+    template <mtea::ArithType AT>
+    static std::unique_ptr<mtea::block_interface> specialize_arith(const mtea::block_interface& blk, const_inputs_t c) {
+        if (dynamic_cast<const mtea::arith_block_dynamic<DT, AT>*>(&blk) == nullptr || c.size() != 2) {
+            return nullptr;
+        }
+
+        if (c[0] == nullptr && c[1] != nullptr) {
+            return std::make_unique<mtea::arith_block_const<DT, AT>>(c[1]);
+        } else if (c[0] != nullptr && c[1] == nullptr && (AT == mtea::ArithType::ADD || AT == mtea::ArithType::MUL)) {
+            return std::make_unique<mtea::arith_block_const<DT, AT>>(c[0]);
+        } else {
+            return nullptr;
+        }
+    }
+
+    template <mtea::RelationalOperator OP>
+    static std::unique_ptr<mtea::block_interface> specialize_relational(const mtea::block_interface& blk, const_inputs_t c) {
+        if (dynamic_cast<const mtea::relational_block<DT, OP>*>(&blk) != nullptr && c[0] == nullptr && c[1] != nullptr) {
+            return std::make_unique<mtea::relational_block_const<DT, OP>>(c[1]);
+        } else {
+            return nullptr;
+        }
+    }
+
+    std::unique_ptr<mtea::block_interface> operator()(const mtea::block_interface& blk, const_inputs_t c) {
+        using namespace mtea;
+
+        std::unique_ptr<block_interface> ptr = nullptr;
+
+        if constexpr (type_info<DT>::is_numeric) {
+            for (const auto& fcn : {
+                     specialize_arith<ArithType::ADD>,
+                     specialize_arith<ArithType::SUB>,
+                     specialize_arith<ArithType::MUL>,
+                     specialize_arith<ArithType::DIV>,
+                     specialize_arith<ArithType::MOD>,
+                     specialize_relational<RelationalOperator::GREATER_THAN>,
+                     specialize_relational<RelationalOperator::GREATER_THAN_EQUAL>,
+                     specialize_relational<RelationalOperator::LESS_THAN>,
+                     specialize_relational<RelationalOperator::LESS_THAN_EQUAL>,
+                 }) {
+                if (ptr == nullptr) {
+                    ptr = fcn(blk, c);
+                }
+            }
+
+            if (dynamic_cast<const limiter_block<DT>*>(&blk) != nullptr && c[0] == nullptr && c[1] != nullptr && c[2] != nullptr) {
+                ptr = std::make_unique<limiter_block_const<DT>>(c[1], c[2]);
+            }
+        }
+
+        for (const auto& fcn : {
+                 specialize_relational<RelationalOperator::EQUAL>,
+                 specialize_relational<RelationalOperator::NOT_EQUAL>,
+             }) {
+            if (ptr == nullptr) {
+                ptr = fcn(blk, c);
+            }
+        }
+
+        if (dynamic_cast<const delay_block<DT>*>(&blk) != nullptr && c[0] == nullptr && c[1] != nullptr && c[2] == nullptr) {
+            ptr = std::make_unique<delay_block_const<DT>>(c[1]);
+        }
+
+        if constexpr (type_info<DT>::is_float) {
+            if (const auto integ = dynamic_cast<const integrator_block<DT>*>(&blk); integ != nullptr && c[0] == nullptr && c[1] != nullptr && c[2] == nullptr) {
+                const ArgumentBox<DT> dt(static_cast<data_t>(integ->time_step));
+                ptr = std::make_unique<integrator_block_const<DT>>(c[1], &dt);
+            }
+        }
+
+        return ptr;
+    }
+};
+
 std::unique_ptr<mtea::block_interface> mtea::create_block(
     const std::string& name,
     std::span<const DataType> data_types,
@@ -588,7 +1135,36 @@ std::unique_ptr<mtea::block_interface> mtea::create_block(
 
             const size_t size = argument->as_size();
 
-            return create_block_with_type_inner<ArithmeticBlockFunctor, true, true, false>(data_type, name, size);
+            if (info.name == BLK_NAME_RECORDER) {
+                return create_block_with_type_inner<RecorderBlockFunctor, true, true, true>(data_type, size);
+            } else if (info.name == BLK_NAME_DELAY_N) {
+                return create_block_with_type_inner<DelayNBlockFunctor, true, true, true>(data_type, size);
+            } else if (info.name == BLK_NAME_TRANSPORT_DELAY) {
+                return create_block_with_type_inner<TransportDelayBlockFunctor, false, true, false>(data_type, size);
+            } else if (info.name == BLK_NAME_TRANSFER_FCN) {
+                return create_block_with_type_inner<TransferFunctionBlockFunctor, false, true, false>(data_type, size);
+            } else if (info.name == BLK_NAME_STATS_BANK) {
+                return create_block_with_type_inner<RunningStatsBankBlockFunctor, true, true, false>(data_type, size);
+            } else if (info.name == BLK_NAME_MOVING_AVERAGE) {
+                return create_block_with_type_inner<MovingAverageBlockFunctor, true, true, false>(data_type, size);
+            } else if (info.name == BLK_NAME_ORDER_STATISTIC) {
+                return create_block_with_type_inner<OrderStatisticBlockFunctor, true, true, false>(data_type, size);
+            } else if (info.name == BLK_NAME_SPECTRUM) {
+                return create_block_with_type_inner<SpectrumBlockFunctor, false, true, false>(data_type, size);
+            } else if (info.name == BLK_NAME_SINE_BANK) {
+                return create_block_with_type_inner<SineBankBlockFunctor, false, true, false>(data_type, size);
+            } else if (info.name == BLK_NAME_PID_BANK) {
+                return create_block_with_type_inner<PidBankBlockFunctor, false, true, false>(data_type, size);
+            } else if (info.name == BLK_NAME_FIR) {
+                return create_block_with_type_inner<FirBlockFunctor, false, true, false>(data_type, size);
+            } else if (info.name == BLK_NAME_BIQUAD) {
+                return create_block_with_type_inner<BiquadBlockFunctor, false, true, false>(data_type, size);
+            } else {
+                return create_block_with_type_inner<ArithmeticBlockFunctor, true, true, false>(data_type, name, size);
+            }
+        } else if (info.constructor_dynamic == BlockInformation::ConstructorOptions::SEED) {
+            const uint64_t seed = argument != nullptr ? argument->as_size() : 0;
+            return create_block_with_type_inner<NoiseBlockFunctor, false, true, false>(data_type, name, seed);
         } else if (info.constructor_dynamic == BlockInformation::ConstructorOptions::NONE) {
             return StandardBlockFunctor()(data_type, name);
         } else {
@@ -612,4 +1188,86 @@ std::unique_ptr<mtea::block_interface> mtea::create_block(
     return create_block(info.name, data_types, argument);
 }
 
+std::unique_ptr<mtea::Argument> mtea::create_argument(const DataType data_type) {
+    switch (data_type) {
+        using enum DataType;
+    case U8:
+        return std::make_unique<ArgumentBox<U8>>();
+    case I8:
+        return std::make_unique<ArgumentBox<I8>>();
+    case U16:
+        return std::make_unique<ArgumentBox<U16>>();
+    case I16:
+        return std::make_unique<ArgumentBox<I16>>();
+    case U32:
+        return std::make_unique<ArgumentBox<U32>>();
+    case I32:
+        return std::make_unique<ArgumentBox<I32>>();
+    case U64:
+        return std::make_unique<ArgumentBox<U64>>();
+    case I64:
+        return std::make_unique<ArgumentBox<I64>>();
+    case F32:
+        return std::make_unique<ArgumentBox<F32>>();
+    case F64:
+        return std::make_unique<ArgumentBox<F64>>();
+    case BOOL:
+        return std::make_unique<ArgumentBox<BOOL>>();
+    default:
+        throw block_error("unknown data type provided");
+    }
+}
+
+std::unique_ptr<mtea::block_interface> mtea::create_const_block(const block_interface& blk, const size_t port_num) {
+    const auto data_type = blk.get_output_type(port_num);
+    const auto value = create_argument(data_type);
+
+    blk.get_output(port_num, value.get());
+
+    const auto types = std::to_array({data_type});
+    return create_block(BLK_NAME_CONST, types, value.get());
+}
+
+std::unique_ptr<mtea::block_interface> mtea::create_specialized_block(
+    const block_interface& blk,
+    std::span<const Argument* const> const_inputs) {
+    if (const_inputs.size() != blk.get_input_num()) {
+        throw block_error("mismatch in constant input count");
+    }
+
+    for (size_t i = 0; i < const_inputs.size(); ++i) {
+        if (const_inputs[i] != nullptr && const_inputs[i]->get_type() != blk.get_input_type(i)) {
+            throw block_error("constant input type does not match port type");
+        }
+    }
+
+    switch (blk.get_current_type()) {
+        using enum DataType;
+    case U8:
+        return SpecializedBlockFunctor<U8>()(blk, const_inputs);
+    case I8:
+        return SpecializedBlockFunctor<I8>()(blk, const_inputs);
+    case U16:
+        return SpecializedBlockFunctor<U16>()(blk, const_inputs);
+    case I16:
+        return SpecializedBlockFunctor<I16>()(blk, const_inputs);
+    case U32:
+        return SpecializedBlockFunctor<U32>()(blk, const_inputs);
+    case I32:
+        return SpecializedBlockFunctor<I32>()(blk, const_inputs);
+    case U64:
+        return SpecializedBlockFunctor<U64>()(blk, const_inputs);
+    case I64:
+        return SpecializedBlockFunctor<I64>()(blk, const_inputs);
+    case F32:
+        return SpecializedBlockFunctor<F32>()(blk, const_inputs);
+    case F64:
+        return SpecializedBlockFunctor<F64>()(blk, const_inputs);
+    case BOOL:
+        return SpecializedBlockFunctor<BOOL>()(blk, const_inputs);
+    default:
+        return nullptr;
+    }
+}
+
 #endif // MTEA_USE_FULL_LIB
@@ -0,0 +1,274 @@
+// SPDX-License-Identifier: MIT
+
+#ifdef MTEA_USE_FULL_LIB
+
+#include "mtea_csv.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+
+static const size_t CSV_READ_SIZE = 1 << 16;
+
+static std::string_view trim_field(std::string_view field) {
+    while (!field.empty() && (field.front() == ' ' || field.front() == '\t')) {
+        field.remove_prefix(1);
+    }
+
+    while (!field.empty() && (field.back() == ' ' || field.back() == '\t')) {
+        field.remove_suffix(1);
+    }
+
+    return field;
+}
+
+template <mtea::DataType DT>
+static bool parse_value(std::string_view field, std::byte* dst) {
+    using data_t = typename mtea::type_info<DT>::type_t;
+    data_t value{};
+
+    if constexpr (DT == mtea::DataType::BOOL) {
+        if (field == "1" || field == "true") {
+            value = true;
+        } else if (field == "0" || field == "false") {
+            value = false;
+        } else {
+            return false;
+        }
+    } else {
+        if (!field.empty() && field.front() == '+') {
+            field.remove_prefix(1);
+        }
+
+        const auto result = std::from_chars(field.data(), field.data() + field.size(), value);
+        if (result.ec != std::errc{} || result.ptr != field.data() + field.size()) {
+            return false;
+        }
+    }
+
+    std::memcpy(dst, &value, sizeof(value));
+    return true;
+}
+
+template <mtea::DataType DT>
+static void add_parser(std::vector<bool (*)(std::string_view, std::byte*)>& parsers, std::vector<size_t>& sizes) {
+    parsers.push_back(&parse_value<DT>);
+    sizes.push_back(sizeof(typename mtea::type_info<DT>::type_t));
+}
+
+mtea::csv_reader::csv_reader(std::istream& stream, std::span<const DataType> column_types, const csv_options& options)
+    : stream(stream),
+      options(options),
+      column_types(column_types.begin(), column_types.end()),
+      text_offset(0),
+      line_num(0),
+      row_num(0) {
+    if (options.chunk_rows == 0) {
+        throw block_error("csv chunk size must be greater than zero");
+    }
+
+    for (const auto dt : column_types) {
+        switch (dt) {
+        case DataType::BOOL:
+            add_parser<DataType::BOOL>(parsers, value_sizes);
+            break;
+        case DataType::U8:
+            add_parser<DataType::U8>(parsers, value_sizes);
+            break;
+        case DataType::I8:
+            add_parser<DataType::I8>(parsers, value_sizes);
+            break;
+        case DataType::U16:
+            add_parser<DataType::U16>(parsers, value_sizes);
+            break;
+        case DataType::I16:
+            add_parser<DataType::I16>(parsers, value_sizes);
+            break;
+        case DataType::U32:
+            add_parser<DataType::U32>(parsers, value_sizes);
+            break;
+        case DataType::I32:
+            add_parser<DataType::I32>(parsers, value_sizes);
+            break;
+        case DataType::U64:
+            add_parser<DataType::U64>(parsers, value_sizes);
+            break;
+        case DataType::I64:
+            add_parser<DataType::I64>(parsers, value_sizes);
+            break;
+        case DataType::F32:
+            add_parser<DataType::F32>(parsers, value_sizes);
+            break;
+        case DataType::F64:
+            add_parser<DataType::F64>(parsers, value_sizes);
+            break;
+        default:
+            throw block_error("csv column must have a valid data type");
+        }
+    }
+
+    for (auto* c : {&current, &pending}) {
+        c->columns.resize(column_types.size());
+        for (size_t i = 0; i < column_types.size(); ++i) {
+            c->columns[i].resize(options.chunk_rows * value_sizes[i]);
+        }
+    }
+
+    if (options.has_header) {
+        std::string_view line;
+        while (next_line(line)) {
+            if (trim_field(line).empty()) {
+                continue;
+            }
+
+            size_t start = 0;
+            while (start <= line.size()) {
+                const size_t end = std::min(line.find(options.delimiter, start), line.size());
+                column_names.emplace_back(trim_field(line.substr(start, end - start)));
+                start = end + 1;
+            }
+
+            break;
+        }
+
+        if (!column_names.empty() && column_names.size() != column_types.size()) {
+            throw block_error("mismatch in csv header column count");
+        }
+    }
+
+    start_prefetch();
+}
+
+mtea::csv_reader::~csv_reader() {
+    if (pending_result.valid()) {
+        pending_result.wait();
+    }
+}
+
+bool mtea::csv_reader::next_chunk() {
+    if (pending_result.valid()) {
+        pending_result.get();
+    } else {
+        parse_chunk(pending);
+    }
+
+    std::swap(current, pending);
+
+    if (current.row_num == 0) {
+        return false;
+    }
+
+    start_prefetch();
+    return true;
+}
+
+size_t mtea::csv_reader::get_column_num() const noexcept {
+    return column_types.size();
+}
+
+const std::vector<std::string>& mtea::csv_reader::get_column_names() const noexcept {
+    return column_names;
+}
+
+size_t mtea::csv_reader::get_row_num() const noexcept {
+    return current.row_num;
+}
+
+size_t mtea::csv_reader::get_start_row() const noexcept {
+    return current.start_row;
+}
+
+bool mtea::csv_reader::fill() {
+    const size_t keep = text.size() - text_offset;
+    if (keep > 0 && text_offset > 0) {
+        std::memmove(text.data(), text.data() + text_offset, keep);
+    }
+
+    text.resize(keep + CSV_READ_SIZE);
+    stream.read(text.data() + keep, CSV_READ_SIZE);
+
+    const auto read_num = static_cast<size_t>(stream.gcount());
+    text.resize(keep + read_num);
+    text_offset = 0;
+
+    return read_num > 0;
+}
+
+bool mtea::csv_reader::next_line(std::string_view& line) {
+    while (true) {
+        const char* begin = text.data() + text_offset;
+        const size_t remaining = text.size() - text_offset;
+
+        const auto* nl = remaining > 0 ? static_cast<const char*>(std::memchr(begin, '\n', remaining)) : nullptr;
+
+        if (nl != nullptr) {
+            line = std::string_view(begin, static_cast<size_t>(nl - begin));
+            text_offset += line.size() + 1;
+        } else if (fill()) {
+            continue;
+        } else if (remaining > 0) {
+            line = std::string_view(text.data() + text_offset, text.size() - text_offset);
+            text_offset = text.size();
+        } else {
+            return false;
+        }
+
+        if (!line.empty() && line.back() == '\r') {
+            line.remove_suffix(1);
+        }
+
+        line_num += 1;
+        return true;
+    }
+}
+
+void mtea::csv_reader::parse_line(std::string_view line, chunk& c) {
+    size_t start = 0;
+
+    for (size_t i = 0; i < parsers.size(); ++i) {
+        if (start > line.size()) {
+            throw block_error("missing csv column on line " + std::to_string(line_num));
+        }
+
+        size_t end = line.find(options.delimiter, start);
+        if (end == std::string_view::npos) {
+            end = line.size();
+        }
+
+        std::byte* dst = c.columns[i].data() + c.row_num * value_sizes[i];
+        if (!parsers[i](trim_field(line.substr(start, end - start)), dst)) {
+            throw block_error("unable to parse csv column " + std::to_string(i) + " on line " + std::to_string(line_num));
+        }
+
+        start = end + 1;
+    }
+
+    if (start <= line.size()) {
+        throw block_error("too many csv columns on line " + std::to_string(line_num));
+    }
+}
+
+void mtea::csv_reader::parse_chunk(chunk& c) {
+    c.row_num = 0;
+    c.start_row = row_num;
+
+    std::string_view line;
+    while (c.row_num < options.chunk_rows && next_line(line)) {
+        if (trim_field(line).empty()) {
+            continue;
+        }
+
+        parse_line(line, c);
+        c.row_num += 1;
+    }
+
+    row_num += c.row_num;
+}
+
+void mtea::csv_reader::start_prefetch() {
+    if (options.prefetch) {
+        pending_result = std::async(std::launch::async, [this]() { parse_chunk(pending); });
+    }
+}
+
+#endif // MTEA_USE_FULL_LIB
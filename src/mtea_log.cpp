@@ -0,0 +1,532 @@
+// SPDX-License-Identifier: MIT
+
+#ifdef MTEA_USE_FULL_LIB
+
+#include "mtea_log.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define MTEA_LOG_USE_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+struct log_header {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t signal_num;
+    uint32_t chunk_size;
+};
+
+struct log_chunk_header {
+    uint32_t magic;
+    uint32_t sample_num;
+    uint64_t start_step;
+};
+
+static size_t get_value_width(const mtea::DataType dt) {
+    switch (dt) {
+        case mtea::DataType::F32:
+            return sizeof(float);
+        case mtea::DataType::F64:
+            return sizeof(double);
+        default:
+            return 0;
+    }
+}
+
+template <typename T>
+static void append_value(std::vector<std::byte>& out, const T& value) {
+    const auto* ptr = reinterpret_cast<const std::byte*>(&value);
+    out.insert(out.end(), ptr, ptr + sizeof(value));
+}
+
+static void append_varint(std::vector<std::byte>& out, uint64_t value) {
+    while (value >= 0x80) {
+        out.push_back(static_cast<std::byte>((value & 0x7f) | 0x80));
+        value >>= 7;
+    }
+
+    out.push_back(static_cast<std::byte>(value));
+}
+
+static void encode_bool(std::vector<std::byte>& out, std::span<const uint64_t> values) {
+    for (size_t i = 0; i < values.size(); i += 8) {
+        uint8_t packed = 0;
+        for (size_t j = i; j < std::min(i + 8, values.size()); ++j) {
+            packed |= static_cast<uint8_t>((values[j] & 1) << (j - i));
+        }
+        out.push_back(static_cast<std::byte>(packed));
+    }
+}
+
+static void encode_integral(std::vector<std::byte>& out, std::span<const uint64_t> values) {
+    uint64_t prev = 0;
+
+    for (const auto v : values) {
+        const auto delta = static_cast<int64_t>(v - prev);
+        append_varint(out, (static_cast<uint64_t>(delta) << 1) ^ static_cast<uint64_t>(delta >> 63));
+        prev = v;
+    }
+}
+
+// Returns the control nibble for an XOR value, which is either the number of low bytes kept, or eight plus the number
+// of high bytes kept when the value has more trailing than leading zero bytes
+static uint8_t float_control(const uint64_t x, const size_t width) {
+    if (x == 0) {
+        return 0;
+    }
+
+    const size_t lead = static_cast<size_t>(std::countl_zero(x)) / 8 - (8 - width);
+    const size_t trail = static_cast<size_t>(std::countr_zero(x)) / 8;
+
+    if (lead >= trail) {
+        return static_cast<uint8_t>(width - lead);
+    } else {
+        return static_cast<uint8_t>(8 + width - trail);
+    }
+}
+
+static void append_float_bytes(std::vector<std::byte>& out, const uint64_t x, const uint8_t control, const size_t width) {
+    if (control <= 8) {
+        for (size_t i = 0; i < control; ++i) {
+            out.push_back(static_cast<std::byte>(x >> (8 * i)));
+        }
+    } else {
+        const size_t num = control - 8;
+        for (size_t i = width - num; i < width; ++i) {
+            out.push_back(static_cast<std::byte>(x >> (8 * i)));
+        }
+    }
+}
+
+static void encode_float(std::vector<std::byte>& out, std::span<const uint64_t> values, const size_t width) {
+    uint64_t prev = 0;
+
+    for (size_t i = 0; i < values.size(); i += 2) {
+        const uint64_t x0 = values[i] ^ prev;
+        prev = values[i];
+
+        uint64_t x1 = 0;
+        if (i + 1 < values.size()) {
+            x1 = values[i + 1] ^ prev;
+            prev = values[i + 1];
+        }
+
+        const uint8_t c0 = float_control(x0, width);
+        const uint8_t c1 = float_control(x1, width);
+
+        out.push_back(static_cast<std::byte>(c0 | (c1 << 4)));
+        append_float_bytes(out, x0, c0, width);
+        append_float_bytes(out, x1, c1, width);
+    }
+}
+
+class column_decoder {
+public:
+    column_decoder(std::span<const std::byte> data) : data(data), offset(0) {}
+
+    uint8_t next_byte() {
+        if (offset >= data.size()) {
+            throw mtea::block_error("log column data truncated");
+        }
+
+        return static_cast<uint8_t>(data[offset++]);
+    }
+
+    uint64_t next_varint() {
+        uint64_t value = 0;
+
+        for (size_t shift = 0; shift < 64; shift += 7) {
+            const uint8_t b = next_byte();
+            value |= static_cast<uint64_t>(b & 0x7f) << shift;
+
+            if ((b & 0x80) == 0) {
+                return value;
+            }
+        }
+
+        throw mtea::block_error("invalid log varint");
+    }
+
+    uint64_t next_float_bytes(const uint8_t control, const size_t width) {
+        uint64_t x = 0;
+
+        if (control <= 8) {
+            if (control > width) {
+                throw mtea::block_error("invalid log float control");
+            }
+
+            for (size_t i = 0; i < control; ++i) {
+                x |= static_cast<uint64_t>(next_byte()) << (8 * i);
+            }
+        } else {
+            const size_t num = control - 8;
+            if (num >= width) {
+                throw mtea::block_error("invalid log float control");
+            }
+
+            for (size_t i = width - num; i < width; ++i) {
+                x |= static_cast<uint64_t>(next_byte()) << (8 * i);
+            }
+        }
+
+        return x;
+    }
+
+private:
+    std::span<const std::byte> data;
+    size_t offset;
+};
+
+// Decodes the first num values of a column, storing those from skip onwards into values
+static void decode_column(std::span<const std::byte> data, const mtea::DataType dt, const size_t num, const size_t skip, uint64_t* values) {
+    column_decoder dec(data);
+
+    if (dt == mtea::DataType::BOOL) {
+        uint8_t packed = 0;
+        for (size_t i = 0; i < num; ++i) {
+            if (i % 8 == 0) {
+                packed = dec.next_byte();
+            }
+            if (i >= skip) {
+                values[i - skip] = (packed >> (i % 8)) & 1;
+            }
+        }
+    } else if (const size_t width = get_value_width(dt); width > 0) {
+        uint64_t prev = 0;
+        uint8_t control = 0;
+
+        for (size_t i = 0; i < num; ++i) {
+            if (i % 2 == 0) {
+                control = dec.next_byte();
+            } else {
+                control >>= 4;
+            }
+
+            prev ^= dec.next_float_bytes(control & 0xf, width);
+            if (i >= skip) {
+                values[i - skip] = prev;
+            }
+        }
+    } else {
+        uint64_t prev = 0;
+
+        for (size_t i = 0; i < num; ++i) {
+            const uint64_t zz = dec.next_varint();
+            prev += (zz >> 1) ^ (~(zz & 1) + 1);
+            if (i >= skip) {
+                values[i - skip] = prev;
+            }
+        }
+    }
+}
+
+mtea::log_writer::log_writer(std::ostream& stream, std::span<const log_signal> signals, const size_t chunk_size)
+    : stream(stream),
+      signals(signals.begin(), signals.end()),
+      chunk_size(chunk_size),
+      columns(signals.size()),
+      chunk_steps(0),
+      step_num(0) {
+    if (chunk_size == 0) {
+        throw block_error("log chunk size must be greater than zero");
+    }
+
+    std::vector<std::byte> header_data;
+
+    const log_header header{
+        .magic = MAGIC,
+        .version = VERSION,
+        .signal_num = static_cast<uint32_t>(signals.size()),
+        .chunk_size = static_cast<uint32_t>(chunk_size),
+    };
+    append_value(header_data, header);
+
+    for (const auto& s : signals) {
+        if (s.type == DataType::NONE) {
+            throw block_error("log signal must have a valid data type");
+        }
+
+        append_value(header_data, static_cast<uint32_t>(s.type));
+        append_value(header_data, static_cast<uint32_t>(s.name.size()));
+        const auto* name_ptr = reinterpret_cast<const std::byte*>(s.name.data());
+        header_data.insert(header_data.end(), name_ptr, name_ptr + s.name.size());
+    }
+
+    stream.write(reinterpret_cast<const char*>(header_data.data()), static_cast<std::streamsize>(header_data.size()));
+
+    for (auto& c : columns) {
+        c.reserve(chunk_size);
+    }
+}
+
+mtea::log_writer::~log_writer() {
+    try {
+        flush();
+    } catch (const std::exception&) {
+        // Errors can only be reported by calling flush() before destruction
+    }
+}
+
+void mtea::log_writer::end_step() {
+    for (const auto& c : columns) {
+        if (c.size() != chunk_steps + 1) {
+            throw block_error("log step must contain exactly one value for each signal");
+        }
+    }
+
+    chunk_steps += 1;
+    step_num += 1;
+
+    if (chunk_steps >= chunk_size) {
+        write_chunk();
+    }
+}
+
+void mtea::log_writer::flush() {
+    if (chunk_steps > 0) {
+        write_chunk();
+    }
+
+    stream.flush();
+}
+
+size_t mtea::log_writer::get_step_num() const noexcept {
+    return step_num;
+}
+
+void mtea::log_writer::write_chunk() {
+    encoded.clear();
+
+    const log_chunk_header header{
+        .magic = CHUNK_MAGIC,
+        .sample_num = static_cast<uint32_t>(chunk_steps),
+        .start_step = step_num - chunk_steps,
+    };
+    append_value(encoded, header);
+
+    const size_t table_offset = encoded.size();
+    encoded.resize(table_offset + columns.size() * sizeof(uint32_t));
+
+    for (size_t i = 0; i < columns.size(); ++i) {
+        const std::span<const uint64_t> values(columns[i].data(), chunk_steps);
+        const size_t start = encoded.size();
+
+        if (signals[i].type == DataType::BOOL) {
+            encode_bool(encoded, values);
+        } else if (const size_t width = get_value_width(signals[i].type); width > 0) {
+            encode_float(encoded, values, width);
+        } else {
+            encode_integral(encoded, values);
+        }
+
+        const uint32_t size = static_cast<uint32_t>(encoded.size() - start);
+        std::memcpy(encoded.data() + table_offset + i * sizeof(uint32_t), &size, sizeof(size));
+
+        columns[i].clear();
+    }
+
+    stream.write(reinterpret_cast<const char*>(encoded.data()), static_cast<std::streamsize>(encoded.size()));
+    chunk_steps = 0;
+
+    if (!stream) {
+        throw block_error("unable to write log chunk");
+    }
+}
+
+mtea::log_reader::log_reader(std::span<const std::byte> data) : data(data), step_num(0) {
+    size_t offset = 0;
+
+    auto read_raw = [&data, &offset](void* dst, const size_t size) {
+        if (data.size() - offset < size) {
+            throw block_error("log data truncated");
+        }
+
+        std::memcpy(dst, data.data() + offset, size);
+        offset += size;
+    };
+
+    log_header header{};
+    read_raw(&header, sizeof(header));
+
+    if (header.magic != log_writer::MAGIC) {
+        throw block_error("invalid log data provided");
+    } else if (header.version != log_writer::VERSION) {
+        throw block_error("unsupported log version");
+    }
+
+    for (uint32_t i = 0; i < header.signal_num; ++i) {
+        uint32_t type = 0;
+        uint32_t name_size = 0;
+        read_raw(&type, sizeof(type));
+        read_raw(&name_size, sizeof(name_size));
+
+        // Check the size before allocating, such that a corrupt size cannot request an arbitrarily large name
+        if (name_size > data.size() - offset) {
+            throw block_error("log signal name truncated");
+        }
+
+        std::string name(name_size, '\0');
+        read_raw(name.data(), name_size);
+
+        if (type == static_cast<uint32_t>(DataType::NONE) || type > static_cast<uint32_t>(DataType::F64)) {
+            throw block_error("invalid log signal data type");
+        }
+
+        signals.push_back(log_signal{
+            .name = std::move(name),
+            .type = static_cast<DataType>(type),
+        });
+    }
+
+    while (offset < data.size()) {
+        log_chunk_header chunk{};
+        read_raw(&chunk, sizeof(chunk));
+
+        if (chunk.magic != log_writer::CHUNK_MAGIC || chunk.start_step != step_num) {
+            throw block_error("invalid log chunk");
+        }
+
+        const size_t table_offset = offset;
+        offset += signals.size() * sizeof(uint32_t);
+        if (offset > data.size()) {
+            throw block_error("log data truncated");
+        }
+
+        chunks.push_back(chunk_info{
+            .start_step = chunk.start_step,
+            .sample_num = chunk.sample_num,
+            .column_offset = columns.size(),
+        });
+
+        for (size_t i = 0; i < signals.size(); ++i) {
+            uint32_t size = 0;
+            std::memcpy(&size, data.data() + table_offset + i * sizeof(uint32_t), sizeof(size));
+
+            if (data.size() - offset < size) {
+                throw block_error("log data truncated");
+            }
+
+            columns.push_back(data.subspan(offset, size));
+            offset += size;
+        }
+
+        step_num += chunk.sample_num;
+    }
+}
+
+size_t mtea::log_reader::get_signal_num() const noexcept {
+    return signals.size();
+}
+
+const mtea::log_signal& mtea::log_reader::get_signal(const size_t index) const {
+    if (index >= signals.size()) {
+        throw block_error("log signal index too high");
+    }
+
+    return signals[index];
+}
+
+size_t mtea::log_reader::find_signal(const std::string& name) const {
+    for (size_t i = 0; i < signals.size(); ++i) {
+        if (signals[i].name == name) {
+            return i;
+        }
+    }
+
+    throw block_error("log signal not found");
+}
+
+size_t mtea::log_reader::get_step_num() const noexcept {
+    return step_num;
+}
+
+size_t mtea::log_reader::get_chunk_num() const noexcept {
+    return chunks.size();
+}
+
+size_t mtea::log_reader::read_bits(const size_t index, const size_t start, uint64_t* values, const size_t num) const {
+    if (start >= step_num) {
+        return 0;
+    }
+
+    const auto first = std::upper_bound(chunks.begin(), chunks.end(), start, [](const size_t s, const chunk_info& c) { return s < c.start_step; }) - 1;
+
+    size_t count = 0;
+    for (auto it = first; it != chunks.end() && count < num; ++it) {
+        const size_t step = start + count;
+        const size_t skip = step - it->start_step;
+        const size_t decode_num = std::min(it->sample_num, skip + num - count);
+
+        decode_column(columns[it->column_offset + index], signals[index].type, decode_num, skip, values + count);
+        count += decode_num - skip;
+    }
+
+    return count;
+}
+
+mtea::mapped_file::mapped_file(const std::string& path, const bool sequential) : ptr(nullptr), size(0) {
+#ifdef MTEA_LOG_USE_MMAP
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw block_error("unable to open file");
+    }
+
+    struct stat st{};
+    if (::fstat(fd, &st) != 0) {
+        ::close(fd);
+        throw block_error("unable to read file size");
+    }
+
+    size = static_cast<size_t>(st.st_size);
+
+    if (size > 0) {
+        void* mapped = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd);
+
+        if (mapped == MAP_FAILED) {
+            throw block_error("unable to map file");
+        }
+
+        if (sequential) {
+            ::madvise(mapped, size, MADV_SEQUENTIAL);
+        }
+
+        ptr = static_cast<const std::byte*>(mapped);
+    } else {
+        ::close(fd);
+    }
+#else
+    std::ifstream stream(path, std::ios::binary | std::ios::ate);
+    if (!stream) {
+        throw block_error("unable to open file");
+    }
+
+    fallback.resize(static_cast<size_t>(stream.tellg()));
+    stream.seekg(0);
+    stream.read(reinterpret_cast<char*>(fallback.data()), static_cast<std::streamsize>(fallback.size()));
+
+    ptr = fallback.data();
+    size = fallback.size();
+#endif
+}
+
+mtea::mapped_file::~mapped_file() {
+#ifdef MTEA_LOG_USE_MMAP
+    if (ptr != nullptr) {
+        ::munmap(const_cast<std::byte*>(ptr), size);
+    }
+#endif
+}
+
+std::span<const std::byte> mtea::mapped_file::get_data() const noexcept {
+    return std::span<const std::byte>(ptr, size);
+}
+
+#endif // MTEA_USE_FULL_LIB
@@ -19,6 +19,8 @@ GENERATE_FNS_1(asin)
 GENERATE_FNS_1(acos)
 GENERATE_FNS_1(atan)
 GENERATE_FNS_2(atan2)
+GENERATE_FNS_1(sqrt)
+GENERATE_FNS_1(log)
 
 uint32_t mtea::t_mod(uint32_t x, uint32_t y) { return x % y; }
 int32_t mtea::t_mod(const int32_t x, const int32_t y) { return x % y; }
@@ -0,0 +1,963 @@
+// SPDX-License-Identifier: MIT
+
+#ifdef MTEA_USE_FULL_LIB
+
+#include "mtea_model.hpp"
+
+#include "mtea.hpp"
+#include "mtea_creation.hpp"
+#include "mtea_except.hpp"
+#include "mtea_string.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+
+template <mtea::DataType DT>
+static void load_integrator_state(mtea::block_interface& blk, const double x) {
+    const auto value = static_cast<typename mtea::type_info<DT>::type_t>(x);
+    if (auto* integ = dynamic_cast<mtea::integrator_block<DT>*>(&blk)) {
+        integ->s_out.value = value;
+    } else {
+        dynamic_cast<mtea::integrator_block_const<DT>&>(blk).s_out.value = value;
+    }
+}
+
+static void set_integrator_state(mtea::block_interface& blk, const double x) {
+    switch (blk.get_current_type()) {
+        using enum mtea::DataType;
+    case F32:
+        return load_integrator_state<F32>(blk, x);
+    case F64:
+        return load_integrator_state<F64>(blk, x);
+    default:
+        throw mtea::block_error("continuous states must be floating point");
+    }
+}
+
+template <mtea::DataType DT>
+static bool store_output_value(const mtea::block_interface& blk, const size_t port_num, mtea::Argument& value) {
+    mtea::ArgumentBox<DT> current;
+    blk.get_output(port_num, &current);
+
+    // Compare the bit patterns, such that a NaN output is not reported as a change on every step
+    auto& stored = static_cast<mtea::ArgumentBox<DT>&>(value);
+    if (std::memcmp(&current.value, &stored.value, sizeof(current.value)) == 0) {
+        return false;
+    }
+
+    stored.value = current.value;
+    return true;
+}
+
+static bool store_output(const mtea::block_interface& blk, const size_t port_num, mtea::Argument& value) {
+    switch (value.get_type()) {
+        using enum mtea::DataType;
+    case U8:
+        return store_output_value<U8>(blk, port_num, value);
+    case I8:
+        return store_output_value<I8>(blk, port_num, value);
+    case U16:
+        return store_output_value<U16>(blk, port_num, value);
+    case I16:
+        return store_output_value<I16>(blk, port_num, value);
+    case U32:
+        return store_output_value<U32>(blk, port_num, value);
+    case I32:
+        return store_output_value<I32>(blk, port_num, value);
+    case U64:
+        return store_output_value<U64>(blk, port_num, value);
+    case I64:
+        return store_output_value<I64>(blk, port_num, value);
+    case F32:
+        return store_output_value<F32>(blk, port_num, value);
+    case F64:
+        return store_output_value<F64>(blk, port_num, value);
+    case BOOL:
+        return store_output_value<BOOL>(blk, port_num, value);
+    default:
+        throw mtea::block_error("unknown data type provided");
+    }
+}
+
+template <mtea::DataType DT>
+static void set_recorder_decimation_value(mtea::block_interface& blk, const size_t decimation) {
+    auto& recorder = dynamic_cast<mtea::recorder_block_dynamic<DT>&>(blk);
+    recorder.set_decimation(decimation);
+}
+
+static void set_recorder_decimation(mtea::block_interface& blk, const size_t decimation) {
+    switch (blk.get_current_type()) {
+        using enum mtea::DataType;
+    case U8:
+        return set_recorder_decimation_value<U8>(blk, decimation);
+    case I8:
+        return set_recorder_decimation_value<I8>(blk, decimation);
+    case U16:
+        return set_recorder_decimation_value<U16>(blk, decimation);
+    case I16:
+        return set_recorder_decimation_value<I16>(blk, decimation);
+    case U32:
+        return set_recorder_decimation_value<U32>(blk, decimation);
+    case I32:
+        return set_recorder_decimation_value<I32>(blk, decimation);
+    case U64:
+        return set_recorder_decimation_value<U64>(blk, decimation);
+    case I64:
+        return set_recorder_decimation_value<I64>(blk, decimation);
+    case F32:
+        return set_recorder_decimation_value<F32>(blk, decimation);
+    case F64:
+        return set_recorder_decimation_value<F64>(blk, decimation);
+    case BOOL:
+        return set_recorder_decimation_value<BOOL>(blk, decimation);
+    default:
+        throw mtea::block_error("unknown data type provided");
+    }
+}
+
+static double get_continuous_value(const mtea::Argument& value) {
+    switch (value.get_type()) {
+        using enum mtea::DataType;
+    case F32:
+        return static_cast<const mtea::ArgumentBox<F32>&>(value).value;
+    case F64:
+        return static_cast<const mtea::ArgumentBox<F64>&>(value).value;
+    default:
+        throw mtea::block_error("continuous states must be floating point");
+    }
+}
+
+size_t mtea::block_model::add_block(std::unique_ptr<block_interface> blk) {
+    if (blk == nullptr) {
+        throw block_error("model block must not be null");
+    }
+
+    node n;
+    n.sources.resize(blk->get_input_num());
+    n.input_versions.resize(blk->get_input_num(), 0);
+
+    for (size_t i = 0; i < blk->get_output_num(); ++i) {
+        n.values.push_back(create_argument(blk->get_output_type(i)));
+    }
+    n.versions.resize(blk->get_output_num(), 0);
+
+    n.blk = std::move(blk);
+    nodes.push_back(std::move(n));
+    order_valid = false;
+
+    return nodes.size() - 1;
+}
+
+void mtea::block_model::connect(const model_port source, const size_t block_num, const size_t port_num) {
+    const auto& src = get_node(source.block);
+    const auto& dst = get_node(block_num);
+
+    if (source.port >= src.blk->get_output_num()) {
+        throw block_error("output port too high");
+    } else if (port_num >= dst.blk->get_input_num()) {
+        throw block_error("input port too high");
+    } else if (src.blk->get_output_type(source.port) != dst.blk->get_input_type(port_num)) {
+        throw block_error("connection data type mismatch");
+    }
+
+    nodes[block_num].sources[port_num] = source;
+    order_valid = false;
+}
+
+bool mtea::block_model::has_block(const size_t block_num) const noexcept {
+    return block_num < nodes.size() && nodes[block_num].blk != nullptr;
+}
+
+mtea::block_interface& mtea::block_model::get_block(const size_t block_num) const {
+    return *get_node(block_num).blk;
+}
+
+std::optional<mtea::model_port> mtea::block_model::get_source(const size_t block_num, const size_t port_num) const {
+    const auto& n = get_node(block_num);
+
+    if (port_num >= n.sources.size()) {
+        throw block_error("input port too high");
+    }
+
+    return n.sources[port_num];
+}
+
+void mtea::block_model::add_output(const model_port port) {
+    if (port.port >= get_node(port.block).blk->get_output_num()) {
+        throw block_error("output port too high");
+    }
+
+    outputs.push_back(port);
+}
+
+std::span<const mtea::model_port> mtea::block_model::get_outputs() const noexcept {
+    return outputs;
+}
+
+size_t mtea::block_model::get_block_num() const noexcept {
+    size_t count = 0;
+    for (const auto& n : nodes) {
+        if (n.blk != nullptr) {
+            count += 1;
+        }
+    }
+    return count;
+}
+
+size_t mtea::block_model::attach_recorder(const model_port port, const size_t capacity, const size_t decimation, std::optional<model_port> enable) {
+    const auto& src = get_node(port.block);
+    if (port.port >= src.blk->get_output_num()) {
+        throw block_error("output port too high");
+    }
+
+    // Check the enable port before changing the model, such that a failed attach leaves it untouched
+    if (enable.has_value()) {
+        const auto& enable_src = get_node(enable->block);
+        if (enable->port >= enable_src.blk->get_output_num()) {
+            throw block_error("output port too high");
+        } else if (enable_src.blk->get_output_type(enable->port) != DataType::BOOL) {
+            throw block_error("connection data type mismatch");
+        }
+    }
+
+    const auto types = std::to_array({src.blk->get_output_type(port.port)});
+    const ArgumentBox<DataType::U64> size(capacity);
+
+    auto blk = create_block(BLK_NAME_RECORDER, types, &size);
+    set_recorder_decimation(*blk, decimation);
+
+    if (!enable.has_value()) {
+        const auto bool_types = std::to_array({DataType::BOOL});
+        const ArgumentBox<DataType::BOOL> enabled(true);
+        enable = model_port{add_block(create_block(BLK_NAME_CONST, bool_types, &enabled)), 0};
+    }
+
+    const auto recorder_num = add_block(std::move(blk));
+    connect(port, recorder_num, 0);
+    connect(*enable, recorder_num, 1);
+
+    return recorder_num;
+}
+
+void mtea::block_model::set_time_step(const double dt) noexcept {
+    for (auto& n : nodes) {
+        if (n.blk != nullptr) {
+            n.blk->set_time_step(dt);
+        }
+    }
+}
+
+void mtea::block_model::set_lazy_evaluation(const bool lazy) noexcept {
+    lazy_evaluation = lazy;
+}
+
+bool mtea::block_model::get_lazy_evaluation() const noexcept {
+    return lazy_evaluation;
+}
+
+void mtea::block_model::reset() {
+    order = sort_blocks();
+    order_valid = true;
+    evaluation_num = 0;
+
+    for (const auto block_num : order) {
+        auto& n = nodes[block_num];
+        apply_inputs(n);
+        n.blk->reset();
+        capture_outputs(n);
+        n.evaluated = false;
+    }
+}
+
+void mtea::block_model::step() {
+    if (!order_valid) {
+        throw block_error("model must be reset after changing its structure");
+    }
+
+    for (const auto block_num : order) {
+        auto& n = nodes[block_num];
+
+        if (lazy_evaluation && n.evaluated && n.blk->is_stateless() && !inputs_changed(n)) {
+            continue;
+        }
+
+        apply_inputs(n);
+        n.blk->step();
+        capture_outputs(n);
+
+        n.evaluated = true;
+        evaluation_num += 1;
+    }
+}
+
+void mtea::block_model::get_output(const model_port port, Argument* value) const {
+    get_node(port.block).blk->get_output(port.port, value);
+}
+
+size_t mtea::block_model::get_evaluation_num() const noexcept {
+    return evaluation_num;
+}
+
+size_t mtea::block_model::get_continuous_state_num() const {
+    return get_integrators().size();
+}
+
+size_t mtea::block_model::get_zero_crossing_num() const noexcept {
+    size_t count = 0;
+    for (const auto& n : nodes) {
+        if (n.blk != nullptr) {
+            count += n.blk->get_zero_crossing_num();
+        }
+    }
+    return count;
+}
+
+double mtea::block_model::step_variable(variable_step_solver& solver, const double t, zero_crossing_detector* detector) {
+    const auto integrators = get_integrators();
+    if (solver.get_state_num() != integrators.size()) {
+        throw block_error("mismatch in continuous state count");
+    }
+
+    std::vector<double> x_start(integrators.size());
+    read_continuous_states(integrators, x_start);
+
+    const bool hold_modes = detector != nullptr;
+    const auto fcn = [&](double, std::span<const double> x, std::span<double> dx) {
+        evaluate_derivatives(integrators, x, dx, hold_modes);
+    };
+
+    std::vector<double> x = x_start;
+    double h = solver.step(t, x, fcn);
+
+    if (detector != nullptr) {
+        std::vector<double> g(detector->get_crossing_num());
+
+        write_continuous_states(integrators, x_start);
+        evaluate_stateless(true);
+        evaluate_crossings(g);
+        detector->reset(g);
+
+        write_continuous_states(integrators, x);
+        evaluate_stateless(true);
+        evaluate_crossings(g);
+
+        if (detector->check(g)) {
+            std::vector<double> x_interp(x.size());
+            const auto crossing_fcn = [&](double t_eval, std::span<double> g_eval) {
+                const double s = (t_eval - t) / h;
+                for (size_t i = 0; i < x.size(); ++i) {
+                    x_interp[i] = x_start[i] + s * (x[i] - x_start[i]);
+                }
+
+                write_continuous_states(integrators, x_interp);
+                evaluate_stateless(true);
+                evaluate_crossings(g_eval);
+            };
+
+            const double t_event = detector->locate(t, t + h, crossing_fcn, solver.get_tolerance().step_min);
+
+            // Repeat the step such that it ends just after the event, where the discrete outputs change
+            x = x_start;
+            solver.reset();
+            solver.set_time_step(t_event - t);
+            h = solver.step(t, x, fcn);
+        }
+    }
+
+    commit_continuous_step(integrators, x, h);
+
+    // The derivative cached by the solver is only valid if no block output changed in the commit
+    solver.reset();
+
+    return h;
+}
+
+void mtea::block_model::step_implicit(implicit_solver& solver, const double t, const double h) {
+    const auto integrators = get_integrators();
+    if (solver.get_state_num() != integrators.size()) {
+        throw block_error("mismatch in continuous state count");
+    }
+
+    std::vector<double> x(integrators.size());
+    read_continuous_states(integrators, x);
+
+    solver.step(t, h, x, [&](double, std::span<const double> x_eval, std::span<double> dx) {
+        evaluate_derivatives(integrators, x_eval, dx, false);
+    });
+
+    commit_continuous_step(integrators, x, h);
+}
+
+mtea::state_image mtea::block_model::save_state() const {
+    state_image image;
+    image.capture(get_live_blocks());
+    return image;
+}
+
+void mtea::block_model::restore_state(const state_image& image) {
+    image.restore(get_live_blocks());
+    refresh_outputs();
+}
+
+mtea::state_ensemble mtea::block_model::create_ensemble(const size_t instance_num) {
+    return state_ensemble(get_live_blocks(), instance_num);
+}
+
+void mtea::block_model::load_instance(const state_ensemble& ensemble, const size_t index) {
+    ensemble.load(index);
+    refresh_outputs();
+}
+
+mtea::block_model mtea::block_model::clone() const {
+    block_model copy;
+    copy.nodes.resize(nodes.size());
+
+    for (size_t i = 0; i < nodes.size(); ++i) {
+        const auto& n = nodes[i];
+        if (n.blk == nullptr) {
+            continue;
+        }
+
+        auto& c = copy.nodes[i];
+        c.blk = n.blk->clone();
+        c.sources = n.sources;
+        c.versions = n.versions;
+        c.input_versions = n.input_versions;
+        c.evaluated = n.evaluated;
+
+        for (const auto& value : n.values) {
+            c.values.push_back(create_argument(value->get_type()));
+        }
+
+        for (size_t j = 0; j < c.values.size(); ++j) {
+            store_output(*c.blk, j, *c.values[j]);
+        }
+    }
+
+    copy.order = order;
+    copy.outputs = outputs;
+    copy.order_valid = order_valid;
+    copy.lazy_evaluation = lazy_evaluation;
+    copy.evaluation_num = evaluation_num;
+
+    return copy;
+}
+
+size_t mtea::block_model::fold_constants() {
+    std::vector<bool> constant(nodes.size(), false);
+    size_t folded = 0;
+
+    for (const auto block_num : sort_blocks()) {
+        auto& n = nodes[block_num];
+
+        if (n.blk->get_block_name() == BLK_NAME_CONST) {
+            constant[block_num] = true;
+            continue;
+        } else if (!n.blk->is_stateless() || n.sources.empty()) {
+            continue;
+        }
+
+        bool inputs_constant = true;
+        for (const auto& src : n.sources) {
+            if (!src.has_value() || !constant[src->block]) {
+                inputs_constant = false;
+                break;
+            }
+        }
+
+        if (!inputs_constant) {
+            continue;
+        }
+
+        for (size_t i = 0; i < n.sources.size(); ++i) {
+            const auto& src_blk = *nodes[n.sources[i]->block].blk;
+            const auto value = create_argument(src_blk.get_output_type(n.sources[i]->port));
+            src_blk.get_output(n.sources[i]->port, value.get());
+            n.blk->set_input(i, value.get());
+        }
+
+        n.blk->step();
+
+        std::vector<std::unique_ptr<block_interface>> results;
+        for (size_t i = 0; i < n.blk->get_output_num(); ++i) {
+            results.push_back(create_const_block(*n.blk, i));
+        }
+
+        // Adding blocks may reallocate the node list, so the node reference is not used past this point
+        for (size_t i = 0; i < results.size(); ++i) {
+            const auto result_num = add_block(std::move(results[i]));
+            constant.resize(nodes.size(), false);
+            constant[result_num] = true;
+            replace_source({block_num, i}, {result_num, 0});
+        }
+
+        remove_block(block_num);
+        folded += 1;
+    }
+
+    return folded;
+}
+
+size_t mtea::block_model::remove_unused_blocks() {
+    std::vector<size_t> use_count(nodes.size(), 0);
+    for (const auto& n : nodes) {
+        for (const auto& src : n.sources) {
+            if (src.has_value()) {
+                use_count[src->block] += 1;
+            }
+        }
+    }
+
+    for (const auto& port : outputs) {
+        use_count[port.block] += 1;
+    }
+
+    std::vector<size_t> unused;
+    for (size_t i = 0; i < nodes.size(); ++i) {
+        if (nodes[i].blk != nullptr && nodes[i].blk->is_stateless() && use_count[i] == 0) {
+            unused.push_back(i);
+        }
+    }
+
+    size_t removed = 0;
+    while (!unused.empty()) {
+        const size_t block_num = unused.back();
+        unused.pop_back();
+
+        for (const auto& src : nodes[block_num].sources) {
+            if (src.has_value()) {
+                use_count[src->block] -= 1;
+                if (use_count[src->block] == 0 && nodes[src->block].blk->is_stateless()) {
+                    unused.push_back(src->block);
+                }
+            }
+        }
+
+        remove_block(block_num);
+        removed += 1;
+    }
+
+    return removed;
+}
+
+size_t mtea::block_model::merge_duplicates() {
+    std::unordered_map<std::string, std::vector<size_t>> blocks;
+    size_t merged = 0;
+
+    for (const auto block_num : sort_blocks()) {
+        const auto& n = nodes[block_num];
+
+        if (!n.blk->is_stateless()) {
+            continue;
+        }
+
+        // Unconnected inputs hold whatever value was last set on the block, so such blocks are not comparable
+        std::ostringstream key;
+        key << n.blk->get_signature();
+        bool connected = true;
+
+        for (const auto& src : n.sources) {
+            if (!src.has_value()) {
+                connected = false;
+                break;
+            }
+
+            key << '|' << src->block << ':' << src->port;
+        }
+
+        if (!connected) {
+            continue;
+        }
+
+        // Blocks with an equal key are only merged once their full parameters compare equal, such that a signature may
+        // summarize large parameters by a hash
+        auto& candidates = blocks[key.str()];
+        const auto match = std::find_if(candidates.begin(), candidates.end(), [&](const size_t other) {
+            return n.blk->has_equal_parameters(*nodes[other].blk);
+        });
+
+        if (match == candidates.end()) {
+            candidates.push_back(block_num);
+            continue;
+        }
+
+        // Consumers of the duplicate come later in the ordering, so their keys already refer to the retained block
+        const size_t retained = *match;
+        for (size_t i = 0; i < n.blk->get_output_num(); ++i) {
+            replace_source({block_num, i}, {retained, i});
+        }
+
+        remove_block(block_num);
+        merged += 1;
+    }
+
+    return merged;
+}
+
+size_t mtea::block_model::specialize_blocks() {
+    std::vector<size_t> consumed;
+    size_t specialized = 0;
+
+    // Specialized variants are appended to the node list, and are not visited again
+    const size_t node_num = nodes.size();
+    for (size_t block_num = 0; block_num < node_num; ++block_num) {
+        if (nodes[block_num].blk == nullptr) {
+            continue;
+        }
+
+        const auto& n = nodes[block_num];
+
+        std::vector<std::unique_ptr<Argument>> values(n.sources.size());
+        std::vector<const Argument*> const_inputs(n.sources.size(), nullptr);
+        bool has_const = false;
+
+        for (size_t i = 0; i < n.sources.size(); ++i) {
+            const auto& src = n.sources[i];
+            if (!src.has_value() || nodes[src->block].blk->get_block_name() != BLK_NAME_CONST) {
+                continue;
+            }
+
+            const auto& src_blk = *nodes[src->block].blk;
+            values[i] = create_argument(src_blk.get_output_type(src->port));
+            src_blk.get_output(src->port, values[i].get());
+            const_inputs[i] = values[i].get();
+            has_const = true;
+        }
+
+        if (!has_const) {
+            continue;
+        }
+
+        auto blk = create_specialized_block(*n.blk, const_inputs);
+        if (blk == nullptr) {
+            continue;
+        }
+
+        std::vector<std::optional<model_port>> sources;
+        for (size_t i = 0; i < n.sources.size(); ++i) {
+            if (const_inputs[i] == nullptr) {
+                sources.push_back(n.sources[i]);
+            } else {
+                consumed.push_back(n.sources[i]->block);
+            }
+        }
+
+        if (sources.size() != blk->get_input_num()) {
+            throw block_error("specialized block input count mismatch");
+        }
+
+        // Adding the block may reallocate the node list, so the node reference is not used past this point
+        const auto spec_num = add_block(std::move(blk));
+        nodes[spec_num].sources = std::move(sources);
+
+        for (size_t i = 0; i < nodes[spec_num].blk->get_output_num(); ++i) {
+            replace_source({block_num, i}, {spec_num, i});
+        }
+
+        remove_block(block_num);
+        specialized += 1;
+    }
+
+    std::vector<size_t> use_count(nodes.size(), 0);
+    for (const auto& n : nodes) {
+        for (const auto& src : n.sources) {
+            if (src.has_value()) {
+                use_count[src->block] += 1;
+            }
+        }
+    }
+
+    for (const auto& port : outputs) {
+        use_count[port.block] += 1;
+    }
+
+    for (const auto block_num : consumed) {
+        if (nodes[block_num].blk != nullptr && use_count[block_num] == 0) {
+            remove_block(block_num);
+        }
+    }
+
+    return specialized;
+}
+
+const mtea::block_model::node& mtea::block_model::get_node(const size_t block_num) const {
+    if (!has_block(block_num)) {
+        throw block_error("model block does not exist");
+    }
+
+    return nodes[block_num];
+}
+
+std::vector<size_t> mtea::block_model::sort_blocks() const {
+    std::vector<size_t> pending(nodes.size(), 0);
+    std::vector<std::vector<size_t>> consumers(nodes.size());
+    std::vector<bool> placed(nodes.size(), false);
+
+    size_t live_num = 0;
+    for (size_t i = 0; i < nodes.size(); ++i) {
+        if (nodes[i].blk == nullptr) {
+            continue;
+        }
+
+        live_num += 1;
+
+        for (const auto& src : nodes[i].sources) {
+            if (src.has_value()) {
+                pending[i] += 1;
+                consumers[src->block].push_back(i);
+            }
+        }
+    }
+
+    std::vector<size_t> ready;
+    for (size_t i = 0; i < nodes.size(); ++i) {
+        if (nodes[i].blk != nullptr && pending[i] == 0) {
+            ready.push_back(i);
+        }
+    }
+
+    std::vector<size_t> result;
+    result.reserve(live_num);
+
+    size_t ready_index = 0;
+    while (result.size() < live_num) {
+        if (ready_index == ready.size()) {
+            // Break a cycle at the first remaining block with delayed outputs, which then reads the previous values of
+            // its inputs
+            size_t forced = nodes.size();
+            for (size_t i = 0; i < nodes.size(); ++i) {
+                if (nodes[i].blk != nullptr && !placed[i] && nodes[i].blk->outputs_are_delayed()) {
+                    forced = i;
+                    break;
+                }
+            }
+
+            if (forced == nodes.size()) {
+                throw block_error("model contains an algebraic loop");
+            }
+
+            ready.push_back(forced);
+        }
+
+        const size_t current = ready[ready_index++];
+        if (placed[current]) {
+            continue;
+        }
+
+        placed[current] = true;
+        result.push_back(current);
+
+        for (const auto c : consumers[current]) {
+            if (!placed[c] && pending[c] > 0) {
+                pending[c] -= 1;
+                if (pending[c] == 0) {
+                    ready.push_back(c);
+                }
+            }
+        }
+    }
+
+    return result;
+}
+
+void mtea::block_model::apply_inputs(node& n) {
+    for (size_t i = 0; i < n.sources.size(); ++i) {
+        if (const auto& src = n.sources[i]) {
+            const auto& src_node = nodes[src->block];
+            n.blk->set_input(i, src_node.values[src->port].get());
+            n.input_versions[i] = src_node.versions[src->port];
+        }
+    }
+}
+
+void mtea::block_model::capture_outputs(node& n) {
+    for (size_t i = 0; i < n.values.size(); ++i) {
+        if (store_output(*n.blk, i, *n.values[i])) {
+            n.versions[i] += 1;
+        }
+    }
+}
+
+bool mtea::block_model::inputs_changed(const node& n) const {
+    for (size_t i = 0; i < n.sources.size(); ++i) {
+        if (const auto& src = n.sources[i]) {
+            if (nodes[src->block].versions[src->port] != n.input_versions[i]) {
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+void mtea::block_model::replace_source(const model_port from, const model_port to) {
+    for (auto& n : nodes) {
+        for (auto& src : n.sources) {
+            if (src.has_value() && src->block == from.block && src->port == from.port) {
+                src = to;
+            }
+        }
+    }
+
+    for (auto& port : outputs) {
+        if (port.block == from.block && port.port == from.port) {
+            port = to;
+        }
+    }
+
+    order_valid = false;
+}
+
+std::vector<mtea::block_interface*> mtea::block_model::get_live_blocks() const {
+    std::vector<block_interface*> blocks;
+    for (const auto& n : nodes) {
+        if (n.blk != nullptr) {
+            blocks.push_back(n.blk.get());
+        }
+    }
+    return blocks;
+}
+
+std::vector<size_t> mtea::block_model::get_integrators() const {
+    if (!order_valid) {
+        throw block_error("model must be reset after changing its structure");
+    }
+
+    std::vector<size_t> integrators;
+    for (size_t i = 0; i < nodes.size(); ++i) {
+        if (nodes[i].blk == nullptr) {
+            continue;
+        }
+
+        const auto name = nodes[i].blk->get_block_name();
+        if (name != BLK_NAME_INTEG && name != BLK_NAME_INTEG_CONST) {
+            continue;
+        } else if (!nodes[i].sources[0].has_value()) {
+            throw block_error("integrator value input must be connected");
+        }
+
+        integrators.push_back(i);
+    }
+
+    return integrators;
+}
+
+void mtea::block_model::read_continuous_states(std::span<const size_t> integrators, std::span<double> x) const {
+    for (size_t i = 0; i < integrators.size(); ++i) {
+        x[i] = get_continuous_value(*nodes[integrators[i]].values[0]);
+    }
+}
+
+void mtea::block_model::write_continuous_states(std::span<const size_t> integrators, std::span<const double> x) {
+    for (size_t i = 0; i < integrators.size(); ++i) {
+        auto& n = nodes[integrators[i]];
+        set_integrator_state(*n.blk, x[i]);
+        capture_outputs(n);
+    }
+}
+
+void mtea::block_model::evaluate_stateless(const bool hold_modes) {
+    for (const auto block_num : order) {
+        auto& n = nodes[block_num];
+        if (!n.blk->is_stateless()) {
+            continue;
+        }
+
+        apply_inputs(n);
+
+        // A logical output with a zero crossing is a discrete mode, which only changes when a step is committed, while
+        // its guard still follows the inputs
+        if (hold_modes && n.blk->get_zero_crossing_num() > 0 && n.blk->get_output_num() > 0 && n.blk->get_output_type(0) == DataType::BOOL) {
+            continue;
+        }
+
+        n.blk->step();
+        capture_outputs(n);
+    }
+}
+
+void mtea::block_model::evaluate_derivatives(std::span<const size_t> integrators, std::span<const double> x, std::span<double> dx, const bool hold_modes) {
+    write_continuous_states(integrators, x);
+    evaluate_stateless(hold_modes);
+
+    for (size_t i = 0; i < integrators.size(); ++i) {
+        const auto& src = *nodes[integrators[i]].sources[0];
+        dx[i] = get_continuous_value(*nodes[src.block].values[src.port]);
+    }
+}
+
+void mtea::block_model::evaluate_crossings(std::span<double> g) const {
+    size_t index = 0;
+    for (const auto& n : nodes) {
+        if (n.blk == nullptr) {
+            continue;
+        }
+
+        for (size_t i = 0; i < n.blk->get_zero_crossing_num(); ++i) {
+            if (index == g.size()) {
+                throw block_error("mismatch in zero crossing count");
+            }
+
+            g[index++] = n.blk->get_zero_crossing(i);
+        }
+    }
+
+    if (index != g.size()) {
+        throw block_error("mismatch in zero crossing count");
+    }
+}
+
+void mtea::block_model::commit_continuous_step(std::span<const size_t> integrators, std::span<const double> x, const double h) {
+    // The integrators are stepped with a zero time step, such that they keep the solver states unless reset
+    set_time_step(h);
+    for (const auto block_num : integrators) {
+        nodes[block_num].blk->set_time_step(0.0);
+    }
+
+    write_continuous_states(integrators, x);
+
+    for (const auto block_num : order) {
+        auto& n = nodes[block_num];
+
+        apply_inputs(n);
+        n.blk->step();
+        capture_outputs(n);
+
+        n.evaluated = true;
+        evaluation_num += 1;
+    }
+
+    for (const auto block_num : integrators) {
+        nodes[block_num].blk->set_time_step(h);
+    }
+}
+
+void mtea::block_model::refresh_outputs() {
+    // Stateless blocks are stepped again on the next step, as their stored inputs may not match the restored sources
+    for (auto& n : nodes) {
+        if (n.blk != nullptr) {
+            capture_outputs(n);
+            n.evaluated = false;
+        }
+    }
+}
+
+void mtea::block_model::remove_block(const size_t block_num) {
+    for (auto& n : nodes) {
+        for (auto& src : n.sources) {
+            if (src.has_value() && src->block == block_num) {
+                src.reset();
+            }
+        }
+    }
+
+    // Keep the node as an empty entry, such that the indices of the remaining blocks stay valid
+    nodes[block_num] = node{};
+    order_valid = false;
+}
+
+#endif // MTEA_USE_FULL_LIB
@@ -0,0 +1,603 @@
+// SPDX-License-Identifier: MIT
+
+#ifdef MTEA_USE_FULL_LIB
+
+#include "mtea_solver.hpp"
+
+#include "mtea_except.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+
+static const size_t DOPRI_STAGE_NUM = 7;
+
+static const auto DOPRI_C = std::to_array<double>({0.0, 1.0 / 5.0, 3.0 / 10.0, 4.0 / 5.0, 8.0 / 9.0, 1.0, 1.0});
+
+static const std::array<std::array<double, DOPRI_STAGE_NUM - 1>, DOPRI_STAGE_NUM> DOPRI_A = {{
+    {},
+    {1.0 / 5.0},
+    {3.0 / 40.0, 9.0 / 40.0},
+    {44.0 / 45.0, -56.0 / 15.0, 32.0 / 9.0},
+    {19372.0 / 6561.0, -25360.0 / 2187.0, 64448.0 / 6561.0, -212.0 / 729.0},
+    {9017.0 / 3168.0, -355.0 / 33.0, 46732.0 / 5247.0, 49.0 / 176.0, -5103.0 / 18656.0},
+    {35.0 / 384.0, 0.0, 500.0 / 1113.0, 125.0 / 192.0, -2187.0 / 6784.0, 11.0 / 84.0},
+}};
+
+static const auto DOPRI_E = std::to_array<double>({
+    71.0 / 57600.0,
+    0.0,
+    -71.0 / 16695.0,
+    71.0 / 1920.0,
+    -17253.0 / 339200.0,
+    22.0 / 525.0,
+    -1.0 / 40.0,
+});
+
+static const size_t NEWTON_ITER_MAX = 6;
+static const double NEWTON_TOLERANCE = 0.1;
+
+static const size_t CROSSING_ITER_MAX = 100;
+
+static const double STEP_SAFETY = 0.9;
+static const double STEP_FACTOR_MIN = 0.2;
+static const double STEP_FACTOR_MAX = 5.0;
+
+mtea::variable_step_solver::variable_step_solver(const size_t state_num, const solver_tolerance& tol)
+    : tolerance(tol),
+      time_step(tol.step_max),
+      first_same_as_last(false),
+      accepted_num(0),
+      rejected_num(0),
+      stages(state_num * DOPRI_STAGE_NUM, 0.0),
+      x_stage(state_num, 0.0),
+      x_next(state_num, 0.0),
+      x_error(state_num, 0.0) {
+    if (!(tol.step_min > 0.0) || tol.step_max < tol.step_min) {
+        throw block_error("invalid solver step size limits provided");
+    } else if (!(tol.relative > 0.0) && !(tol.absolute > 0.0)) {
+        throw block_error("solver tolerance must be greater than zero");
+    }
+}
+
+double mtea::variable_step_solver::step(const double t, std::span<double> x, const derivative_fn_t& fcn) {
+    const size_t n = get_state_num();
+
+    if (x.size() != n) {
+        throw block_error("mismatch in solver state size");
+    }
+
+    const auto stage = [this, n](const size_t i) {
+        return std::span<double>(stages.data() + i * n, n);
+    };
+
+    if (!first_same_as_last) {
+        fcn(t, x, stage(0));
+        first_same_as_last = true;
+    }
+
+    while (true) {
+        const double h = time_step;
+
+        for (size_t s = 1; s < DOPRI_STAGE_NUM; ++s) {
+            auto& target = (s + 1 == DOPRI_STAGE_NUM) ? x_next : x_stage;
+
+            for (size_t i = 0; i < n; ++i) {
+                double sum = 0.0;
+                for (size_t j = 0; j < s; ++j) {
+                    sum += DOPRI_A[s][j] * stages[j * n + i];
+                }
+                target[i] = x[i] + h * sum;
+            }
+
+            fcn(t + DOPRI_C[s] * h, target, stage(s));
+        }
+
+        for (size_t i = 0; i < n; ++i) {
+            double sum = 0.0;
+            for (size_t j = 0; j < DOPRI_STAGE_NUM; ++j) {
+                sum += DOPRI_E[j] * stages[j * n + i];
+            }
+            x_error[i] = h * sum;
+        }
+
+        const double err = error_norm(x, x_next);
+
+        // A non-finite derivative is retried with smaller steps, as it may come from a stage that left the valid state
+        // region, but can never be accepted
+        if (!std::isfinite(err)) {
+            if (h <= tolerance.step_min) {
+                throw block_error("non-finite solver state derivative");
+            }
+
+            rejected_num += 1;
+            time_step = std::max(h * STEP_FACTOR_MIN, tolerance.step_min);
+            continue;
+        }
+
+        double factor = STEP_FACTOR_MAX;
+        if (err > 0.0) {
+            factor = std::clamp(STEP_SAFETY * std::pow(err, -0.2), STEP_FACTOR_MIN, STEP_FACTOR_MAX);
+        }
+
+        if (err <= 1.0 || h <= tolerance.step_min) {
+            std::copy(x_next.begin(), x_next.end(), x.begin());
+
+            const auto last = stage(DOPRI_STAGE_NUM - 1);
+            std::copy(last.begin(), last.end(), stages.begin());
+
+            accepted_num += 1;
+            time_step = std::clamp(h * factor, tolerance.step_min, tolerance.step_max);
+            return h;
+        } else {
+            rejected_num += 1;
+            time_step = std::max(h * factor, tolerance.step_min);
+        }
+    }
+}
+
+void mtea::variable_step_solver::reset() noexcept {
+    first_same_as_last = false;
+}
+
+double mtea::variable_step_solver::get_time_step() const noexcept {
+    return time_step;
+}
+
+void mtea::variable_step_solver::set_time_step(const double dt) {
+    if (!(dt > 0.0)) {
+        throw block_error("solver time step must be greater than zero");
+    }
+
+    time_step = std::clamp(dt, tolerance.step_min, tolerance.step_max);
+}
+
+size_t mtea::variable_step_solver::get_state_num() const noexcept {
+    return x_stage.size();
+}
+
+size_t mtea::variable_step_solver::get_accepted_num() const noexcept {
+    return accepted_num;
+}
+
+size_t mtea::variable_step_solver::get_rejected_num() const noexcept {
+    return rejected_num;
+}
+
+const mtea::solver_tolerance& mtea::variable_step_solver::get_tolerance() const noexcept {
+    return tolerance;
+}
+
+double mtea::variable_step_solver::error_norm(std::span<const double> x, std::span<const double> x_new) const {
+    if (x.empty()) {
+        return 0.0;
+    }
+
+    double sum = 0.0;
+
+    for (size_t i = 0; i < x.size(); ++i) {
+        const double scale = tolerance.absolute + tolerance.relative * std::max(std::abs(x[i]), std::abs(x_new[i]));
+        const double e = x_error[i] / scale;
+        sum += e * e;
+    }
+
+    return std::sqrt(sum / static_cast<double>(x.size()));
+}
+
+mtea::zero_crossing_detector::zero_crossing_detector(const size_t crossing_num)
+    : g_start(crossing_num, 0.0),
+      g_low(crossing_num, 0.0),
+      g_high(crossing_num, 0.0),
+      g_mid(crossing_num, 0.0),
+      event_index(0) {}
+
+void mtea::zero_crossing_detector::reset(std::span<const double> g) {
+    if (g.size() != get_crossing_num()) {
+        throw block_error("mismatch in zero crossing size");
+    }
+
+    // A guard ending exactly on zero keeps its previous sign, as the event it approached may not have taken effect yet
+    for (size_t i = 0; i < g.size(); ++i) {
+        g_start[i] = keep_sign(g_start[i], g[i]);
+    }
+}
+
+bool mtea::zero_crossing_detector::check(std::span<const double> g) const {
+    if (g.size() != get_crossing_num()) {
+        throw block_error("mismatch in zero crossing size");
+    }
+
+    for (size_t i = 0; i < g.size(); ++i) {
+        if (sign_changed(g_start[i], g[i])) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+double mtea::zero_crossing_detector::locate(const double t0, const double t1, const crossing_fn_t& fcn, const double tol) {
+    const size_t n = get_crossing_num();
+
+    double t_low = t0;
+    double t_high = t1;
+
+    std::copy(g_start.begin(), g_start.end(), g_low.begin());
+    fcn(t_high, g_high);
+
+    if (!check(g_high)) {
+        throw block_error("no zero crossing within the provided interval");
+    }
+
+    for (size_t iter = 0; iter < CROSSING_ITER_MAX && t_high - t_low > tol; ++iter) {
+        const double width = t_high - t_low;
+        double t_mid = t_high;
+
+        for (size_t i = 0; i < n; ++i) {
+            if (sign_changed(g_low[i], g_high[i])) {
+                const double frac = g_low[i] / (g_low[i] - g_high[i]);
+                t_mid = std::min(t_mid, t_low + frac * width);
+            }
+        }
+
+        // Fall back to bisection when interpolation would stall at either end of the bracket
+        if (!(t_mid > t_low + 0.01 * width && t_mid < t_high - 0.01 * width)) {
+            t_mid = t_low + 0.5 * width;
+        }
+
+        fcn(t_mid, g_mid);
+
+        bool crossed = false;
+        for (size_t i = 0; i < n; ++i) {
+            if (sign_changed(g_low[i], g_mid[i])) {
+                crossed = true;
+                break;
+            }
+        }
+
+        if (crossed) {
+            t_high = t_mid;
+            std::swap(g_high, g_mid);
+        } else {
+            // A guard reaching exactly zero has not crossed yet, and keeps its sign for the remaining bracket
+            t_low = t_mid;
+            for (size_t i = 0; i < n; ++i) {
+                g_low[i] = keep_sign(g_low[i], g_mid[i]);
+            }
+        }
+    }
+
+    for (size_t i = 0; i < n; ++i) {
+        if (sign_changed(g_low[i], g_high[i])) {
+            event_index = i;
+            break;
+        }
+    }
+
+    return t_high;
+}
+
+size_t mtea::zero_crossing_detector::get_crossing_num() const noexcept {
+    return g_start.size();
+}
+
+size_t mtea::zero_crossing_detector::get_event_index() const noexcept {
+    return event_index;
+}
+
+double mtea::zero_crossing_detector::keep_sign(const double previous, const double value) noexcept {
+    if (value != 0.0 || previous == 0.0) {
+        return value;
+    }
+
+    // The smallest magnitude keeps interpolation towards this end of a bracket from stalling
+    return std::copysign(std::numeric_limits<double>::min(), previous);
+}
+
+bool mtea::zero_crossing_detector::sign_changed(const double a, const double b) noexcept {
+    return (a < 0.0 && b > 0.0) || (a > 0.0 && b < 0.0);
+}
+
+mtea::implicit_solver::implicit_solver(const size_t state_num, const ImplicitMethod method, const solver_tolerance& tol)
+    : method(method),
+      tolerance(tol),
+      column_rows(state_num),
+      column_colors(state_num, 0),
+      color_num(state_num),
+      jacobian(state_num * state_num, 0.0),
+      lu(state_num * state_num, 0.0),
+      pivots(state_num, 0),
+      jacobian_valid(false),
+      jacobian_current(false),
+      factored_gamma_h(0.0),
+      history_valid(false),
+      history_h(0.0),
+      x_prev(state_num, 0.0),
+      x_new(state_num, 0.0),
+      x_rhs(state_num, 0.0),
+      f_eval(state_num, 0.0),
+      f_pert(state_num, 0.0),
+      delta(state_num, 0.0),
+      jacobian_num(0),
+      factorization_num(0) {
+    if (!(tol.relative > 0.0) && !(tol.absolute > 0.0)) {
+        throw block_error("solver tolerance must be greater than zero");
+    }
+
+    for (size_t j = 0; j < state_num; ++j) {
+        column_colors[j] = j;
+        column_rows[j].resize(state_num);
+        for (size_t i = 0; i < state_num; ++i) {
+            column_rows[j][i] = i;
+        }
+    }
+}
+
+void mtea::implicit_solver::set_sparsity(std::span<const std::vector<size_t>> dependencies) {
+    const size_t n = get_state_num();
+
+    if (dependencies.size() != n) {
+        throw block_error("mismatch in solver sparsity size");
+    }
+
+    for (auto& rows : column_rows) {
+        rows.clear();
+    }
+
+    for (size_t i = 0; i < n; ++i) {
+        for (const auto j : dependencies[i]) {
+            if (j >= n) {
+                throw block_error("sparsity dependency index too high");
+            }
+            column_rows[j].push_back(i);
+        }
+    }
+
+    // Greedy distance-2 coloring, columns sharing a row may not share a color
+    const size_t NO_COLOR = n;
+    std::fill(column_colors.begin(), column_colors.end(), NO_COLOR);
+    std::vector<bool> used(n, false);
+    color_num = 0;
+
+    for (size_t j = 0; j < n; ++j) {
+        std::fill(used.begin(), used.end(), false);
+
+        for (const auto r : column_rows[j]) {
+            for (const auto k : dependencies[r]) {
+                if (column_colors[k] != NO_COLOR) {
+                    used[column_colors[k]] = true;
+                }
+            }
+        }
+
+        size_t c = 0;
+        while (used[c]) {
+            c += 1;
+        }
+
+        column_colors[j] = c;
+        color_num = std::max(color_num, c + 1);
+    }
+
+    jacobian_valid = false;
+}
+
+void mtea::implicit_solver::step(const double t, const double h, std::span<double> x, const derivative_fn_t& fcn) {
+    const size_t n = get_state_num();
+
+    if (x.size() != n) {
+        throw block_error("mismatch in solver state size");
+    } else if (!(h > 0.0)) {
+        throw block_error("solver time step must be greater than zero");
+    }
+
+    double gamma = 1.0;
+
+    if (method == ImplicitMethod::BDF2 && history_valid && history_h == h) {
+        gamma = 2.0 / 3.0;
+        for (size_t i = 0; i < n; ++i) {
+            x_rhs[i] = (4.0 * x[i] - x_prev[i]) / 3.0;
+        }
+    } else {
+        std::copy(x.begin(), x.end(), x_rhs.begin());
+    }
+
+    const double gamma_h = gamma * h;
+
+    jacobian_current = false;
+
+    if (!jacobian_valid) {
+        update_jacobian(t + h, x, fcn);
+    }
+
+    if (factored_gamma_h != gamma_h) {
+        factorize(gamma_h);
+    }
+
+    std::copy(x.begin(), x.end(), x_new.begin());
+
+    if (!newton(t + h, gamma_h, x_rhs, fcn)) {
+        if (jacobian_current) {
+            throw block_error("implicit solver failed to converge");
+        }
+
+        update_jacobian(t + h, x, fcn);
+        factorize(gamma_h);
+
+        std::copy(x.begin(), x.end(), x_new.begin());
+
+        if (!newton(t + h, gamma_h, x_rhs, fcn)) {
+            throw block_error("implicit solver failed to converge");
+        }
+    }
+
+    std::copy(x.begin(), x.end(), x_prev.begin());
+    std::copy(x_new.begin(), x_new.end(), x.begin());
+
+    history_valid = true;
+    history_h = h;
+}
+
+void mtea::implicit_solver::reset() noexcept {
+    jacobian_valid = false;
+    factored_gamma_h = 0.0;
+    history_valid = false;
+}
+
+size_t mtea::implicit_solver::get_state_num() const noexcept {
+    return column_rows.size();
+}
+
+size_t mtea::implicit_solver::get_color_num() const noexcept {
+    return color_num;
+}
+
+size_t mtea::implicit_solver::get_jacobian_num() const noexcept {
+    return jacobian_num;
+}
+
+size_t mtea::implicit_solver::get_factorization_num() const noexcept {
+    return factorization_num;
+}
+
+void mtea::implicit_solver::update_jacobian(const double t, std::span<const double> x, const derivative_fn_t& fcn) {
+    const size_t n = get_state_num();
+    const double eps = std::sqrt(std::numeric_limits<double>::epsilon());
+
+    fcn(t, x, f_eval);
+    std::fill(jacobian.begin(), jacobian.end(), 0.0);
+
+    for (size_t c = 0; c < color_num; ++c) {
+        std::copy(x.begin(), x.end(), x_new.begin());
+
+        for (size_t j = 0; j < n; ++j) {
+            if (column_colors[j] == c) {
+                delta[j] = eps * std::max(std::abs(x[j]), 1.0);
+                x_new[j] += delta[j];
+            }
+        }
+
+        fcn(t, x_new, f_pert);
+
+        for (size_t j = 0; j < n; ++j) {
+            if (column_colors[j] == c) {
+                for (const auto r : column_rows[j]) {
+                    jacobian[r * n + j] = (f_pert[r] - f_eval[r]) / delta[j];
+                }
+            }
+        }
+    }
+
+    jacobian_num += 1;
+    jacobian_valid = true;
+    jacobian_current = true;
+    factored_gamma_h = 0.0;
+}
+
+void mtea::implicit_solver::factorize(const double gamma_h) {
+    const size_t n = get_state_num();
+
+    // Invalidated until elimination completes, such that a singular pivot cannot leave a partial factorization in use
+    factored_gamma_h = 0.0;
+
+    for (size_t i = 0; i < n; ++i) {
+        for (size_t j = 0; j < n; ++j) {
+            lu[i * n + j] = (i == j ? 1.0 : 0.0) - gamma_h * jacobian[i * n + j];
+        }
+    }
+
+    for (size_t k = 0; k < n; ++k) {
+        size_t p = k;
+        for (size_t i = k + 1; i < n; ++i) {
+            if (std::abs(lu[i * n + k]) > std::abs(lu[p * n + k])) {
+                p = i;
+            }
+        }
+
+        if (lu[p * n + k] == 0.0) {
+            throw block_error("singular implicit solver iteration matrix");
+        }
+
+        pivots[k] = p;
+        if (p != k) {
+            std::swap_ranges(lu.begin() + k * n, lu.begin() + (k + 1) * n, lu.begin() + p * n);
+        }
+
+        const double pivot = lu[k * n + k];
+        for (size_t i = k + 1; i < n; ++i) {
+            const double m = lu[i * n + k] / pivot;
+            lu[i * n + k] = m;
+
+            if (m != 0.0) {
+                for (size_t j = k + 1; j < n; ++j) {
+                    lu[i * n + j] -= m * lu[k * n + j];
+                }
+            }
+        }
+    }
+
+    factorization_num += 1;
+    factored_gamma_h = gamma_h;
+}
+
+void mtea::implicit_solver::solve(std::span<double> b) const {
+    const size_t n = get_state_num();
+
+    for (size_t k = 0; k < n; ++k) {
+        std::swap(b[k], b[pivots[k]]);
+    }
+
+    for (size_t i = 1; i < n; ++i) {
+        double sum = b[i];
+        for (size_t j = 0; j < i; ++j) {
+            sum -= lu[i * n + j] * b[j];
+        }
+        b[i] = sum;
+    }
+
+    for (size_t i = n; i-- > 0;) {
+        double sum = b[i];
+        for (size_t j = i + 1; j < n; ++j) {
+            sum -= lu[i * n + j] * b[j];
+        }
+        b[i] = sum / lu[i * n + i];
+    }
+}
+
+bool mtea::implicit_solver::newton(const double t, const double gamma_h, std::span<const double> rhs, const derivative_fn_t& fcn) {
+    const size_t n = get_state_num();
+    double norm_last = std::numeric_limits<double>::infinity();
+
+    for (size_t iter = 0; iter < NEWTON_ITER_MAX; ++iter) {
+        fcn(t, x_new, f_eval);
+
+        for (size_t i = 0; i < n; ++i) {
+            delta[i] = rhs[i] + gamma_h * f_eval[i] - x_new[i];
+        }
+
+        solve(delta);
+
+        double sum = 0.0;
+        for (size_t i = 0; i < n; ++i) {
+            x_new[i] += delta[i];
+
+            const double e = delta[i] / (tolerance.absolute + tolerance.relative * std::abs(x_new[i]));
+            sum += e * e;
+        }
+
+        const double norm = n > 0 ? std::sqrt(sum / static_cast<double>(n)) : 0.0;
+
+        if (norm <= NEWTON_TOLERANCE) {
+            return true;
+        } else if (norm > norm_last) {
+            return false;
+        }
+
+        norm_last = norm;
+    }
+
+    return false;
+}
+
+#endif // MTEA_USE_FULL_LIB
@@ -0,0 +1,180 @@
+// SPDX-License-Identifier: MIT
+
+#ifdef MTEA_USE_FULL_LIB
+
+#include "mtea_state.hpp"
+
+#include "mtea_except.hpp"
+
+#include <cstring>
+
+struct state_image_header {
+    uint32_t magic;
+    uint32_t version;
+    uint64_t block_num;
+};
+
+static state_image_header read_header(std::span<const std::byte> image) {
+    state_image_header header{};
+
+    if (image.size() < sizeof(header)) {
+        throw mtea::block_error("state image too small");
+    }
+
+    std::memcpy(&header, image.data(), sizeof(header));
+
+    if (header.magic != mtea::state_image::MAGIC) {
+        throw mtea::block_error("invalid state image provided");
+    } else if (header.version != mtea::state_image::VERSION) {
+        throw mtea::block_error("unsupported state image version");
+    }
+
+    const uint64_t table_size = header.block_num * sizeof(uint32_t);
+    if (header.block_num > image.size() || image.size() - sizeof(header) < table_size) {
+        throw mtea::block_error("state image too small");
+    }
+
+    return header;
+}
+
+mtea::state_image::state_image(std::span<const std::byte> image) {
+    read_header(image);
+    data.assign(image.begin(), image.end());
+}
+
+void mtea::state_image::capture(std::span<block_interface* const> blocks) {
+    size_t total_size = sizeof(state_image_header) + blocks.size() * sizeof(uint32_t);
+    for (const auto* blk : blocks) {
+        total_size += blk->get_state_size();
+    }
+
+    data.resize(total_size);
+
+    const state_image_header header{
+        .magic = MAGIC,
+        .version = VERSION,
+        .block_num = blocks.size(),
+    };
+    std::memcpy(data.data(), &header, sizeof(header));
+
+    std::byte* table = data.data() + sizeof(header);
+    std::byte* values = table + blocks.size() * sizeof(uint32_t);
+
+    for (const auto* blk : blocks) {
+        const uint32_t size = static_cast<uint32_t>(blk->get_state_size());
+        std::memcpy(table, &size, sizeof(size));
+        table += sizeof(size);
+
+        blk->save_state(values);
+        values += size;
+    }
+}
+
+void mtea::state_image::restore(std::span<block_interface* const> blocks) const {
+    restore_state_image(blocks, data);
+}
+
+std::span<const std::byte> mtea::state_image::get_data() const noexcept {
+    return data;
+}
+
+size_t mtea::state_image::get_block_num() const noexcept {
+    if (data.empty()) {
+        return 0;
+    }
+
+    state_image_header header;
+    std::memcpy(&header, data.data(), sizeof(header));
+    return header.block_num;
+}
+
+mtea::state_ensemble::state_ensemble(std::span<block_interface* const> blocks, const size_t instance_num)
+    : blocks(blocks.begin(), blocks.end()),
+      instance_num(instance_num),
+      instance_size(0) {
+    for (const auto* blk : blocks) {
+        instance_size += blk->get_state_size();
+    }
+
+    states.resize(instance_size * instance_num);
+
+    for (size_t i = 0; i < instance_num; ++i) {
+        store(i);
+    }
+}
+
+void mtea::state_ensemble::load(const size_t index) const {
+    if (index >= get_instance_num()) {
+        throw block_error("instance index too high");
+    }
+
+    const std::byte* ptr = states.data() + index * instance_size;
+
+    for (auto* blk : blocks) {
+        blk->load_state(ptr);
+        blk->set_instance(index);
+        ptr += blk->get_state_size();
+    }
+}
+
+void mtea::state_ensemble::store(const size_t index) {
+    if (index >= get_instance_num()) {
+        throw block_error("instance index too high");
+    }
+
+    std::byte* ptr = states.data() + index * instance_size;
+
+    for (const auto* blk : blocks) {
+        blk->save_state(ptr);
+        ptr += blk->get_state_size();
+    }
+}
+
+size_t mtea::state_ensemble::get_instance_num() const noexcept {
+    return instance_num;
+}
+
+size_t mtea::state_ensemble::get_instance_size() const noexcept {
+    return instance_size;
+}
+
+std::span<const std::byte> mtea::state_ensemble::get_instance_state(const size_t index) const {
+    if (index >= get_instance_num()) {
+        throw block_error("instance index too high");
+    }
+
+    return std::span<const std::byte>(states.data() + index * instance_size, instance_size);
+}
+
+void mtea::restore_state_image(std::span<block_interface* const> blocks, std::span<const std::byte> image) {
+    const auto header = read_header(image);
+
+    if (header.block_num != blocks.size()) {
+        throw block_error("mismatch in state image block count");
+    }
+
+    const std::byte* table = image.data() + sizeof(header);
+    const std::byte* values = table + blocks.size() * sizeof(uint32_t);
+    const std::byte* end = image.data() + image.size();
+
+    for (const auto* blk : blocks) {
+        uint32_t size = 0;
+        std::memcpy(&size, table, sizeof(size));
+        table += sizeof(size);
+
+        if (size != blk->get_state_size() || static_cast<size_t>(end - values) < size) {
+            throw block_error("mismatch in state image block layout");
+        }
+
+        values += size;
+    }
+
+    values = image.data() + sizeof(header) + blocks.size() * sizeof(uint32_t);
+
+    for (auto* blk : blocks) {
+        blk->load_state(values);
+        values += blk->get_state_size();
+    }
+}
+
+#endif // MTEA_USE_FULL_LIB
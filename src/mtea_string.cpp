@@ -14,10 +14,37 @@ constinit std::string mtea::BLK_NAME_CONST = "constant";
 constinit std::string mtea::BLK_NAME_CONST_PTR = "constant_ptr";
 constinit std::string mtea::BLK_NAME_CONVERSION = "conversion";
 constinit std::string mtea::BLK_NAME_DELAY = "delay";
+constinit std::string mtea::BLK_NAME_DELAY_N = "delay_n";
+constinit std::string mtea::BLK_NAME_DELAY_CONST = "delay_const";
+constinit std::string mtea::BLK_NAME_TRANSPORT_DELAY = "transport_delay";
 constinit std::string mtea::BLK_NAME_DERIV = "derivative";
 constinit std::string mtea::BLK_NAME_INTEG = "integrator";
+constinit std::string mtea::BLK_NAME_INTEG_CONST = "integ_const";
 constinit std::string mtea::BLK_NAME_SWITCH = "switch";
 constinit std::string mtea::BLK_NAME_LIMITER = "limiter";
+constinit std::string mtea::BLK_NAME_LIMITER_CONST = "limiter_const";
+constinit std::string mtea::BLK_NAME_RECORDER = "recorder";
+constinit std::string mtea::BLK_NAME_SOURCE = "source";
+constinit std::string mtea::BLK_NAME_LOOKUP = "lookup";
+constinit std::string mtea::BLK_NAME_FIR = "fir";
+constinit std::string mtea::BLK_NAME_BIQUAD = "biquad";
+constinit std::string mtea::BLK_NAME_STATE_SPACE = "state_space";
+constinit std::string mtea::BLK_NAME_TRANSFER_FCN = "transfer_fcn";
+constinit std::string mtea::BLK_NAME_PID = "pid";
+constinit std::string mtea::BLK_NAME_PID_BANK = "pid_bank";
+constinit std::string mtea::BLK_NAME_SINE_WAVE = "sine_wave";
+constinit std::string mtea::BLK_NAME_SINE_BANK = "sine_bank";
+constinit std::string mtea::BLK_NAME_SQUARE_WAVE = "square_wave";
+constinit std::string mtea::BLK_NAME_PULSE = "pulse";
+constinit std::string mtea::BLK_NAME_RAMP = "ramp";
+constinit std::string mtea::BLK_NAME_CHIRP = "chirp";
+constinit std::string mtea::BLK_NAME_UNIFORM_NOISE = "uniform_noise";
+constinit std::string mtea::BLK_NAME_GAUSSIAN_NOISE = "gaussian_noise";
+constinit std::string mtea::BLK_NAME_RUNNING_STATS = "running_stats";
+constinit std::string mtea::BLK_NAME_STATS_BANK = "stats_bank";
+constinit std::string mtea::BLK_NAME_MOVING_AVERAGE = "moving_average";
+constinit std::string mtea::BLK_NAME_ORDER_STATISTIC = "order_statistic";
+constinit std::string mtea::BLK_NAME_SPECTRUM = "spectrum";
 constinit std::string mtea::BLK_NAME_ARITH_ADD = "add";
 constinit std::string mtea::BLK_NAME_ARITH_SUB = "sub";
 constinit std::string mtea::BLK_NAME_ARITH_MUL = "mul";
@@ -29,6 +56,17 @@ constinit std::string mtea::BLK_NAME_REL_LT = "less";
 constinit std::string mtea::BLK_NAME_REL_LEQ = "less_eq";
 constinit std::string mtea::BLK_NAME_REL_EQ = "equal";
 constinit std::string mtea::BLK_NAME_REL_NEQ = "not_equal";
+constinit std::string mtea::BLK_NAME_ARITH_ADD_CONST = "add_const";
+constinit std::string mtea::BLK_NAME_ARITH_SUB_CONST = "sub_const";
+constinit std::string mtea::BLK_NAME_ARITH_MUL_CONST = "mul_const";
+constinit std::string mtea::BLK_NAME_ARITH_DIV_CONST = "div_const";
+constinit std::string mtea::BLK_NAME_ARITH_MOD_CONST = "mod_const";
+constinit std::string mtea::BLK_NAME_REL_GT_CONST = "gt_const";
+constinit std::string mtea::BLK_NAME_REL_GEQ_CONST = "geq_const";
+constinit std::string mtea::BLK_NAME_REL_LT_CONST = "lt_const";
+constinit std::string mtea::BLK_NAME_REL_LEQ_CONST = "leq_const";
+constinit std::string mtea::BLK_NAME_REL_EQ_CONST = "eq_const";
+constinit std::string mtea::BLK_NAME_REL_NEQ_CONST = "neq_const";
 constinit std::string mtea::BLK_NAME_TRIG_SIN = "sin";
 constinit std::string mtea::BLK_NAME_TRIG_COS = "cos";
 constinit std::string mtea::BLK_NAME_TRIG_TAN = "tan";
@@ -62,8 +62,30 @@ void mtea::block_interface::reset() noexcept {}
 
 void mtea::block_interface::step() noexcept {}
 
+void mtea::block_interface::set_time_step(double) noexcept {}
+
 bool mtea::block_interface::outputs_are_delayed() const noexcept { return false; }
 
+bool mtea::block_interface::is_stateless() const noexcept { return false; }
+
+size_t mtea::block_interface::get_state_size() const noexcept { return 0; }
+
+void mtea::block_interface::save_state(void*) const noexcept {}
+
+void mtea::block_interface::load_state(const void*) noexcept {}
+
+void mtea::block_interface::set_instance(uint64_t) noexcept {}
+
+std::unique_ptr<mtea::block_interface> mtea::block_interface::clone() const {
+    throw block_error("block does not support cloning");
+}
+
+size_t mtea::block_interface::get_zero_crossing_num() const noexcept { return 0; }
+
+double mtea::block_interface::get_zero_crossing(size_t) const {
+    throw block_error("zero crossing index too high");
+}
+
 std::string mtea::block_interface::get_type_name(bool use_codegen_name) const {
     std::ostringstream oss;
     oss << BASE_NAMESPACE << "::";
@@ -75,6 +97,16 @@ std::string mtea::block_interface::get_type_name(bool use_codegen_name) const {
     return oss.str();
 }
 
+std::string mtea::block_interface::get_signature() const {
+    std::ostringstream oss;
+    oss << get_type_name() << '(' << get_parameters() << ')';
+    return oss.str();
+}
+
+std::string mtea::block_interface::get_parameters() const { return ""; }
+
+bool mtea::block_interface::has_equal_parameters(const block_interface&) const { return true; }
+
 std::string mtea::block_interface::get_class_name_codegen() const { return get_class_name(); }
 
 #endif // MTEA_USE_FULL_LIB
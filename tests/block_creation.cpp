@@ -0,0 +1,309 @@
+// SPDX-License-Identifier: MIT
+
+#ifdef MTEA_USE_FULL_LIB
+
+#include <catch2/catch_all.hpp>
+
+#include "mtea.hpp"
+#include "mtea_creation.hpp"
+#include "mtea_string.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <memory>
+#include <vector>
+
+static std::unique_ptr<mtea::block_interface> create_default_block(const mtea::BlockInformation& info) {
+    using namespace mtea;
+
+    const ArgumentBox<DataType::F64> time_step(0.1);
+    const ArgumentBox<DataType::U32> size(2);
+
+    if (info.name == BLK_NAME_CONST_PTR) {
+        return nullptr;
+    } else if (info.required_type_count == 2) {
+        const auto types = std::to_array({DataType::F64, DataType::I32});
+        return create_block(info, types);
+    }
+
+    const auto types = std::to_array({info.get_default_data_type()});
+
+    switch (info.constructor_dynamic) {
+    case BlockInformation::ConstructorOptions::VALUE:
+    case BlockInformation::ConstructorOptions::TIMESTEP:
+        return create_block(info, types, &time_step);
+    case BlockInformation::ConstructorOptions::SIZE:
+        return create_block(info, types, &size);
+    default:
+        return create_block(info, types);
+    }
+}
+
+TEST_CASE("Block Creation Stateless", "[creation]") {
+    using namespace mtea;
+
+    const auto STATEFUL_NAMES = std::to_array({BLK_NAME_CLOCK, BLK_NAME_DELAY, BLK_NAME_DERIV, BLK_NAME_INTEG, BLK_NAME_RECORDER, BLK_NAME_FIR, BLK_NAME_BIQUAD, BLK_NAME_DELAY_N, BLK_NAME_TRANSPORT_DELAY, BLK_NAME_TRANSFER_FCN, BLK_NAME_PID, BLK_NAME_PID_BANK, BLK_NAME_SINE_WAVE, BLK_NAME_SINE_BANK, BLK_NAME_SQUARE_WAVE, BLK_NAME_PULSE, BLK_NAME_RAMP, BLK_NAME_CHIRP, BLK_NAME_UNIFORM_NOISE, BLK_NAME_GAUSSIAN_NOISE, BLK_NAME_RUNNING_STATS, BLK_NAME_STATS_BANK, BLK_NAME_MOVING_AVERAGE, BLK_NAME_ORDER_STATISTIC, BLK_NAME_SPECTRUM});
+
+    for (const auto& info : get_available_blocks()) {
+        const auto blk = create_default_block(info);
+
+        if (blk == nullptr) {
+            continue;
+        }
+
+        const bool stateful = std::find(STATEFUL_NAMES.begin(), STATEFUL_NAMES.end(), info.name) != STATEFUL_NAMES.end();
+        REQUIRE(blk->is_stateless() == !stateful);
+    }
+}
+
+TEST_CASE("Block Creation Constant Folding", "[creation]") {
+    using namespace mtea;
+
+    const auto f64 = std::to_array({DataType::F64});
+    const auto f64_to_f32 = std::to_array({DataType::F64, DataType::F32});
+    const auto f32 = std::to_array({DataType::F32});
+
+    const ArgumentBox<DataType::F64> value_a(0.25);
+    const ArgumentBox<DataType::F64> value_b(3.0);
+    const ArgumentBox<DataType::U32> size(2);
+
+    const auto const_a = create_block(BLK_NAME_CONST, f64, &value_a);
+    const auto const_b = create_block(BLK_NAME_CONST, f64, &value_b);
+    const auto mul = create_block(BLK_NAME_ARITH_MUL, f64, &size);
+    const auto conv = create_block(BLK_NAME_CONVERSION, f64_to_f32);
+    const auto sin = create_block(BLK_NAME_TRIG_SIN, f32);
+
+    const auto value = create_argument(DataType::F64);
+    const auto value_f32 = create_argument(DataType::F32);
+
+    const_a->get_output(0, value.get());
+    mul->set_input(0, value.get());
+    const_b->get_output(0, value.get());
+    mul->set_input(1, value.get());
+    mul->reset();
+
+    mul->get_output(0, value.get());
+    conv->set_input(0, value.get());
+    conv->reset();
+
+    conv->get_output(0, value_f32.get());
+    sin->set_input(0, value_f32.get());
+    sin->reset();
+
+    REQUIRE(mul->is_stateless());
+    REQUIRE(conv->is_stateless());
+    REQUIRE(sin->is_stateless());
+
+    const auto folded = create_const_block(*sin, 0);
+    REQUIRE(folded->get_block_name() == BLK_NAME_CONST);
+    REQUIRE(folded->get_output_type(0) == DataType::F32);
+
+    ArgumentBox<DataType::F32> result;
+    folded->get_output(0, &result);
+    REQUIRE(result.value == std::sin(0.75f));
+
+    REQUIRE_THROWS(create_const_block(*sin, 1));
+}
+
+TEST_CASE("Block Creation Specialized", "[creation]") {
+    using namespace mtea;
+
+    const auto f64 = std::to_array({DataType::F64});
+    const ArgumentBox<DataType::U32> size(2);
+    const ArgumentBox<DataType::F64> time_step(0.5);
+
+    const ArgumentBox<DataType::F64> upper(2.0);
+    const ArgumentBox<DataType::F64> lower(-1.0);
+    const ArgumentBox<DataType::F64> divisor(4.0);
+    const ArgumentBox<DataType::F64> reset(3.0);
+
+    SECTION("Limiter") {
+        const auto lim = create_block(BLK_NAME_LIMITER, f64);
+        const auto inputs = std::to_array<const Argument*>({nullptr, &upper, &lower});
+        const auto spec = create_specialized_block(*lim, inputs);
+
+        REQUIRE(spec != nullptr);
+        REQUIRE(spec->get_type_name() == "mtea::limiter_block_const<mtea::DataType::F64>");
+        REQUIRE(spec->get_block_name() == BLK_NAME_LIMITER_CONST);
+        REQUIRE(spec->get_input_num() == 1);
+
+        for (const double v : {-5.0, 0.5, 5.0}) {
+            const ArgumentBox<DataType::F64> in(v);
+            ArgumentBox<DataType::F64> out;
+
+            spec->set_input(0, &in);
+            spec->step();
+            spec->get_output(0, &out);
+            REQUIRE(out.value == std::clamp(v, -1.0, 2.0));
+        }
+    }
+
+    SECTION("Arithmetic") {
+        const auto div = create_block(BLK_NAME_ARITH_DIV, f64, &size);
+
+        const auto divisor_inputs = std::to_array<const Argument*>({nullptr, &divisor});
+        const auto spec = create_specialized_block(*div, divisor_inputs);
+
+        REQUIRE(spec != nullptr);
+        REQUIRE(spec->get_type_name() == "mtea::arith_block_const<mtea::DataType::F64, mtea::ArithType::DIV>");
+        REQUIRE(spec->get_block_name() == BLK_NAME_ARITH_DIV_CONST);
+
+        const ArgumentBox<DataType::F64> in(10.0);
+        ArgumentBox<DataType::F64> out;
+        spec->set_input(0, &in);
+        spec->step();
+        spec->get_output(0, &out);
+        REQUIRE(out.value == 2.5);
+
+        const auto dividend_inputs = std::to_array<const Argument*>({&divisor, nullptr});
+        REQUIRE(create_specialized_block(*div, dividend_inputs) == nullptr);
+
+        const auto mul = create_block(BLK_NAME_ARITH_MUL, f64, &size);
+        REQUIRE(create_specialized_block(*mul, dividend_inputs) != nullptr);
+    }
+
+    SECTION("Relational") {
+        const auto rel = create_block(BLK_NAME_REL_GT, f64);
+        const auto inputs = std::to_array<const Argument*>({nullptr, &divisor});
+        const auto spec = create_specialized_block(*rel, inputs);
+
+        REQUIRE(spec != nullptr);
+        REQUIRE(spec->get_block_name() == BLK_NAME_REL_GT_CONST);
+        REQUIRE(spec->get_zero_crossing_num() == 1);
+
+        const ArgumentBox<DataType::F64> in(5.0);
+        ArgumentBox<DataType::BOOL> out;
+        spec->set_input(0, &in);
+        spec->step();
+        spec->get_output(0, &out);
+        REQUIRE(out.value);
+    }
+
+    SECTION("Stateful") {
+        const auto delay = create_block(BLK_NAME_DELAY, f64);
+        const auto integ = create_block(BLK_NAME_INTEG, f64, &time_step);
+        const auto inputs = std::to_array<const Argument*>({nullptr, &reset, nullptr});
+
+        const auto delay_spec = create_specialized_block(*delay, inputs);
+        const auto integ_spec = create_specialized_block(*integ, inputs);
+
+        REQUIRE(delay_spec != nullptr);
+        REQUIRE(integ_spec != nullptr);
+        REQUIRE(delay_spec->get_block_name() == BLK_NAME_DELAY_CONST);
+        REQUIRE(integ_spec->get_block_name() == BLK_NAME_INTEG_CONST);
+        REQUIRE(delay_spec->get_input_name(1) == "reset_flag");
+        REQUIRE(integ_spec->get_input_name(1) == "reset_flag");
+
+        const ArgumentBox<DataType::F64> in(1.0);
+        const ArgumentBox<DataType::BOOL> flag(false);
+        ArgumentBox<DataType::F64> out;
+
+        for (const auto& blk : {delay_spec.get(), integ_spec.get()}) {
+            blk->set_input(0, &in);
+            blk->set_input(1, &flag);
+            blk->reset();
+            blk->get_output(0, &out);
+            REQUIRE(out.value == 3.0);
+        }
+
+        integ_spec->step();
+        integ_spec->get_output(0, &out);
+        REQUIRE(out.value == 3.5);
+    }
+
+    SECTION("Stateful Other Constants") {
+        const auto delay = create_block(BLK_NAME_DELAY, f64);
+        const auto integ = create_block(BLK_NAME_INTEG, f64, &time_step);
+
+        // The specialized variants only hold the reset value, so a constant value or flag would be dropped
+        const ArgumentBox<DataType::BOOL> flag(true);
+        const auto value_inputs = std::to_array<const Argument*>({&reset, &reset, nullptr});
+        const auto flag_inputs = std::to_array<const Argument*>({nullptr, &reset, &flag});
+
+        REQUIRE(create_specialized_block(*delay, value_inputs) == nullptr);
+        REQUIRE(create_specialized_block(*delay, flag_inputs) == nullptr);
+        REQUIRE(create_specialized_block(*integ, value_inputs) == nullptr);
+        REQUIRE(create_specialized_block(*integ, flag_inputs) == nullptr);
+    }
+
+    SECTION("Unsupported") {
+        const auto sw = create_block(BLK_NAME_SWITCH, f64);
+        const auto inputs = std::to_array<const Argument*>({nullptr, &reset, nullptr});
+        REQUIRE(create_specialized_block(*sw, inputs) == nullptr);
+
+        const auto short_inputs = std::to_array<const Argument*>({nullptr});
+        REQUIRE_THROWS(create_specialized_block(*sw, short_inputs));
+    }
+}
+
+TEST_CASE("Block Creation Signature", "[creation]") {
+    using namespace mtea;
+
+    const auto f64 = std::to_array({DataType::F64});
+    const auto f32 = std::to_array({DataType::F32});
+    const ArgumentBox<DataType::U32> size_2(2);
+    const ArgumentBox<DataType::U32> size_3(3);
+
+    REQUIRE(create_block(BLK_NAME_TRIG_SIN, f64)->get_signature() == create_block(BLK_NAME_TRIG_SIN, f64)->get_signature());
+    REQUIRE(create_block(BLK_NAME_TRIG_SIN, f64)->get_signature() != create_block(BLK_NAME_TRIG_SIN, f32)->get_signature());
+    REQUIRE(create_block(BLK_NAME_TRIG_SIN, f64)->get_signature() != create_block(BLK_NAME_TRIG_COS, f64)->get_signature());
+    REQUIRE(create_block(BLK_NAME_ARITH_ADD, f64, &size_2)->get_signature() != create_block(BLK_NAME_ARITH_ADD, f64, &size_3)->get_signature());
+
+    const limiter_block_const<DataType::F64> lim_a(1.0, 0.1);
+    const limiter_block_const<DataType::F64> lim_b(1.0, 0.1);
+    const limiter_block_const<DataType::F64> lim_c(1.0, 0.1 + 1e-15);
+
+    REQUIRE(lim_a.get_parameters() == "1, 0.10000000000000001");
+    REQUIRE(lim_a.get_signature() == lim_b.get_signature());
+    REQUIRE(lim_a.get_signature() != lim_c.get_signature());
+
+    const const_block<DataType::U8> const_u8(7);
+    const const_block<DataType::BOOL> const_bool(true);
+
+    REQUIRE(const_u8.get_signature() == "mtea::const_block<mtea::DataType::U8>(7)");
+    REQUIRE(const_bool.get_signature() == "mtea::const_block<mtea::DataType::BOOL>(true)");
+}
+
+TEST_CASE("Block Creation Clone", "[creation]") {
+    using namespace mtea;
+
+    for (const auto& info : get_available_blocks()) {
+        const auto blk = create_default_block(info);
+
+        if (blk == nullptr) {
+            continue;
+        }
+
+        for (size_t i = 0; i < blk->get_input_num(); ++i) {
+            const auto value = create_argument(blk->get_input_type(i));
+            blk->set_input(i, value.get());
+        }
+
+        blk->reset();
+        blk->step();
+        blk->step();
+
+        const auto copy = blk->clone();
+
+        REQUIRE(copy != nullptr);
+        REQUIRE(copy.get() != blk.get());
+        REQUIRE(copy->get_signature() == blk->get_signature());
+        REQUIRE(copy->get_state_size() == blk->get_state_size());
+
+        std::vector<unsigned char> state_blk(blk->get_state_size());
+        std::vector<unsigned char> state_copy(copy->get_state_size());
+
+        blk->step();
+        copy->step();
+
+        blk->save_state(state_blk.data());
+        copy->save_state(state_copy.data());
+        REQUIRE(state_blk == state_copy);
+    }
+
+    arith_block_dynamic<DataType::F64, ArithType::ADD> external;
+    REQUIRE_THROWS(external.clone());
+}
+
+#endif // MTEA_USE_FULL_LIB
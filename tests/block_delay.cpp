@@ -0,0 +1,131 @@
+// SPDX-License-Identifier: MIT
+
+#include <catch2/catch_all.hpp>
+#include <catch2/matchers/catch_matchers.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include "mtea.hpp"
+
+#ifdef MTEA_USE_FULL_LIB
+#include "mtea_creation.hpp"
+#endif
+
+TEST_CASE("Block Delay N", "[delay]") {
+    mtea::delay_n_block<mtea::DataType::I32, 5> delay;
+    delay.s_in.reset = -1;
+    delay.reset();
+
+    REQUIRE(delay.s_out.value == -1);
+
+    for (int32_t i = 0; i < 20; ++i) {
+        delay.s_in.value = i;
+        delay.step();
+        REQUIRE(delay.s_out.value == (i < 5 ? -1 : i - 5));
+    }
+
+    delay.s_in.reset = 100;
+    delay.s_in.reset_flag = true;
+    delay.s_in.value = 0;
+    delay.step();
+    REQUIRE(delay.s_out.value == 100);
+}
+
+TEST_CASE("Block Delay N Single", "[delay]") {
+    mtea::delay_n_block<mtea::DataType::F64, 1> delay_n;
+    mtea::delay_block<mtea::DataType::F64> delay;
+
+    delay_n.s_in.reset = 2.0;
+    delay_n.s_in.reset_flag = false;
+    delay.s_in.reset = 2.0;
+    delay.s_in.reset_flag = false;
+    delay_n.reset();
+    delay.reset();
+
+    for (size_t i = 0; i < 10; ++i) {
+        delay_n.s_in.value = static_cast<double>(i) * 1.5;
+        delay.s_in.value = static_cast<double>(i) * 1.5;
+        delay_n.step();
+        delay.step();
+        REQUIRE(delay_n.s_out.value == delay.s_out.value);
+    }
+}
+
+TEST_CASE("Block Transport Delay", "[delay]") {
+    mtea::transport_delay_block<mtea::DataType::F64, 16> delay(0.5);
+    delay.reset();
+
+    delay.s_in.delay = 1.25;
+    for (size_t i = 0; i < 30; ++i) {
+        delay.s_in.value = static_cast<double>(i);
+        delay.step();
+
+        const double expected = i < 3 ? 0.0 : static_cast<double>(i) - 2.5;
+        if (i >= 3) {
+            REQUIRE_THAT(delay.s_out.value, Catch::Matchers::WithinAbs(expected, 1e-12));
+        }
+    }
+
+    delay.s_in.delay = 0.0;
+    delay.s_in.value = 42.0;
+    delay.step();
+    REQUIRE(delay.s_out.value == 42.0);
+
+    delay.s_in.delay = 100.0;
+    delay.s_in.value = 43.0;
+    delay.step();
+    REQUIRE(delay.s_out.value == 16.0);
+}
+
+TEST_CASE("Block Transport Delay Variable Step", "[delay]") {
+    mtea::transport_delay_block<mtea::DataType::F64, 32> delay(0.1);
+    delay.reset();
+    delay.s_in.delay = 1.0;
+
+    // A ramp of the simulation time is delayed exactly when interpolating between samples in time
+    double time = 0.0;
+    for (size_t i = 0; i < 40; ++i) {
+        delay.time_step = i % 3 == 0 ? 0.25 : 0.05;
+        time += delay.time_step;
+
+        delay.s_in.value = time;
+        delay.step();
+
+        if (time > 1.0) {
+            REQUIRE_THAT(delay.s_out.value, Catch::Matchers::WithinAbs(time - 1.0, 1e-9));
+        }
+    }
+}
+
+#ifdef MTEA_USE_FULL_LIB
+TEST_CASE("Block Delay Creation", "[delay]") {
+    const std::array<mtea::DataType, 1> types = {mtea::DataType::U8};
+    const mtea::ArgumentBox<mtea::DataType::U32> size(3);
+
+    auto blk = mtea::create_block(mtea::BLK_NAME_DELAY_N, types, &size);
+    REQUIRE(blk->outputs_are_delayed());
+    REQUIRE(blk->get_type_name(true) == "mtea::delay_n_block<mtea::DataType::U8, 3>");
+
+    auto* delay = dynamic_cast<mtea::delay_n_block_dynamic<mtea::DataType::U8>*>(blk.get());
+    REQUIRE(delay != nullptr);
+
+    blk->reset();
+    for (uint8_t i = 1; i <= 3; ++i) {
+        delay->s_in.value = i;
+        blk->step();
+    }
+
+    const auto copy = blk->clone();
+    auto* delay_copy = dynamic_cast<mtea::delay_n_block_dynamic<mtea::DataType::U8>*>(copy.get());
+    delay->s_in.value = 0;
+    delay_copy->s_in.value = 0;
+    blk->step();
+    copy->step();
+    REQUIRE(delay->s_out.value == 1);
+    REQUIRE(delay_copy->s_out.value == 1);
+
+    const std::array<mtea::DataType, 1> float_types = {mtea::DataType::F32};
+    auto transport = mtea::create_block(mtea::BLK_NAME_TRANSPORT_DELAY, float_types, &size);
+    REQUIRE(transport->get_input_num() == 2);
+    REQUIRE_THROWS(mtea::create_block(mtea::BLK_NAME_TRANSPORT_DELAY, types, &size));
+}
+#endif
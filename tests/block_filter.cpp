@@ -0,0 +1,127 @@
+// SPDX-License-Identifier: MIT
+
+#include <catch2/catch_all.hpp>
+#include <catch2/matchers/catch_matchers.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <cmath>
+#include <vector>
+
+#include "mtea.hpp"
+
+#ifdef MTEA_USE_FULL_LIB
+#include "mtea_creation.hpp"
+#endif
+
+using Catch::Matchers::WithinAbs;
+
+static double filter_input(const size_t i) {
+    return std::sin(static_cast<double>(i) * 0.3) + static_cast<double>(i % 5) * 0.1;
+}
+
+TEST_CASE("Block FIR", "[filter]") {
+    const auto taps = std::to_array<double>({0.5, -0.25, 0.125, 1.0, 0.0, 2.0, -1.0});
+
+    mtea::fir_block<mtea::DataType::F64, taps.size()> fir(taps);
+    fir.reset();
+
+    std::vector<double> inputs;
+    for (size_t i = 0; i < 50; ++i) {
+        inputs.push_back(filter_input(i));
+        fir.s_in.value = inputs.back();
+        fir.step();
+
+        double expected = 0.0;
+        for (size_t k = 0; k < taps.size() && k <= i; ++k) {
+            expected += taps[k] * inputs[i - k];
+        }
+
+        REQUIRE_THAT(fir.s_out.value, WithinAbs(expected, 1e-12));
+    }
+
+    fir.reset();
+    fir.s_in.value = 1.0;
+    fir.step();
+    REQUIRE(fir.s_out.value == taps[0]);
+}
+
+TEST_CASE("Block FIR Empty", "[filter]") {
+    mtea::fir_block_dynamic<mtea::DataType::F64> fir;
+    REQUIRE(fir.get_tap_num() == 0);
+
+    fir.reset();
+    fir.s_in.value = 1.0;
+    fir.step();
+    REQUIRE(fir.s_out.value == 0.0);
+}
+
+TEST_CASE("Block Biquad", "[filter]") {
+    const auto coefficients = std::to_array<float>({
+        0.2f, 0.4f, 0.2f, -0.5f, 0.3f,
+        1.0f, -1.0f, 0.0f, -0.9f, 0.0f,
+    });
+
+    mtea::biquad_block<mtea::DataType::F32, 2> biquad(coefficients);
+    biquad.reset();
+
+    double x1[2] = {0.0, 0.0};
+    double x2[2] = {0.0, 0.0};
+    double y1[2] = {0.0, 0.0};
+    double y2[2] = {0.0, 0.0};
+
+    for (size_t i = 0; i < 100; ++i) {
+        double x = filter_input(i);
+        biquad.s_in.value = static_cast<float>(x);
+        biquad.step();
+
+        for (size_t s = 0; s < 2; ++s) {
+            const float* c = coefficients.data() + s * 5;
+            const double y = c[0] * x + c[1] * x1[s] + c[2] * x2[s] - c[3] * y1[s] - c[4] * y2[s];
+            x2[s] = x1[s];
+            x1[s] = x;
+            y2[s] = y1[s];
+            y1[s] = y;
+            x = y;
+        }
+
+        REQUIRE_THAT(biquad.s_out.value, WithinAbs(x, 1e-4));
+    }
+}
+
+#ifdef MTEA_USE_FULL_LIB
+TEST_CASE("Block Filter Creation", "[filter]") {
+    const std::array<mtea::DataType, 1> types = {mtea::DataType::F64};
+    const mtea::ArgumentBox<mtea::DataType::U32> size(3);
+
+    auto blk = mtea::create_block(mtea::BLK_NAME_FIR, types, &size);
+    auto* fir = dynamic_cast<mtea::fir_block_dynamic<mtea::DataType::F64>*>(blk.get());
+    REQUIRE(fir != nullptr);
+    REQUIRE(fir->get_tap_num() == 3);
+    REQUIRE(blk->get_type_name(true) == "mtea::fir_block<mtea::DataType::F64, 3>");
+
+    fir->coefficients[1] = 2.0;
+    blk->reset();
+    fir->s_in.value = 1.0;
+    blk->step();
+    fir->s_in.value = 0.0;
+    blk->step();
+    REQUIRE(fir->s_out.value == 2.0);
+
+    std::vector<std::byte> state(blk->get_state_size());
+    blk->save_state(state.data());
+
+    const auto copy = blk->clone();
+    blk->step();
+    copy->step();
+    REQUIRE(fir->s_out.value == dynamic_cast<mtea::fir_block_dynamic<mtea::DataType::F64>*>(copy.get())->s_out.value);
+
+    blk->load_state(state.data());
+    REQUIRE(fir->s_out.value == 2.0);
+
+    auto biquad = mtea::create_block(mtea::BLK_NAME_BIQUAD, types, &size);
+    REQUIRE(dynamic_cast<mtea::biquad_block_dynamic<mtea::DataType::F64>*>(biquad.get())->get_section_num() == 3);
+
+    const std::array<mtea::DataType, 1> int_types = {mtea::DataType::I32};
+    REQUIRE_THROWS(mtea::create_block(mtea::BLK_NAME_FIR, int_types, &size));
+}
+#endif
@@ -0,0 +1,225 @@
+// SPDX-License-Identifier: MIT
+
+#include <catch2/catch_all.hpp>
+#include <catch2/matchers/catch_matchers.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <cmath>
+#include <numbers>
+
+#include "mtea.hpp"
+
+#ifdef MTEA_USE_FULL_LIB
+#include "mtea_creation.hpp"
+#endif
+
+using Catch::Matchers::WithinAbs;
+
+TEST_CASE("Block Sine Wave", "[generator]") {
+    const double dt = 0.001;
+    const double freq = 13.7;
+    const double phase = 0.4;
+
+    mtea::sine_wave_block<mtea::DataType::F64> sine(dt, freq, 2.0, phase, 0.5);
+    sine.reset();
+    REQUIRE_THAT(sine.s_out.value, WithinAbs(2.0 * std::sin(phase) + 0.5, 1e-12));
+
+    // The recurrence must not drift over long runs
+    for (size_t k = 1; k <= 1000000; ++k) {
+        sine.step();
+
+        if (k % 9973 == 0) {
+            const double t = static_cast<double>(k) * dt;
+            const double angle = 2.0 * std::numbers::pi * freq * t + phase;
+            REQUIRE_THAT(sine.s_out.value, WithinAbs(2.0 * std::sin(angle) + 0.5, 1e-8));
+            REQUIRE_THAT(sine.s_out.quadrature, WithinAbs(2.0 * std::cos(angle) + 0.5, 1e-8));
+        }
+    }
+}
+
+TEST_CASE("Block Sine Wave Single", "[generator]") {
+    mtea::sine_wave_block<mtea::DataType::F32> sine(0.01f, 3.0f);
+    sine.reset();
+
+    std::array<float, 100000> values;
+    sine.generate(values.data(), values.size());
+
+    for (size_t i = 0; i < values.size(); i += 997) {
+        const double t = static_cast<double>(i + 1) * 0.01;
+        REQUIRE_THAT(values[i], WithinAbs(std::sin(2.0 * std::numbers::pi * 3.0 * t), 2e-3));
+    }
+}
+
+TEST_CASE("Block Sine Bank", "[generator]") {
+    const size_t N = 4;
+    mtea::sine_bank_block<mtea::DataType::F64, N> bank(0.01);
+    for (size_t i = 0; i < N; ++i) {
+        bank.frequencies[i] = 0.5 * static_cast<double>(i + 1);
+        bank.amplitudes[i] = static_cast<double>(i + 1);
+        bank.phases[i] = 0.1 * static_cast<double>(i);
+    }
+    bank.reset();
+
+    for (size_t k = 1; k <= 5000; ++k) {
+        bank.step();
+
+        const double t = static_cast<double>(k) * 0.01;
+        for (size_t i = 0; i < N; ++i) {
+            const double expected = bank.amplitudes[i] * std::sin(2.0 * std::numbers::pi * bank.frequencies[i] * t + bank.phases[i]);
+            REQUIRE_THAT(bank.s_out.values[i], WithinAbs(expected, 1e-9));
+        }
+    }
+}
+
+TEST_CASE("Block Square Wave and Pulse", "[generator]") {
+    mtea::square_wave_block<mtea::DataType::F64> square(0.125, 1.0, 2.0, 1.0);
+    mtea::pulse_block<mtea::DataType::F64> pulse(0.125, 1.0, 3.0, 0.25);
+    square.reset();
+    pulse.reset();
+
+    REQUIRE(square.s_out.value == 3.0);
+    REQUIRE(pulse.s_out.value == 3.0);
+
+    const std::array<double, 16> square_expected = {3, 3, 3, -1, -1, -1, -1, 3, 3, 3, 3, -1, -1, -1, -1, 3};
+    const std::array<double, 16> pulse_expected = {3, 0, 0, 0, 0, 0, 0, 3, 3, 0, 0, 0, 0, 0, 0, 3};
+
+    std::array<double, 16> values;
+    pulse.generate(values.data(), values.size());
+    for (size_t i = 0; i < square_expected.size(); ++i) {
+        square.step();
+        REQUIRE(square.s_out.value == square_expected[i]);
+        REQUIRE(values[i] == pulse_expected[i]);
+    }
+}
+
+TEST_CASE("Block Ramp", "[generator]") {
+    mtea::ramp_block<mtea::DataType::F64> ramp(0.1, 2.0, 0.5, 1.0);
+    ramp.reset();
+    REQUIRE(ramp.s_out.value == 1.0);
+
+    for (size_t k = 1; k <= 100000; ++k) {
+        ramp.step();
+        const double t = static_cast<double>(k) * 0.1;
+        REQUIRE_THAT(ramp.s_out.value, WithinAbs(1.0 + 2.0 * std::max(t - 0.5, 0.0), 1e-9));
+    }
+}
+
+TEST_CASE("Block Chirp", "[generator]") {
+    const double dt = 0.0005;
+    const double f0 = 1.0;
+    const double f1 = 20.0;
+    const double sweep = 2.0;
+    const double rate = (f1 - f0) / sweep;
+
+    mtea::chirp_block<mtea::DataType::F64> chirp(dt, f0, f1, sweep, 1.5);
+    chirp.reset();
+
+    for (size_t k = 1; k <= 4000; ++k) {
+        chirp.step();
+        const double t = static_cast<double>(k) * dt;
+        const double expected = 1.5 * std::sin(2.0 * std::numbers::pi * (f0 * t + rate * t * t / 2.0));
+        REQUIRE_THAT(chirp.s_out.value, WithinAbs(expected, 1e-8));
+    }
+
+    // Past the sweep time, zero crossings follow the end frequency
+    size_t crossings = 0;
+    double prev = chirp.s_out.value;
+    for (size_t k = 0; k < 2000; ++k) {
+        chirp.step();
+        crossings += (prev < 0.0) != (chirp.s_out.value < 0.0) ? 1 : 0;
+        prev = chirp.s_out.value;
+    }
+    REQUIRE(crossings >= 39);
+    REQUIRE(crossings <= 41);
+}
+
+template <typename B>
+void check_generate(B& batch, B& single) {
+    using data_t = typename B::data_t;
+
+    batch.reset();
+    single.reset();
+
+    // Chunk sizes cross the renormalization interval of the rotating phasors
+    std::array<data_t, 150> values;
+    for (const size_t num : {size_t(0), size_t(1), size_t(63), size_t(150), size_t(70)}) {
+        batch.generate(values.data(), num);
+        for (size_t i = 0; i < num; ++i) {
+            single.step();
+            REQUIRE(values[i] == single.s_out.value);
+        }
+        REQUIRE(batch.s_out.value == single.s_out.value);
+    }
+
+    batch.step();
+    single.step();
+    REQUIRE(batch.s_out.value == single.s_out.value);
+}
+
+TEST_CASE("Block Generator Batch", "[generator]") {
+    {
+        mtea::sine_wave_block<mtea::DataType::F64> batch(0.01, 3.0, 2.0, 0.3, 0.5);
+        mtea::sine_wave_block<mtea::DataType::F64> single(0.01, 3.0, 2.0, 0.3, 0.5);
+        check_generate(batch, single);
+        REQUIRE(batch.s_out.quadrature == single.s_out.quadrature);
+    }
+    {
+        mtea::square_wave_block<mtea::DataType::F64> batch(0.01, 3.0, 2.0, 1.0);
+        mtea::square_wave_block<mtea::DataType::F64> single(0.01, 3.0, 2.0, 1.0);
+        check_generate(batch, single);
+    }
+    {
+        mtea::pulse_block<mtea::DataType::F32> batch(0.01f, 3.0f, 2.0f, 0.2f);
+        mtea::pulse_block<mtea::DataType::F32> single(0.01f, 3.0f, 2.0f, 0.2f);
+        check_generate(batch, single);
+    }
+    {
+        mtea::ramp_block<mtea::DataType::F64> batch(0.01, 2.0, 0.5, 1.0);
+        mtea::ramp_block<mtea::DataType::F64> single(0.01, 2.0, 0.5, 1.0);
+        check_generate(batch, single);
+    }
+    {
+        mtea::chirp_block<mtea::DataType::F64> batch(0.01, 1.0, 10.0, 2.0, 1.5);
+        mtea::chirp_block<mtea::DataType::F64> single(0.01, 1.0, 10.0, 2.0, 1.5);
+        check_generate(batch, single);
+    }
+}
+
+#ifdef MTEA_USE_FULL_LIB
+TEST_CASE("Block Generator Creation", "[generator]") {
+    const std::array<mtea::DataType, 1> types = {mtea::DataType::F64};
+    const mtea::ArgumentBox<mtea::DataType::F64> dt(0.25);
+
+    for (const auto& name : {mtea::BLK_NAME_SINE_WAVE, mtea::BLK_NAME_SQUARE_WAVE, mtea::BLK_NAME_PULSE, mtea::BLK_NAME_RAMP, mtea::BLK_NAME_CHIRP}) {
+        auto blk = mtea::create_block(name, types, &dt);
+        REQUIRE(blk->get_input_num() == 0);
+        REQUIRE(blk->get_block_name() == name);
+
+        blk->reset();
+        blk->step();
+        blk->step();
+
+        std::vector<unsigned char> state(blk->get_state_size());
+        blk->save_state(state.data());
+
+        const auto copy = blk->clone();
+        REQUIRE(copy->get_signature() == blk->get_signature());
+
+        std::vector<unsigned char> copy_state(copy->get_state_size());
+        copy->save_state(copy_state.data());
+        REQUIRE(state == copy_state);
+    }
+
+    const mtea::ArgumentBox<mtea::DataType::U32> size(3);
+    auto bank = mtea::create_block(mtea::BLK_NAME_SINE_BANK, types, &size);
+    REQUIRE(bank->get_output_num() == 3);
+
+    bank->set_time_step(0.25);
+    bank->reset();
+    bank->step();
+
+    const auto* b = dynamic_cast<const mtea::sine_bank_block_dynamic<mtea::DataType::F64>*>(bank.get());
+    REQUIRE(b != nullptr);
+    REQUIRE_THAT(b->s_out.values[2], WithinAbs(1.0, 1e-12));
+}
+#endif
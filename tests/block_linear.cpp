@@ -0,0 +1,130 @@
+// SPDX-License-Identifier: MIT
+
+#include <catch2/catch_all.hpp>
+#include <catch2/matchers/catch_matchers.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <cmath>
+
+#include "mtea.hpp"
+
+#ifdef MTEA_USE_FULL_LIB
+#include "mtea_creation.hpp"
+#endif
+
+using Catch::Matchers::WithinAbs;
+
+static double linear_input(const size_t i) {
+    return std::cos(static_cast<double>(i) * 0.2) + 0.5;
+}
+
+TEST_CASE("Block State Space", "[linear]") {
+    const auto a = std::to_array<double>({0.9, 0.1, -0.2, 0.8});
+    const auto b = std::to_array<double>({1.0, 0.0, 0.5, 1.0});
+    const auto c = std::to_array<double>({1.0, 1.0});
+    const auto d = std::to_array<double>({0.0, 0.25});
+
+    mtea::state_space_block<mtea::DataType::F64, 2, 2, 1> ss(a, b, c, d);
+    ss.reset();
+    REQUIRE_FALSE(ss.is_diagonal());
+
+    double x[2] = {0.0, 0.0};
+
+    for (size_t k = 0; k < 50; ++k) {
+        const double u[2] = {linear_input(k), linear_input(k + 7)};
+        ss.s_in.values[0] = u[0];
+        ss.s_in.values[1] = u[1];
+        ss.step();
+
+        const double y = c[0] * x[0] + c[1] * x[1] + d[0] * u[0] + d[1] * u[1];
+        const double x0 = a[0] * x[0] + a[1] * x[1] + b[0] * u[0] + b[1] * u[1];
+        const double x1 = a[2] * x[0] + a[3] * x[1] + b[2] * u[0] + b[3] * u[1];
+        x[0] = x0;
+        x[1] = x1;
+
+        REQUIRE_THAT(ss.s_out.values[0], WithinAbs(y, 1e-12));
+        REQUIRE_THAT(ss.get_states()[0], WithinAbs(x[0], 1e-12));
+        REQUIRE_THAT(ss.get_states()[1], WithinAbs(x[1], 1e-12));
+    }
+}
+
+TEST_CASE("Block State Space Diagonal", "[linear]") {
+    mtea::state_space_block<mtea::DataType::F32, 3, 1, 3> ss;
+    for (size_t i = 0; i < 3; ++i) {
+        ss.a[i * 3 + i] = 0.5f;
+        ss.b[i] = static_cast<float>(i + 1);
+        ss.c[i * 3 + i] = 1.0f;
+    }
+    ss.analyze();
+    ss.reset();
+
+    REQUIRE(ss.is_diagonal());
+
+    ss.s_in.values[0] = 1.0f;
+    ss.step();
+    ss.step();
+    ss.step();
+
+    for (size_t i = 0; i < 3; ++i) {
+        REQUIRE_THAT(ss.s_out.values[i], WithinAbs(1.5 * static_cast<double>(i + 1), 1e-6));
+    }
+
+#ifdef MTEA_USE_FULL_LIB
+    REQUIRE(ss.outputs_are_delayed());
+    REQUIRE(ss.get_output_num() == 3);
+#endif
+}
+
+TEST_CASE("Block Transfer Function", "[linear]") {
+    const auto num = std::to_array<double>({0.1, 0.2, 0.05});
+    const auto den = std::to_array<double>({-1.1, 0.3});
+
+    mtea::transfer_function_block<mtea::DataType::F64, 2> tf(num, den);
+    tf.reset();
+
+    double x1 = 0.0;
+    double x2 = 0.0;
+    double y1 = 0.0;
+    double y2 = 0.0;
+
+    for (size_t k = 0; k < 100; ++k) {
+        const double x = linear_input(k);
+        tf.s_in.value = x;
+        tf.step();
+
+        const double y = num[0] * x + num[1] * x1 + num[2] * x2 - den[0] * y1 - den[1] * y2;
+        x2 = x1;
+        x1 = x;
+        y2 = y1;
+        y1 = y;
+
+        REQUIRE_THAT(tf.s_out.value, WithinAbs(y, 1e-10));
+    }
+}
+
+#ifdef MTEA_USE_FULL_LIB
+TEST_CASE("Block Transfer Function Creation", "[linear]") {
+    const std::array<mtea::DataType, 1> types = {mtea::DataType::F64};
+    const mtea::ArgumentBox<mtea::DataType::U32> order(1);
+
+    auto blk = mtea::create_block(mtea::BLK_NAME_TRANSFER_FCN, types, &order);
+    auto* tf = dynamic_cast<mtea::transfer_function_block_dynamic<mtea::DataType::F64>*>(blk.get());
+    REQUIRE(tf != nullptr);
+    REQUIRE(tf->get_order() == 1);
+
+    // Discrete integrator y[k] = y[k - 1] + x[k - 1]
+    tf->numerator[0] = 0.0;
+    tf->numerator[1] = 1.0;
+    tf->denominator[0] = -1.0;
+    blk->reset();
+
+    tf->s_in.value = 2.0;
+    for (size_t i = 0; i < 5; ++i) {
+        blk->step();
+        REQUIRE(tf->s_out.value == 2.0 * static_cast<double>(i));
+    }
+
+    const auto copy = blk->clone();
+    REQUIRE(copy->get_signature() == blk->get_signature());
+}
+#endif
@@ -0,0 +1,99 @@
+// SPDX-License-Identifier: MIT
+
+#include <catch2/catch_all.hpp>
+#include <catch2/matchers/catch_matchers.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <string>
+#include <vector>
+
+#include "mtea.hpp"
+
+using Catch::Matchers::WithinAbs;
+
+TEST_CASE("Block Lookup 1D", "[lookup]") {
+    const auto breakpoints = std::to_array<double>({0.0, 1.0, 3.0, 4.0});
+    const auto table = std::to_array<double>({0.0, 10.0, 30.0, -10.0});
+
+    mtea::lookup_block<mtea::DataType::F64, 1> lookup({breakpoints.data()}, {breakpoints.size()}, table.data());
+
+    const auto inputs = std::to_array<double>({-1.0, 0.0, 0.5, 2.0, 3.5, 4.0, 10.0, 0.25});
+    const auto expected = std::to_array<double>({0.0, 0.0, 5.0, 20.0, 10.0, -10.0, -10.0, 2.5});
+
+    for (size_t i = 0; i < inputs.size(); ++i) {
+        lookup.s_in.values[0] = inputs[i];
+        lookup.step();
+        REQUIRE_THAT(lookup.s_out.value, WithinAbs(expected[i], 1e-12));
+    }
+
+    std::array<double, inputs.size()> outputs{};
+    lookup.evaluate_batch(inputs.data(), outputs.data(), inputs.size());
+    for (size_t i = 0; i < inputs.size(); ++i) {
+        REQUIRE_THAT(outputs[i], WithinAbs(expected[i], 1e-12));
+    }
+}
+
+TEST_CASE("Block Lookup Uniform", "[lookup]") {
+    std::vector<float> breakpoints;
+    std::vector<float> table;
+    for (size_t i = 0; i <= 100; ++i) {
+        breakpoints.push_back(static_cast<float>(i) * 0.1f - 5.0f);
+        table.push_back(breakpoints.back() * 2.0f + 1.0f);
+    }
+
+    mtea::lookup_block<mtea::DataType::F32, 1> lookup({breakpoints.data()}, {breakpoints.size()}, table.data());
+
+    for (float x = -4.99f; x < 4.99f; x += 0.037f) {
+        lookup.s_in.values[0] = x;
+        lookup.step();
+        REQUIRE_THAT(lookup.s_out.value, WithinAbs(x * 2.0f + 1.0f, 1e-4));
+    }
+}
+
+TEST_CASE("Block Lookup 2D", "[lookup]") {
+    const auto rows = std::to_array<double>({0.0, 1.0, 2.0});
+    const auto cols = std::to_array<double>({0.0, 10.0});
+    const auto table = std::to_array<double>({
+        0.0, 1.0,
+        2.0, 3.0,
+        4.0, 8.0,
+    });
+
+    mtea::lookup_block<mtea::DataType::F64, 2> lookup({rows.data(), cols.data()}, {rows.size(), cols.size()}, table.data());
+
+    lookup.s_in.values[0] = 0.5;
+    lookup.s_in.values[1] = 5.0;
+    lookup.step();
+    REQUIRE_THAT(lookup.s_out.value, WithinAbs(1.5, 1e-12));
+
+    lookup.s_in.values[0] = 1.5;
+    lookup.s_in.values[1] = 10.0;
+    lookup.step();
+    REQUIRE_THAT(lookup.s_out.value, WithinAbs(5.5, 1e-12));
+
+    lookup.s_in.values[0] = 3.0;
+    lookup.s_in.values[1] = -1.0;
+    lookup.step();
+    REQUIRE_THAT(lookup.s_out.value, WithinAbs(4.0, 1e-12));
+}
+
+TEST_CASE("Block Lookup 3D", "[lookup]") {
+    const auto axis = std::to_array<double>({0.0, 1.0});
+    std::array<double, 8> table{};
+    for (size_t i = 0; i < table.size(); ++i) {
+        table[i] = static_cast<double>(4 * ((i >> 2) & 1) + 2 * ((i >> 1) & 1) + (i & 1));
+    }
+
+    mtea::lookup_block<mtea::DataType::F64, 3> lookup({axis.data(), axis.data(), axis.data()}, {2, 2, 2}, table.data());
+    lookup.s_in.values[0] = 0.25;
+    lookup.s_in.values[1] = 0.5;
+    lookup.s_in.values[2] = 0.75;
+    lookup.step();
+    REQUIRE_THAT(lookup.s_out.value, WithinAbs(4 * 0.25 + 2 * 0.5 + 0.75, 1e-12));
+
+#ifdef MTEA_USE_FULL_LIB
+    REQUIRE(lookup.get_input_num() == 3);
+    REQUIRE(lookup.get_signature().starts_with("mtea::lookup_block<mtea::DataType::F64, 3>(2x2x2, #"));
+    REQUIRE(lookup.get_signature().size() == std::string("mtea::lookup_block<mtea::DataType::F64, 3>(2x2x2, #)").size() + 16);
+#endif
+}
@@ -0,0 +1,159 @@
+// SPDX-License-Identifier: MIT
+
+#include <catch2/catch_all.hpp>
+#include <catch2/matchers/catch_matchers.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <cmath>
+#include <vector>
+
+#include "mtea.hpp"
+
+#ifdef MTEA_USE_FULL_LIB
+#include "mtea_creation.hpp"
+#endif
+
+using Catch::Matchers::WithinAbs;
+
+TEST_CASE("Philox Known Answers", "[noise]") {
+    REQUIRE(mtea::philox4x32({0, 0, 0, 0}, {0, 0}) == std::array<uint32_t, 4>{0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8});
+    REQUIRE(mtea::philox4x32({0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}, {0xffffffff, 0xffffffff}) == std::array<uint32_t, 4>{0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd});
+    REQUIRE(mtea::philox4x32({0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344}, {0xa4093822, 0x299f31d0}) == std::array<uint32_t, 4>{0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1});
+}
+
+TEST_CASE("Block Uniform Noise", "[noise]") {
+    const size_t N = 200000;
+
+    mtea::uniform_noise_block<mtea::DataType::F64> noise(42, 3, -2.0, 2.0);
+    noise.reset();
+
+    double sum = 0.0;
+    double sum_sq = 0.0;
+    std::vector<double> values(N);
+
+    for (size_t i = 0; i < N; ++i) {
+        noise.step();
+        values[i] = noise.s_out.value;
+        REQUIRE(values[i] >= -2.0);
+        REQUIRE(values[i] < 2.0);
+        sum += values[i];
+        sum_sq += values[i] * values[i];
+    }
+
+    const double mean = sum / static_cast<double>(N);
+    REQUIRE_THAT(mean, WithinAbs(0.0, 0.02));
+    REQUIRE_THAT(sum_sq / static_cast<double>(N) - mean * mean, WithinAbs(16.0 / 12.0, 0.02));
+
+    // Batches, random access, and separate instances must all reproduce the same stream
+    mtea::uniform_noise_block<mtea::DataType::F64> batch(42, 3, -2.0, 2.0);
+    batch.reset();
+
+    std::vector<double> batch_values(N);
+    batch.generate(batch_values.data(), 1000);
+    batch.generate(batch_values.data() + 1000, N - 1000);
+    REQUIRE(batch_values == values);
+    REQUIRE(batch.get_step_index() == N);
+    REQUIRE(batch.s_out.value == values.back());
+
+    batch.seek(500);
+    REQUIRE(batch.s_out.value == values[499]);
+    batch.step();
+    REQUIRE(batch.s_out.value == values[500]);
+
+    mtea::uniform_noise_block<mtea::DataType::F64> other(42, 4, -2.0, 2.0);
+    other.reset();
+    size_t same = 0;
+    for (size_t i = 0; i < 1000; ++i) {
+        other.step();
+        same += other.s_out.value == values[i] ? 1 : 0;
+    }
+    REQUIRE(same == 0);
+}
+
+TEST_CASE("Block Gaussian Noise", "[noise]") {
+    const size_t N = 200000;
+
+    mtea::gaussian_noise_block<mtea::DataType::F32> noise(7, 0, 1.0f, 0.5f);
+    noise.reset();
+
+    std::vector<float> values(N);
+    noise.generate(values.data(), values.size());
+
+    double sum = 0.0;
+    double sum_sq = 0.0;
+    size_t within = 0;
+    for (const auto v : values) {
+        REQUIRE(std::isfinite(v));
+        sum += v;
+        sum_sq += static_cast<double>(v) * v;
+        within += std::abs(v - 1.0f) < 0.5f ? 1 : 0;
+    }
+
+    const double mean = sum / static_cast<double>(N);
+    REQUIRE_THAT(mean, WithinAbs(1.0, 0.01));
+    REQUIRE_THAT(std::sqrt(sum_sq / static_cast<double>(N) - mean * mean), WithinAbs(0.5, 0.01));
+    REQUIRE_THAT(static_cast<double>(within) / static_cast<double>(N), WithinAbs(0.6827, 0.01));
+
+    noise.reset();
+    noise.step();
+    REQUIRE(noise.s_out.value == values[0]);
+}
+
+#ifdef MTEA_USE_FULL_LIB
+TEST_CASE("Block Noise Creation", "[noise]") {
+    const std::array<mtea::DataType, 1> types = {mtea::DataType::F32};
+
+    for (const auto& name : {mtea::BLK_NAME_UNIFORM_NOISE, mtea::BLK_NAME_GAUSSIAN_NOISE}) {
+        auto blk = mtea::create_block(name, types);
+        REQUIRE(blk->get_input_num() == 0);
+        REQUIRE(blk->get_output_num() == 1);
+
+        blk->reset();
+        blk->step();
+
+        std::vector<unsigned char> state(blk->get_state_size());
+        blk->save_state(state.data());
+        blk->step();
+        blk->load_state(state.data());
+
+        const auto copy = blk->clone();
+        REQUIRE(copy->get_signature() == blk->get_signature());
+
+        blk->step();
+        copy->step();
+
+        mtea::ArgumentBox<mtea::DataType::F32> a(0.0f);
+        mtea::ArgumentBox<mtea::DataType::F32> b(1.0f);
+        blk->get_output(0, &a);
+        copy->get_output(0, &b);
+        REQUIRE(a.value == b.value);
+    }
+}
+
+TEST_CASE("Block Noise Creation Seed", "[noise]") {
+    const std::array<mtea::DataType, 1> types = {mtea::DataType::F64};
+    const mtea::ArgumentBox<mtea::DataType::U64> seed(42);
+
+    auto blk = mtea::create_block(mtea::BLK_NAME_GAUSSIAN_NOISE, types, &seed);
+    auto unseeded = mtea::create_block(mtea::BLK_NAME_GAUSSIAN_NOISE, types);
+    mtea::gaussian_noise_block<mtea::DataType::F64> expected(42);
+
+    blk->reset();
+    unseeded->reset();
+    expected.reset();
+
+    blk->step();
+    unseeded->step();
+    expected.step();
+
+    mtea::ArgumentBox<mtea::DataType::F64> a(0.0);
+    mtea::ArgumentBox<mtea::DataType::F64> b(0.0);
+    blk->get_output(0, &a);
+    unseeded->get_output(0, &b);
+    REQUIRE(a.value == expected.s_out.value);
+    REQUIRE(a.value != b.value);
+
+    const mtea::ArgumentBox<mtea::DataType::F64> fractional(1.5);
+    REQUIRE_THROWS(mtea::create_block(mtea::BLK_NAME_UNIFORM_NOISE, types, &fractional));
+}
+#endif
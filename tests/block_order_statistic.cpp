@@ -0,0 +1,112 @@
+// SPDX-License-Identifier: MIT
+
+#include <catch2/catch_all.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "mtea.hpp"
+
+#ifdef MTEA_USE_FULL_LIB
+#include "mtea_creation.hpp"
+#endif
+
+template <mtea::DataType DT, size_t WINDOW>
+static void check_order_statistic(const double percentile, const size_t steps) {
+    using data_t = typename mtea::type_info<DT>::type_t;
+
+    mtea::order_statistic_block<DT, WINDOW> blk(percentile);
+    blk.reset();
+    blk.s_in.reset_flag = false;
+
+    uint32_t state = 12345;
+    std::vector<data_t> history;
+
+    for (size_t k = 0; k < steps; ++k) {
+        state = state * 1664525u + 1013904223u;
+        const data_t value = static_cast<data_t>(static_cast<int32_t>(state >> 24) - 128);
+
+        history.push_back(value);
+        blk.s_in.value = value;
+        blk.step();
+
+        const size_t start = history.size() > WINDOW ? history.size() - WINDOW : 0;
+        std::vector<data_t> window(history.begin() + static_cast<std::ptrdiff_t>(start), history.end());
+        std::sort(window.begin(), window.end());
+
+        const auto rank = static_cast<size_t>(percentile * static_cast<double>(window.size() - 1) + 0.5);
+        REQUIRE(blk.s_out.value == window[rank]);
+    }
+
+    REQUIRE(blk.get_count() == std::min(steps, WINDOW));
+}
+
+TEST_CASE("Block Order Statistic Median", "[order_statistic]") {
+    check_order_statistic<mtea::DataType::F64, 1>(0.5, 20);
+    check_order_statistic<mtea::DataType::F64, 2>(0.5, 50);
+    check_order_statistic<mtea::DataType::F64, 7>(0.5, 500);
+    check_order_statistic<mtea::DataType::I32, 64>(0.5, 2000);
+}
+
+TEST_CASE("Block Order Statistic Percentile", "[order_statistic]") {
+    check_order_statistic<mtea::DataType::F32, 9>(0.0, 500);
+    check_order_statistic<mtea::DataType::F32, 9>(1.0, 500);
+    check_order_statistic<mtea::DataType::I16, 25>(0.25, 1000);
+    check_order_statistic<mtea::DataType::I16, 25>(0.9, 1000);
+}
+
+TEST_CASE("Block Order Statistic Outlier", "[order_statistic]") {
+    mtea::order_statistic_block<mtea::DataType::F64, 5> median;
+    median.reset();
+    median.s_in.reset_flag = false;
+
+    for (size_t k = 0; k < 20; ++k) {
+        median.s_in.value = k == 10 ? 1e9 : 1.0;
+        median.step();
+        REQUIRE(median.s_out.value == 1.0);
+    }
+
+    median.s_in.reset_flag = true;
+    median.s_in.value = 3.0;
+    median.step();
+    REQUIRE(median.get_count() == 1);
+    REQUIRE(median.s_out.value == 3.0);
+}
+
+#ifdef MTEA_USE_FULL_LIB
+TEST_CASE("Block Order Statistic Creation", "[order_statistic]") {
+    const std::array<mtea::DataType, 1> types = {mtea::DataType::F64};
+    const mtea::ArgumentBox<mtea::DataType::U32> size(3);
+
+    auto blk = mtea::create_block(mtea::BLK_NAME_ORDER_STATISTIC, types, &size);
+    auto* med = dynamic_cast<mtea::order_statistic_block_dynamic<mtea::DataType::F64>*>(blk.get());
+    REQUIRE(med != nullptr);
+    REQUIRE(med->get_window_size() == 3);
+
+    blk->reset();
+    med->s_in.reset_flag = false;
+    for (const double v : {5.0, 1.0, 3.0, 4.0}) {
+        med->s_in.value = v;
+        blk->step();
+    }
+    REQUIRE(med->s_out.value == 3.0);
+
+    std::vector<unsigned char> state(blk->get_state_size());
+    blk->save_state(state.data());
+
+    const auto copy = blk->clone();
+    REQUIRE(copy->get_signature() == blk->get_signature());
+
+    blk->reset();
+    blk->load_state(state.data());
+    for (auto* b : {blk.get(), copy.get()}) {
+        auto* m = dynamic_cast<mtea::order_statistic_block_dynamic<mtea::DataType::F64>*>(b);
+        m->s_in.value = 0.0;
+        b->step();
+        REQUIRE(m->s_out.value == 3.0);
+        b->step();
+        REQUIRE(m->s_out.value == 0.0);
+    }
+}
+#endif
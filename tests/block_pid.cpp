@@ -0,0 +1,182 @@
+// SPDX-License-Identifier: MIT
+
+#include <catch2/catch_all.hpp>
+#include <catch2/matchers/catch_matchers.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+#include "mtea.hpp"
+
+#ifdef MTEA_USE_FULL_LIB
+#include "mtea_creation.hpp"
+#endif
+
+using Catch::Matchers::WithinAbs;
+
+static double pid_error(const size_t i) {
+    return std::sin(static_cast<double>(i) * 0.3) * 2.0;
+}
+
+TEST_CASE("Block PID", "[pid]") {
+    const double dt = 0.1;
+    const double kp = 1.5;
+    const double ki = 0.8;
+    const double kd = 0.2;
+    const double tf = 0.05;
+
+    mtea::pid_block<mtea::DataType::F64> pid(dt, kp, ki, kd, tf);
+    pid.reset();
+    pid.s_in.reset_flag = false;
+
+    double integral = 0.0;
+    double derivative = 0.0;
+    double prev = 0.0;
+
+    for (size_t k = 0; k < 100; ++k) {
+        const double e = pid_error(k);
+        pid.s_in.error = e;
+        pid.step();
+
+        derivative = (tf * derivative + kd * (e - prev)) / (tf + dt);
+        prev = e;
+        const double u = kp * e + integral + derivative;
+        integral += ki * dt * e;
+
+        REQUIRE_THAT(pid.s_out.value, WithinAbs(u, 1e-12));
+    }
+
+    pid.s_in.reset_flag = true;
+    pid.s_in.error = 0.0;
+    pid.step();
+    REQUIRE(pid.s_out.value == 0.0);
+}
+
+TEST_CASE("Block PID Reset Step", "[pid]") {
+    // A derivative-only controller with an unfiltered derivative would output kd * error / dt on the first step if the
+    // previous error were taken as zero
+    mtea::pid_block<mtea::DataType::F64> pid(0.1, 0.0, 0.0, 2.0);
+    mtea::pid_bank_block<mtea::DataType::F64, 2> bank(0.1);
+    bank.params = pid.params;
+
+    for (size_t i = 0; i < 2; ++i) {
+        pid.reset();
+        bank.reset();
+        pid.s_in.reset_flag = false;
+        bank.s_in.reset_flag = false;
+
+        pid.s_in.error = 5.0;
+        bank.s_in.errors[0] = 5.0;
+        bank.s_in.errors[1] = -5.0;
+
+        pid.step();
+        bank.step();
+        REQUIRE(pid.s_out.value == 0.0);
+        REQUIRE(bank.s_out.values[0] == 0.0);
+        REQUIRE(bank.s_out.values[1] == 0.0);
+
+        // Later changes in the error still produce a derivative
+        pid.s_in.error = 6.0;
+        bank.s_in.errors[0] = 6.0;
+        pid.step();
+        bank.step();
+        REQUIRE_THAT(pid.s_out.value, WithinAbs(20.0, 1e-12));
+        REQUIRE_THAT(bank.s_out.values[0], WithinAbs(20.0, 1e-12));
+        REQUIRE(bank.s_out.values[1] == 0.0);
+    }
+
+    // The reset input also restarts the derivative from the current error
+    pid.s_in.reset_flag = true;
+    pid.s_in.error = -3.0;
+    pid.step();
+    REQUIRE(pid.s_out.value == 0.0);
+}
+
+TEST_CASE("Block PID Anti-Windup", "[pid]") {
+    mtea::pid_block<mtea::DataType::F32> pid(0.1f, 0.0f, 10.0f, 0.0f, 0.0f, -1.0f, 1.0f);
+    pid.reset();
+    pid.s_in.reset_flag = false;
+
+    // Integration must stop once the output saturates, such that the output recovers as soon as the error changes sign
+    pid.s_in.error = 1.0f;
+    for (size_t i = 0; i < 100; ++i) {
+        pid.step();
+        REQUIRE(pid.s_out.value <= 1.0f);
+    }
+    REQUIRE(pid.s_out.value == 1.0f);
+
+    pid.s_in.error = -1.0f;
+    for (size_t i = 0; i < 3; ++i) {
+        pid.step();
+    }
+    REQUIRE(pid.s_out.value < 1.0f);
+}
+
+TEST_CASE("Block PID Bank", "[pid]") {
+    const size_t N = 5;
+    mtea::pid_bank_block<mtea::DataType::F64, N> bank(0.1);
+    bank.params = {2.0, 0.5, 0.1, 0.02, -3.0, 3.0};
+    bank.reset();
+    bank.s_in.reset_flag = false;
+
+    std::array<std::unique_ptr<mtea::pid_block<mtea::DataType::F64>>, N> loops;
+    for (auto& p : loops) {
+        p = std::make_unique<mtea::pid_block<mtea::DataType::F64>>(0.1);
+        p->params = bank.params;
+        p->reset();
+        p->s_in.reset_flag = false;
+    }
+
+    for (size_t k = 0; k < 50; ++k) {
+        for (size_t i = 0; i < N; ++i) {
+            bank.s_in.errors[i] = pid_error(k + 3 * i) * static_cast<double>(i + 1);
+            loops[i]->s_in.error = bank.s_in.errors[i];
+            loops[i]->step();
+        }
+
+        bank.step();
+
+        for (size_t i = 0; i < N; ++i) {
+            REQUIRE(bank.s_out.values[i] == loops[i]->s_out.value);
+        }
+    }
+}
+
+#ifdef MTEA_USE_FULL_LIB
+TEST_CASE("Block PID Creation", "[pid]") {
+    const std::array<mtea::DataType, 1> types = {mtea::DataType::F64};
+
+    const mtea::ArgumentBox<mtea::DataType::F64> dt(0.5);
+    auto pid = mtea::create_block(mtea::BLK_NAME_PID, types, &dt);
+    REQUIRE(pid->get_input_num() == 2);
+    REQUIRE(pid->get_input_type(1) == mtea::DataType::BOOL);
+    REQUIRE(pid->get_output_num() == 1);
+
+    const mtea::ArgumentBox<mtea::DataType::U32> size(3);
+    auto bank = mtea::create_block(mtea::BLK_NAME_PID_BANK, types, &size);
+    REQUIRE(bank->get_input_num() == 4);
+    REQUIRE(bank->get_output_num() == 3);
+    REQUIRE(bank->get_input_name(3) == "reset_flag");
+
+    auto* b = dynamic_cast<mtea::pid_bank_block_dynamic<mtea::DataType::F64>*>(bank.get());
+    REQUIRE(b != nullptr);
+    b->s_in.errors[1] = 2.0;
+    b->s_in.reset_flag = false;
+    bank->step();
+    REQUIRE(b->s_out.values[1] == 2.0);
+
+    std::vector<unsigned char> state(bank->get_state_size());
+    bank->save_state(state.data());
+    bank->reset();
+    REQUIRE(b->s_out.values[1] == 0.0);
+    bank->load_state(state.data());
+    REQUIRE(b->s_out.values[1] == 2.0);
+
+    const auto copy = bank->clone();
+    REQUIRE(copy->get_signature() == bank->get_signature());
+
+    const mtea::ArgumentBox<mtea::DataType::U32> empty(0);
+    REQUIRE_THROWS(mtea::create_block(mtea::BLK_NAME_PID_BANK, types, &empty));
+}
+#endif
@@ -0,0 +1,145 @@
+// SPDX-License-Identifier: MIT
+
+#include <catch2/catch_all.hpp>
+
+#include <thread>
+#include <vector>
+
+#include "mtea.hpp"
+
+#ifdef MTEA_USE_FULL_LIB
+#include "mtea_creation.hpp"
+#endif
+
+TEST_CASE("Block Recorder Decimation", "[recorder]") {
+    mtea::recorder_block<mtea::DataType::I32, 16> recorder(3);
+    recorder.reset();
+
+    recorder.s_in.enable = true;
+    for (int32_t i = 0; i < 10; ++i) {
+        recorder.s_in.value = i;
+        recorder.step();
+    }
+
+    REQUIRE(recorder.get_available() == 4);
+
+    std::array<int32_t, 8> values{};
+    REQUIRE(recorder.read(values.data(), values.size()) == 4);
+    REQUIRE(values[0] == 0);
+    REQUIRE(values[1] == 3);
+    REQUIRE(values[2] == 6);
+    REQUIRE(values[3] == 9);
+
+    recorder.s_in.enable = false;
+    recorder.step();
+    recorder.step();
+    recorder.step();
+    REQUIRE(recorder.get_available() == 0);
+}
+
+TEST_CASE("Block Recorder Zero Decimation", "[recorder]") {
+    mtea::recorder_block<mtea::DataType::I32, 16> recorder(0);
+    REQUIRE(recorder.get_decimation() == 1);
+
+    recorder.set_decimation(2);
+    REQUIRE(recorder.get_decimation() == 2);
+    recorder.set_decimation(0);
+    REQUIRE(recorder.get_decimation() == 1);
+
+    recorder.reset();
+    recorder.s_in.enable = true;
+    for (int32_t i = 0; i < 3; ++i) {
+        recorder.s_in.value = i;
+        recorder.step();
+    }
+
+    REQUIRE(recorder.get_available() == 3);
+}
+
+TEST_CASE("Block Recorder Overrun", "[recorder]") {
+    mtea::recorder_block<mtea::DataType::F64, 4> recorder;
+    recorder.reset();
+
+    recorder.s_in.enable = true;
+    for (size_t i = 0; i < 6; ++i) {
+        recorder.s_in.value = static_cast<double>(i);
+        recorder.step();
+    }
+
+    REQUIRE(recorder.get_available() == 4);
+    REQUIRE(recorder.get_overrun_count() == 2);
+
+    std::array<double, 4> values{};
+    REQUIRE(recorder.read(values.data(), 2) == 2);
+    REQUIRE(values[0] == 0.0);
+    REQUIRE(values[1] == 1.0);
+
+    recorder.s_in.value = 10.0;
+    recorder.step();
+    REQUIRE(recorder.read(values.data(), values.size()) == 3);
+    REQUIRE(values[0] == 2.0);
+    REQUIRE(values[1] == 3.0);
+    REQUIRE(values[2] == 10.0);
+
+    recorder.clear();
+    REQUIRE(recorder.get_overrun_count() == 0);
+}
+
+TEST_CASE("Block Recorder Concurrent Reader", "[recorder]") {
+    constexpr size_t SAMPLE_NUM = 100000;
+
+    mtea::recorder_block<mtea::DataType::U32, 64> recorder;
+    recorder.reset();
+    recorder.s_in.enable = true;
+
+    std::vector<uint32_t> received;
+    received.reserve(SAMPLE_NUM);
+
+    std::thread reader([&recorder, &received]() {
+        std::array<uint32_t, 16> values{};
+        while (received.size() < SAMPLE_NUM) {
+            const size_t num = recorder.read(values.data(), values.size());
+            received.insert(received.end(), values.begin(), values.begin() + num);
+        }
+    });
+
+    for (uint32_t i = 0; i < SAMPLE_NUM;) {
+        if (recorder.get_available() < recorder.get_capacity()) {
+            recorder.s_in.value = i;
+            recorder.step();
+            i += 1;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+
+    reader.join();
+
+    REQUIRE(recorder.get_overrun_count() == 0);
+    for (size_t i = 0; i < received.size(); ++i) {
+        REQUIRE(received[i] == i);
+    }
+}
+
+#ifdef MTEA_USE_FULL_LIB
+TEST_CASE("Block Recorder Creation", "[recorder]") {
+    const std::array<mtea::DataType, 1> types = {mtea::DataType::F32};
+
+    const mtea::ArgumentBox<mtea::DataType::U32> size(8);
+    auto blk = mtea::create_block(mtea::BLK_NAME_RECORDER, types, &size);
+    REQUIRE(blk->get_input_num() == 2);
+    REQUIRE(blk->get_output_num() == 0);
+    REQUIRE(blk->get_type_name(true) == "mtea::recorder_block<mtea::DataType::F32, 8>");
+
+    auto* recorder = dynamic_cast<mtea::recorder_block_dynamic<mtea::DataType::F32>*>(blk.get());
+    REQUIRE(recorder != nullptr);
+    REQUIRE(recorder->get_capacity() == 8);
+    REQUIRE(recorder->get_decimation() == 1);
+
+    recorder->set_decimation(0);
+    REQUIRE(recorder->get_decimation() == 1);
+
+    const mtea::ArgumentBox<mtea::DataType::U32> zero(0);
+    REQUIRE_THROWS(mtea::create_block(mtea::BLK_NAME_RECORDER, types, &zero));
+}
+#endif
@@ -0,0 +1,124 @@
+// SPDX-License-Identifier: MIT
+
+#include <catch2/catch_all.hpp>
+#include <catch2/matchers/catch_matchers.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <vector>
+
+#include "mtea.hpp"
+
+TEST_CASE("Block Source", "[source]") {
+    const std::vector<int32_t> samples = {4, 8, 15, 16, 23, 42};
+
+    mtea::source_block<mtea::DataType::I32> source(samples.data(), samples.size());
+    source.reset();
+
+    for (size_t i = 0; i < samples.size(); ++i) {
+        REQUIRE(source.s_out.value == samples[i]);
+        REQUIRE_FALSE(source.is_finished());
+        source.step();
+    }
+
+    REQUIRE(source.is_finished());
+    source.step();
+    REQUIRE(source.s_out.value == samples.back());
+}
+
+TEST_CASE("Block Source Interpolation", "[source]") {
+    const std::vector<double> samples = {0.0, 1.0, 4.0, 9.0};
+
+    mtea::source_block<mtea::DataType::F64> source(samples.data(), samples.size(), 0.25);
+    source.reset();
+
+    const auto expected = std::to_array<double>({0.0, 0.25, 0.5, 0.75, 1.0, 1.75, 2.5, 3.25, 4.0, 5.25});
+    for (const auto v : expected) {
+        REQUIRE_THAT(source.s_out.value, Catch::Matchers::WithinAbs(v, 1e-12));
+        source.step();
+    }
+}
+
+TEST_CASE("Block Source Chunks", "[source]") {
+    const std::vector<double> first = {1.0, 2.0, 3.0};
+    const std::vector<double> second = {4.0, 5.0};
+
+    mtea::source_block<mtea::DataType::F64> source(first.data(), first.size());
+    source.reset();
+
+    std::vector<double> values;
+    for (size_t i = 0; i < 5; ++i) {
+        if (source.is_finished()) {
+            source.set_data(second.data(), second.size());
+        }
+
+        values.push_back(source.s_out.value);
+        source.step();
+    }
+
+    REQUIRE(values == std::vector<double>{1.0, 2.0, 3.0, 4.0, 5.0});
+}
+
+TEST_CASE("Block Source Chunk Interpolation", "[source]") {
+    const std::vector<double> samples = {0.0, 1.0, 4.0, 9.0, 16.0, 25.0};
+    const std::vector<double> first(samples.begin(), samples.begin() + 3);
+    const std::vector<double> second(samples.begin() + 3, samples.end());
+
+    mtea::source_block<mtea::DataType::F64> whole(samples.data(), samples.size(), 0.25);
+    mtea::source_block<mtea::DataType::F64> chunked(first.data(), first.size(), 0.25);
+    whole.reset();
+    chunked.reset();
+
+    bool switched = false;
+    for (size_t i = 0; i < 21; ++i) {
+        if (!switched && chunked.is_finished()) {
+            // Positions 2.25 through 2.75 lie between the final sample of the first chunk and the second chunk
+            REQUIRE(i == 9);
+            chunked.set_data(second.data(), second.size());
+            switched = true;
+        }
+
+        REQUIRE_THAT(chunked.s_out.value, Catch::Matchers::WithinAbs(whole.s_out.value, 1e-12));
+        whole.step();
+        chunked.step();
+    }
+
+    REQUIRE(switched);
+    REQUIRE(chunked.is_finished());
+    REQUIRE(chunked.s_out.value == 25.0);
+}
+
+TEST_CASE("Block Source Chunk Buffer Reuse", "[source]") {
+    std::vector<double> buffer_a = {1.0, 2.0};
+    std::vector<double> buffer_b = {3.0, 4.0};
+
+    mtea::source_block<mtea::DataType::F64> source(buffer_a.data(), buffer_a.size(), 0.5);
+    source.reset();
+    source.step();
+    source.step();
+    source.step();
+    REQUIRE(source.is_finished());
+
+    // A double-buffered producer may refill the previous chunk before the next chunk is provided
+    buffer_a = {100.0, 100.0};
+    source.set_data(buffer_b.data(), buffer_b.size());
+    REQUIRE(source.s_out.value == 2.5);
+}
+
+#ifdef MTEA_USE_FULL_LIB
+TEST_CASE("Block Source Clone", "[source]") {
+    const std::vector<float> samples = {1.0f, 2.0f, 3.0f};
+
+    mtea::source_block<mtea::DataType::F32> source(samples.data(), samples.size());
+    source.reset();
+    source.step();
+
+    const auto blk = source.clone();
+    auto* copy = dynamic_cast<mtea::source_block<mtea::DataType::F32>*>(blk.get());
+    REQUIRE(copy != nullptr);
+
+    copy->step();
+    source.step();
+    REQUIRE(copy->s_out.value == source.s_out.value);
+    REQUIRE(blk->get_signature() == "mtea::source_block<mtea::DataType::F32>(1)");
+}
+#endif
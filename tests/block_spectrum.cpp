@@ -0,0 +1,140 @@
+// SPDX-License-Identifier: MIT
+
+#include <catch2/catch_all.hpp>
+#include <catch2/matchers/catch_matchers.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <cmath>
+#include <numbers>
+#include <vector>
+
+#include "mtea.hpp"
+
+#ifdef MTEA_USE_FULL_LIB
+#include "mtea_creation.hpp"
+#endif
+
+using Catch::Matchers::WithinAbs;
+
+TEST_CASE("FFT Radix-2", "[spectrum]") {
+    const size_t N = 64;
+
+    std::vector<double> cos_table(N / 2);
+    std::vector<double> sin_table(N / 2);
+    for (size_t k = 0; k < N / 2; ++k) {
+        cos_table[k] = std::cos(2.0 * std::numbers::pi * static_cast<double>(k) / N);
+        sin_table[k] = std::sin(2.0 * std::numbers::pi * static_cast<double>(k) / N);
+    }
+
+    std::vector<double> re(N);
+    std::vector<double> im(N);
+    for (size_t i = 0; i < N; ++i) {
+        re[i] = std::sin(static_cast<double>(i * i) * 0.1) + 0.25;
+        im[i] = std::cos(static_cast<double>(i) * 0.7);
+    }
+
+    const auto in_re = re;
+    const auto in_im = im;
+    mtea::fft_radix2(re.data(), im.data(), N, cos_table.data(), sin_table.data());
+
+    for (size_t k = 0; k < N; ++k) {
+        double sum_re = 0.0;
+        double sum_im = 0.0;
+        for (size_t n = 0; n < N; ++n) {
+            const double angle = -2.0 * std::numbers::pi * static_cast<double>(k * n) / N;
+            sum_re += in_re[n] * std::cos(angle) - in_im[n] * std::sin(angle);
+            sum_im += in_re[n] * std::sin(angle) + in_im[n] * std::cos(angle);
+        }
+
+        REQUIRE_THAT(re[k], WithinAbs(sum_re, 1e-10));
+        REQUIRE_THAT(im[k], WithinAbs(sum_im, 1e-10));
+    }
+}
+
+TEST_CASE("Block Spectrum", "[spectrum]") {
+    const size_t N = 128;
+
+    for (const auto wf : {mtea::WindowFunction::RECTANGULAR, mtea::WindowFunction::HANN, mtea::WindowFunction::HAMMING, mtea::WindowFunction::BLACKMAN}) {
+        mtea::spectrum_block<mtea::DataType::F64, N> spec(N, wf);
+        spec.reset();
+
+        for (size_t i = 0; i < N; ++i) {
+            const double t = static_cast<double>(i);
+            spec.s_in.value = 0.5 + 2.0 * std::sin(2.0 * std::numbers::pi * 10.0 * t / N) + 0.75 * std::cos(2.0 * std::numbers::pi * 32.0 * t / N);
+            spec.step();
+            REQUIRE(spec.s_out.ready == (i + 1 == N));
+        }
+
+        REQUIRE_THAT(spec.s_out.magnitudes[0], WithinAbs(0.5, 1e-9));
+        REQUIRE_THAT(spec.s_out.magnitudes[10], WithinAbs(2.0, 1e-9));
+        REQUIRE_THAT(spec.s_out.magnitudes[32], WithinAbs(0.75, 1e-9));
+
+        if (wf == mtea::WindowFunction::RECTANGULAR) {
+            REQUIRE_THAT(spec.s_out.phases[10], WithinAbs(-std::numbers::pi / 2.0, 1e-9));
+            REQUIRE_THAT(spec.s_out.phases[32], WithinAbs(0.0, 1e-9));
+
+            for (size_t k = 0; k < N / 2 + 1; ++k) {
+                if (k != 0 && k != 10 && k != 32) {
+                    REQUIRE_THAT(spec.s_out.magnitudes[k], WithinAbs(0.0, 1e-9));
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE("Block Spectrum Hop", "[spectrum]") {
+    mtea::spectrum_block<mtea::DataType::F32, 16> spec(4, mtea::WindowFunction::RECTANGULAR);
+    spec.reset();
+
+    std::vector<size_t> ready_steps;
+    for (size_t i = 1; i <= 40; ++i) {
+        spec.s_in.value = static_cast<float>(i);
+        spec.step();
+
+        if (spec.s_out.ready) {
+            ready_steps.push_back(i);
+
+            // The DC bin of the rectangular window is the mean of the last 16 samples
+            REQUIRE_THAT(spec.s_out.magnitudes[0], WithinAbs(static_cast<double>(i) - 7.5, 1e-4));
+        }
+    }
+
+    REQUIRE(ready_steps == std::vector<size_t>{16, 20, 24, 28, 32, 36, 40});
+}
+
+#ifdef MTEA_USE_FULL_LIB
+TEST_CASE("Block Spectrum Creation", "[spectrum]") {
+    const std::array<mtea::DataType, 1> types = {mtea::DataType::F64};
+
+    const mtea::ArgumentBox<mtea::DataType::U32> bad_size(12);
+    REQUIRE_THROWS(mtea::create_block(mtea::BLK_NAME_SPECTRUM, types, &bad_size));
+
+    const mtea::ArgumentBox<mtea::DataType::U32> size(8);
+    auto blk = mtea::create_block(mtea::BLK_NAME_SPECTRUM, types, &size);
+    REQUIRE(blk->get_output_num() == 11);
+    REQUIRE(blk->get_output_name(5) == "phases[0]");
+    REQUIRE(blk->get_output_type(10) == mtea::DataType::BOOL);
+
+    auto* spec = dynamic_cast<mtea::spectrum_block_dynamic<mtea::DataType::F64>*>(blk.get());
+    REQUIRE(spec != nullptr);
+    spec->window_function = mtea::WindowFunction::RECTANGULAR;
+    blk->reset();
+
+    for (size_t i = 0; i < 8; ++i) {
+        spec->s_in.value = std::cos(2.0 * std::numbers::pi * static_cast<double>(i) / 4.0);
+        blk->step();
+    }
+
+    REQUIRE(spec->s_out.ready);
+    REQUIRE_THAT(spec->s_out.magnitudes[2], WithinAbs(1.0, 1e-12));
+
+    const auto copy = blk->clone();
+    REQUIRE(copy->get_signature() == blk->get_signature());
+
+    std::vector<unsigned char> state(blk->get_state_size());
+    std::vector<unsigned char> copy_state(copy->get_state_size());
+    blk->save_state(state.data());
+    copy->save_state(copy_state.data());
+    REQUIRE(state == copy_state);
+}
+#endif
@@ -0,0 +1,192 @@
+// SPDX-License-Identifier: MIT
+
+#include <catch2/catch_all.hpp>
+#include <catch2/matchers/catch_matchers.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "mtea.hpp"
+
+#ifdef MTEA_USE_FULL_LIB
+#include "mtea_creation.hpp"
+#endif
+
+using Catch::Matchers::WithinAbs;
+using Catch::Matchers::WithinRel;
+
+static double stats_input(const size_t i) {
+    return 1000.0 + std::sin(static_cast<double>(i) * 0.37) * 3.0 + static_cast<double>(i % 7);
+}
+
+TEST_CASE("Block Running Stats", "[statistics]") {
+    mtea::running_stats_block<mtea::DataType::F64> stats;
+    stats.reset();
+    stats.s_in.reset_flag = false;
+
+    std::vector<double> values;
+    for (size_t k = 0; k < 500; ++k) {
+        values.push_back(stats_input(k));
+        stats.s_in.value = values.back();
+        stats.step();
+
+        const double n = static_cast<double>(values.size());
+        double mean = 0.0;
+        double mean_sq = 0.0;
+        for (const auto v : values) {
+            mean += v / n;
+            mean_sq += v * v / n;
+        }
+
+        double var = 0.0;
+        for (const auto v : values) {
+            var += (v - mean) * (v - mean);
+        }
+        var = values.size() > 1 ? var / (n - 1.0) : 0.0;
+
+        REQUIRE_THAT(stats.s_out.mean, WithinRel(mean, 1e-12));
+        REQUIRE_THAT(stats.s_out.variance, WithinAbs(var, 1e-8));
+        REQUIRE(stats.s_out.min == *std::min_element(values.begin(), values.end()));
+        REQUIRE(stats.s_out.max == *std::max_element(values.begin(), values.end()));
+        REQUIRE_THAT(stats.s_out.rms, WithinRel(std::sqrt(mean_sq), 1e-12));
+    }
+
+    REQUIRE(stats.get_count() == 500);
+
+    stats.s_in.reset_flag = true;
+    stats.s_in.value = 4.0;
+    stats.step();
+    REQUIRE(stats.get_count() == 1);
+    REQUIRE(stats.s_out.mean == 4.0);
+    REQUIRE(stats.s_out.variance == 0.0);
+    REQUIRE(stats.s_out.min == 4.0);
+    REQUIRE(stats.s_out.max == 4.0);
+}
+
+TEST_CASE("Block Running Stats Integer", "[statistics]") {
+    mtea::running_stats_block<mtea::DataType::I16> stats;
+    stats.reset();
+    stats.s_in.reset_flag = false;
+
+    for (const int16_t v : {-3, 5, 10, -8}) {
+        stats.s_in.value = v;
+        stats.step();
+    }
+
+    REQUIRE(stats.s_out.mean == 1.0);
+    REQUIRE_THAT(stats.s_out.variance, WithinAbs(194.0 / 3.0, 1e-12));
+    REQUIRE(stats.s_out.min == -8);
+    REQUIRE(stats.s_out.max == 10);
+    REQUIRE_THAT(stats.s_out.rms, WithinAbs(std::sqrt(49.5), 1e-12));
+}
+
+TEST_CASE("Block Running Stats Bank", "[statistics]") {
+    const size_t N = 3;
+    mtea::running_stats_bank_block<mtea::DataType::F32, N> bank;
+    std::array<std::unique_ptr<mtea::running_stats_block<mtea::DataType::F32>>, N> singles;
+
+    bank.reset();
+    bank.s_in.reset_flag = false;
+    for (auto& s : singles) {
+        s = std::make_unique<mtea::running_stats_block<mtea::DataType::F32>>();
+        s->reset();
+        s->s_in.reset_flag = false;
+    }
+
+    for (size_t k = 0; k < 200; ++k) {
+        for (size_t i = 0; i < N; ++i) {
+            bank.s_in.values[i] = static_cast<float>(stats_input(k * (i + 1)));
+            singles[i]->s_in.value = bank.s_in.values[i];
+            singles[i]->step();
+        }
+
+        bank.step();
+
+        for (size_t i = 0; i < N; ++i) {
+            REQUIRE_THAT(bank.s_out.means[i], WithinRel(singles[i]->s_out.mean, 1e-5f));
+            REQUIRE_THAT(bank.s_out.variances[i], WithinRel(singles[i]->s_out.variance, 1e-3f));
+            REQUIRE(bank.s_out.mins[i] == singles[i]->s_out.min);
+            REQUIRE(bank.s_out.maxs[i] == singles[i]->s_out.max);
+            REQUIRE_THAT(bank.s_out.rms[i], WithinRel(singles[i]->s_out.rms, 1e-5f));
+        }
+    }
+}
+
+TEST_CASE("Block Moving Average", "[statistics]") {
+    const size_t W = 16;
+    mtea::moving_average_block<mtea::DataType::F64, W> avg;
+    avg.reset();
+    avg.s_in.reset_flag = false;
+
+    std::vector<double> values;
+    for (size_t k = 0; k < 1000; ++k) {
+        values.push_back(stats_input(k) * 1e6);
+        avg.s_in.value = values.back();
+        avg.step();
+
+        const size_t start = values.size() > W ? values.size() - W : 0;
+        double sum = 0.0;
+        for (size_t i = start; i < values.size(); ++i) {
+            sum += values[i];
+        }
+
+        REQUIRE_THAT(avg.s_out.value, WithinRel(sum / static_cast<double>(values.size() - start), 1e-12));
+    }
+
+    mtea::moving_average_block<mtea::DataType::I32, 3> iavg;
+    iavg.reset();
+    iavg.s_in.reset_flag = false;
+
+    const std::array<int32_t, 6> inputs = {3, 6, -9, 12, 0, 7};
+    const std::array<double, 6> expected = {3.0, 4.5, 0.0, 3.0, 1.0, 19.0 / 3.0};
+    for (size_t i = 0; i < inputs.size(); ++i) {
+        iavg.s_in.value = inputs[i];
+        iavg.step();
+        REQUIRE_THAT(iavg.s_out.value, WithinAbs(expected[i], 1e-12));
+    }
+}
+
+#ifdef MTEA_USE_FULL_LIB
+TEST_CASE("Block Statistics Creation", "[statistics]") {
+    const std::array<mtea::DataType, 1> types = {mtea::DataType::I32};
+
+    auto stats = mtea::create_block(mtea::BLK_NAME_RUNNING_STATS, types);
+    REQUIRE(stats->get_output_num() == 5);
+    REQUIRE(stats->get_output_type(0) == mtea::DataType::F64);
+    REQUIRE(stats->get_output_type(2) == mtea::DataType::I32);
+
+    const mtea::ArgumentBox<mtea::DataType::U32> size(4);
+    auto bank = mtea::create_block(mtea::BLK_NAME_STATS_BANK, types, &size);
+    REQUIRE(bank->get_input_num() == 5);
+    REQUIRE(bank->get_output_num() == 20);
+    REQUIRE(bank->get_output_name(5) == "variances[1]");
+    REQUIRE(bank->get_output_type(5) == mtea::DataType::F64);
+    REQUIRE(bank->get_output_type(8) == mtea::DataType::I32);
+
+    auto avg = mtea::create_block(mtea::BLK_NAME_MOVING_AVERAGE, types, &size);
+    auto* a = dynamic_cast<mtea::moving_average_block_dynamic<mtea::DataType::I32>*>(avg.get());
+    REQUIRE(a != nullptr);
+    REQUIRE(a->get_window_size() == 4);
+
+    avg->reset();
+    a->s_in.reset_flag = false;
+    for (int32_t i = 1; i <= 6; ++i) {
+        a->s_in.value = i;
+        avg->step();
+    }
+    REQUIRE(a->s_out.value == 4.5);
+
+    std::vector<unsigned char> state(avg->get_state_size());
+    avg->save_state(state.data());
+    avg->reset();
+    avg->load_state(state.data());
+    REQUIRE(a->s_out.value == 4.5);
+
+    for (const auto* blk : {stats.get(), bank.get(), avg.get()}) {
+        const auto copy = blk->clone();
+        REQUIRE(copy->get_signature() == blk->get_signature());
+    }
+}
+#endif
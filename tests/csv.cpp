@@ -0,0 +1,149 @@
+// SPDX-License-Identifier: MIT
+
+#include <catch2/catch_all.hpp>
+
+#ifdef MTEA_USE_FULL_LIB
+
+#include <sstream>
+
+#include "mtea.hpp"
+#include "mtea_csv.hpp"
+
+using namespace mtea;
+
+static const auto CSV_TYPES = std::to_array({DataType::F64, DataType::I32, DataType::BOOL});
+
+static std::string make_test_csv(const size_t row_num) {
+    std::ostringstream oss;
+    oss << "time, count, active\r\n";
+
+    for (size_t i = 0; i < row_num; ++i) {
+        oss << static_cast<double>(i) * 0.5 << ", " << static_cast<int32_t>(i) - 10 << "," << (i % 3 == 0 ? "true" : "0") << "\n";
+    }
+
+    return oss.str();
+}
+
+static void read_test_csv(const size_t row_num, const csv_options& options) {
+    std::istringstream iss(make_test_csv(row_num));
+    csv_reader reader(iss, CSV_TYPES, options);
+
+    REQUIRE(reader.get_column_names() == std::vector<std::string>{"time", "count", "active"});
+
+    size_t row = 0;
+    while (reader.next_chunk()) {
+        REQUIRE(reader.get_start_row() == row);
+        REQUIRE(reader.get_row_num() <= options.chunk_rows);
+
+        const auto time = reader.get_column<DataType::F64>(0);
+        const auto count = reader.get_column<DataType::I32>(1);
+        const auto active = reader.get_column<DataType::BOOL>(2);
+
+        for (size_t i = 0; i < reader.get_row_num(); ++i, ++row) {
+            REQUIRE(time[i] == static_cast<double>(row) * 0.5);
+            REQUIRE(count[i] == static_cast<int32_t>(row) - 10);
+            REQUIRE(active[i] == (row % 3 == 0));
+        }
+    }
+
+    REQUIRE(row == row_num);
+    REQUIRE_FALSE(reader.next_chunk());
+}
+
+TEST_CASE("CSV Reader", "[csv]") {
+    read_test_csv(10000, csv_options{.chunk_rows = 999, .prefetch = true});
+    read_test_csv(10000, csv_options{.chunk_rows = 1000, .prefetch = false});
+    read_test_csv(0, csv_options{});
+}
+
+TEST_CASE("CSV Reader Source Block", "[csv]") {
+    std::istringstream iss("1.0\n2.0\n3.0\n4.0\n5.0");
+    csv_reader reader(iss, std::to_array({DataType::F64}), csv_options{.has_header = false, .chunk_rows = 2});
+
+    REQUIRE(reader.next_chunk());
+    auto column = reader.get_column<DataType::F64>(0);
+
+    source_block<DataType::F64> source(column.data(), column.size());
+    source.reset();
+
+    std::vector<double> values;
+    while (true) {
+        if (source.is_finished()) {
+            if (!reader.next_chunk()) {
+                break;
+            }
+
+            column = reader.get_column<DataType::F64>(0);
+            source.set_data(column.data(), column.size());
+        }
+
+        values.push_back(source.s_out.value);
+        source.step();
+    }
+
+    REQUIRE(values == std::vector<double>{1.0, 2.0, 3.0, 4.0, 5.0});
+}
+
+TEST_CASE("CSV Reader Source Block Interpolation", "[csv]") {
+    std::istringstream iss("1.0\n2.0\n3.0\n4.0\n5.0");
+    csv_reader reader(iss, std::to_array({DataType::F64}), csv_options{.has_header = false, .chunk_rows = 2});
+
+    REQUIRE(reader.next_chunk());
+    auto column = reader.get_column<DataType::F64>(0);
+
+    source_block<DataType::F64> source(column.data(), column.size(), 0.5);
+    source.reset();
+
+    std::vector<double> values;
+    while (true) {
+        if (source.is_finished()) {
+            if (!reader.next_chunk()) {
+                break;
+            }
+
+            column = reader.get_column<DataType::F64>(0);
+            source.set_data(column.data(), column.size());
+        }
+
+        values.push_back(source.s_out.value);
+        source.step();
+    }
+
+    // The values between chunks interpolate from the final sample of the previous chunk, whose buffer is already
+    // being refilled by the prefetch
+    REQUIRE(values == std::vector<double>{1.0, 1.5, 2.0, 2.5, 3.0, 3.5, 4.0, 4.5, 5.0});
+}
+
+TEST_CASE("CSV Reader Invalid", "[csv]") {
+    {
+        std::istringstream iss("a,b,c\n1.0,2,true\n1.0,x,true\n");
+        csv_reader reader(iss, CSV_TYPES, csv_options{.chunk_rows = 1});
+        REQUIRE(reader.next_chunk());
+        REQUIRE_THROWS(reader.next_chunk());
+    }
+
+    {
+        std::istringstream iss("1.0,2\n");
+        csv_reader reader(iss, CSV_TYPES, csv_options{.has_header = false});
+        REQUIRE_THROWS(reader.next_chunk());
+    }
+
+    {
+        std::istringstream iss("1.0,2,1,4\n");
+        csv_reader reader(iss, CSV_TYPES, csv_options{.has_header = false});
+        REQUIRE_THROWS(reader.next_chunk());
+    }
+
+    {
+        std::istringstream iss("a,b\n");
+        REQUIRE_THROWS(csv_reader(iss, CSV_TYPES));
+    }
+
+    std::istringstream iss("1.0,2,1\n");
+    csv_reader reader(iss, CSV_TYPES, csv_options{.has_header = false});
+    REQUIRE(reader.next_chunk());
+    REQUIRE_THROWS(reader.get_column<DataType::F32>(0));
+    REQUIRE_THROWS(reader.get_column<DataType::F64>(3));
+}
+
+#endif
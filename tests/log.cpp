@@ -0,0 +1,171 @@
+// SPDX-License-Identifier: MIT
+
+#include <catch2/catch_all.hpp>
+
+#ifdef MTEA_USE_FULL_LIB
+
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+#include "mtea_log.hpp"
+
+using namespace mtea;
+
+static const size_t LOG_STEP_NUM = 10000;
+
+static const auto LOG_SIGNALS = std::to_array<log_signal>({
+    {"time", DataType::F64},
+    {"angle", DataType::F32},
+    {"count", DataType::I32},
+    {"active", DataType::BOOL},
+    {"ticks", DataType::U64},
+});
+
+static double log_time(const size_t i) {
+    return static_cast<double>(i) * 0.001;
+}
+
+static float log_angle(const size_t i) {
+    return std::sin(static_cast<float>(i) * 0.01f);
+}
+
+static int32_t log_count(const size_t i) {
+    return static_cast<int32_t>(i / 7) - 500;
+}
+
+static bool log_active(const size_t i) {
+    return (i / 3) % 2 == 0;
+}
+
+static type_info<DataType::U64>::type_t log_ticks(const size_t i) {
+    return static_cast<type_info<DataType::U64>::type_t>(0xffff0000u + i * 3);
+}
+
+static std::string write_test_log(const size_t chunk_size) {
+    std::ostringstream oss(std::ios::binary);
+    log_writer writer(oss, LOG_SIGNALS, chunk_size);
+
+    for (size_t i = 0; i < LOG_STEP_NUM; ++i) {
+        writer.write<DataType::F64>(0, log_time(i));
+        writer.write<DataType::F32>(1, log_angle(i));
+        writer.write<DataType::I32>(2, log_count(i));
+        writer.write<DataType::BOOL>(3, log_active(i));
+        writer.write<DataType::U64>(4, log_ticks(i));
+        writer.end_step();
+    }
+
+    writer.flush();
+    return oss.str();
+}
+
+static void check_test_log(const log_reader& reader, const size_t start, const size_t num) {
+    std::vector<double> time(num);
+    std::vector<float> angle(num);
+    std::vector<int32_t> count(num);
+    auto active = std::make_unique<bool[]>(num);
+    std::vector<type_info<DataType::U64>::type_t> ticks(num);
+
+    const size_t expected = std::min(num, LOG_STEP_NUM - start);
+
+    REQUIRE(reader.read<DataType::F64>(0, start, time) == expected);
+    REQUIRE(reader.read<DataType::F32>(1, start, angle) == expected);
+    REQUIRE(reader.read<DataType::I32>(2, start, count) == expected);
+    REQUIRE(reader.read<DataType::BOOL>(3, start, std::span<bool>(active.get(), num)) == expected);
+    REQUIRE(reader.read<DataType::U64>(4, start, ticks) == expected);
+
+    for (size_t i = 0; i < expected; ++i) {
+        REQUIRE(time[i] == log_time(start + i));
+        REQUIRE(angle[i] == log_angle(start + i));
+        REQUIRE(count[i] == log_count(start + i));
+        REQUIRE(active[i] == log_active(start + i));
+        REQUIRE(ticks[i] == log_ticks(start + i));
+    }
+}
+
+static std::span<const std::byte> as_bytes(const std::string& s) {
+    return std::as_bytes(std::span<const char>(s.data(), s.size()));
+}
+
+TEST_CASE("Log Round Trip", "[log]") {
+    const auto data = write_test_log(1000);
+    const log_reader reader(as_bytes(data));
+
+    REQUIRE(reader.get_signal_num() == LOG_SIGNALS.size());
+    REQUIRE(reader.get_step_num() == LOG_STEP_NUM);
+    REQUIRE(reader.get_chunk_num() == 10);
+    REQUIRE(reader.find_signal("count") == 2);
+    REQUIRE(reader.get_signal(1).type == DataType::F32);
+
+    check_test_log(reader, 0, LOG_STEP_NUM);
+    check_test_log(reader, 999, 2);
+    check_test_log(reader, 4321, 1234);
+    check_test_log(reader, LOG_STEP_NUM - 5, 100);
+
+    const size_t raw_size = LOG_STEP_NUM * (sizeof(double) + sizeof(float) + sizeof(int32_t) + sizeof(bool) + sizeof(uint64_t));
+    REQUIRE(data.size() < raw_size / 2);
+}
+
+TEST_CASE("Log Partial Chunk", "[log]") {
+    const auto data = write_test_log(3000);
+    const log_reader reader(as_bytes(data));
+
+    REQUIRE(reader.get_chunk_num() == 4);
+    check_test_log(reader, 8990, 20);
+}
+
+TEST_CASE("Log Invalid", "[log]") {
+    std::ostringstream oss(std::ios::binary);
+    log_writer writer(oss, LOG_SIGNALS);
+
+    REQUIRE_THROWS(writer.write<DataType::F32>(0, 1.0f));
+    REQUIRE_THROWS(writer.write<DataType::F64>(LOG_SIGNALS.size(), 1.0));
+
+    writer.write<DataType::F64>(0, 1.0);
+    REQUIRE_THROWS(writer.end_step());
+
+    auto data = write_test_log(1000);
+    data.resize(data.size() - 1);
+    REQUIRE_THROWS(log_reader(as_bytes(data)));
+
+    data[0] = 'x';
+    REQUIRE_THROWS(log_reader(as_bytes(data)));
+
+    // The name size of the first signal follows the 16 byte header and the signal type
+    auto corrupt = write_test_log(1000);
+    const uint32_t name_size = 0xffffffff;
+    std::memcpy(corrupt.data() + 20, &name_size, sizeof(name_size));
+    REQUIRE_THROWS_WITH(log_reader(as_bytes(corrupt)), "log signal name truncated");
+}
+
+TEST_CASE("Log Mapped File", "[log]") {
+    const auto path = std::filesystem::temp_directory_path() / "mtea_log_test.bin";
+
+    {
+        std::ofstream file(path, std::ios::binary);
+        const auto data = write_test_log(512);
+        file.write(data.data(), static_cast<std::streamsize>(data.size()));
+    }
+
+    {
+        const mapped_file file(path.string());
+        const log_reader reader(file.get_data());
+
+        REQUIRE(reader.get_step_num() == LOG_STEP_NUM);
+        check_test_log(reader, 511, 1030);
+    }
+
+    {
+        const mapped_file file(path.string(), true);
+        const log_reader reader(file.get_data());
+
+        REQUIRE(reader.get_step_num() == LOG_STEP_NUM);
+        check_test_log(reader, 0, LOG_STEP_NUM);
+    }
+
+    std::filesystem::remove(path);
+}
+
+#endif
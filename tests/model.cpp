@@ -0,0 +1,649 @@
+// SPDX-License-Identifier: MIT
+
+#ifdef MTEA_USE_FULL_LIB
+
+#include <catch2/catch_all.hpp>
+
+#include "mtea.hpp"
+#include "mtea_creation.hpp"
+#include "mtea_model.hpp"
+#include "mtea_string.hpp"
+
+#include <array>
+#include <cmath>
+#include <memory>
+#include <vector>
+
+struct supervisory_model {
+    explicit supervisory_model(const bool lazy) {
+        using namespace mtea;
+
+        const auto f64 = std::to_array({DataType::F64});
+
+        const ArgumentBox<DataType::F64> gain_a(0.25);
+        const ArgumentBox<DataType::F64> gain_b(3.0);
+        const ArgumentBox<DataType::F64> threshold(0.45);
+        const ArgumentBox<DataType::F64> time_step(0.1);
+        const ArgumentBox<DataType::U32> size(2);
+
+        const auto const_a = model.add_block(create_block(BLK_NAME_CONST, f64, &gain_a));
+        const auto const_b = model.add_block(create_block(BLK_NAME_CONST, f64, &gain_b));
+        const auto const_t = model.add_block(create_block(BLK_NAME_CONST, f64, &threshold));
+        const auto mul = model.add_block(create_block(BLK_NAME_ARITH_MUL, f64, &size));
+        const auto sin = model.add_block(create_block(BLK_NAME_TRIG_SIN, f64));
+        const auto clock = model.add_block(create_block(BLK_NAME_CLOCK, f64, &time_step));
+        const auto add = model.add_block(create_block(BLK_NAME_ARITH_ADD, f64, &size));
+        const auto gt = model.add_block(create_block(BLK_NAME_REL_GT, f64));
+
+        model.connect({const_a, 0}, mul, 0);
+        model.connect({const_b, 0}, mul, 1);
+        model.connect({mul, 0}, sin, 0);
+        model.connect({clock, 0}, add, 0);
+        model.connect({sin, 0}, add, 1);
+        model.connect({clock, 0}, gt, 0);
+        model.connect({const_t, 0}, gt, 1);
+
+        sum = {add, 0};
+        flag = {gt, 0};
+
+        model.set_lazy_evaluation(lazy);
+        model.reset();
+    }
+
+    mtea::block_model model;
+    mtea::model_port sum{};
+    mtea::model_port flag{};
+};
+
+TEST_CASE("Model Lazy Evaluation", "[model]") {
+    using namespace mtea;
+
+    supervisory_model eager(false);
+    supervisory_model lazy(true);
+
+    REQUIRE_FALSE(eager.model.get_lazy_evaluation());
+    REQUIRE(lazy.model.get_lazy_evaluation());
+
+    ArgumentBox<DataType::F64> eager_sum;
+    ArgumentBox<DataType::F64> lazy_sum;
+    ArgumentBox<DataType::BOOL> eager_flag;
+    ArgumentBox<DataType::BOOL> lazy_flag;
+
+    for (size_t i = 0; i < 10; ++i) {
+        eager.model.step();
+        lazy.model.step();
+
+        eager.model.get_output(eager.sum, &eager_sum);
+        lazy.model.get_output(lazy.sum, &lazy_sum);
+        eager.model.get_output(eager.flag, &eager_flag);
+        lazy.model.get_output(lazy.flag, &lazy_flag);
+
+        REQUIRE(lazy_sum.value == eager_sum.value);
+        REQUIRE(lazy_flag.value == eager_flag.value);
+        REQUIRE(lazy_flag.value == (i >= 4));
+    }
+
+    // The constants, product and sine are only stepped once, while the clock and its consumers step every time
+    REQUIRE(eager.model.get_evaluation_num() == 8 * 10);
+    REQUIRE(lazy.model.get_evaluation_num() == 8 + 3 * 9);
+
+    lazy.model.reset();
+    REQUIRE(lazy.model.get_evaluation_num() == 0);
+    lazy.model.step();
+    REQUIRE(lazy.model.get_evaluation_num() == 8);
+}
+
+TEST_CASE("Model Lazy Evaluation Stateful", "[model]") {
+    using namespace mtea;
+
+    const auto f64 = std::to_array({DataType::F64});
+    const ArgumentBox<DataType::F64> value(2.0);
+
+    block_model model;
+    const auto in = model.add_block(create_block(BLK_NAME_CONST, f64, &value));
+    const auto delay = model.add_block(create_block(BLK_NAME_DELAY, f64));
+    model.connect({in, 0}, delay, 0);
+
+    model.set_lazy_evaluation(true);
+    model.reset();
+
+    ArgumentBox<DataType::F64> out;
+    model.step();
+    model.get_output({delay, 0}, &out);
+    REQUIRE(out.value == 0.0);
+
+    // The delay input is unchanged, but the delay must still be stepped to produce the delayed value
+    model.step();
+    model.get_output({delay, 0}, &out);
+    REQUIRE(out.value == 2.0);
+    REQUIRE(model.get_evaluation_num() == 3);
+}
+
+TEST_CASE("Model Structure", "[model]") {
+    using namespace mtea;
+
+    const auto f64 = std::to_array({DataType::F64});
+    const auto f32 = std::to_array({DataType::F32});
+    const ArgumentBox<DataType::U32> size(2);
+
+    block_model model;
+    const auto add = model.add_block(create_block(BLK_NAME_ARITH_ADD, f64, &size));
+    const auto sin = model.add_block(create_block(BLK_NAME_TRIG_SIN, f32));
+
+    REQUIRE(model.get_block_num() == 2);
+    REQUIRE(model.has_block(add));
+    REQUIRE_FALSE(model.has_block(5));
+    REQUIRE_THROWS(model.add_block(nullptr));
+
+    REQUIRE_THROWS(model.connect({add, 0}, sin, 0));
+    REQUIRE_THROWS(model.connect({add, 1}, add, 0));
+    REQUIRE_THROWS(model.connect({add, 0}, add, 2));
+    REQUIRE_THROWS(model.step());
+
+    model.connect({add, 0}, add, 0);
+    REQUIRE(model.get_source(add, 0).has_value());
+    REQUIRE_FALSE(model.get_source(add, 1).has_value());
+    REQUIRE_THROWS(model.reset());
+}
+
+TEST_CASE("Model Constant Folding", "[model]") {
+    using namespace mtea;
+
+    const auto f64 = std::to_array({DataType::F64});
+    const auto f64_to_f32 = std::to_array({DataType::F64, DataType::F32});
+    const auto f32 = std::to_array({DataType::F32});
+
+    const ArgumentBox<DataType::F64> value_a(0.25);
+    const ArgumentBox<DataType::F64> value_b(3.0);
+    const ArgumentBox<DataType::U32> size(2);
+
+    block_model model;
+    const auto const_a = model.add_block(create_block(BLK_NAME_CONST, f64, &value_a));
+    const auto const_b = model.add_block(create_block(BLK_NAME_CONST, f64, &value_b));
+    const auto mul = model.add_block(create_block(BLK_NAME_ARITH_MUL, f64, &size));
+    const auto conv = model.add_block(create_block(BLK_NAME_CONVERSION, f64_to_f32));
+    const auto sin = model.add_block(create_block(BLK_NAME_TRIG_SIN, f32));
+    const auto unused = model.add_block(create_block(BLK_NAME_TRIG_COS, f64));
+    const auto delay = model.add_block(create_block(BLK_NAME_DELAY, f32));
+
+    model.connect({const_a, 0}, mul, 0);
+    model.connect({const_b, 0}, mul, 1);
+    model.connect({mul, 0}, conv, 0);
+    model.connect({conv, 0}, sin, 0);
+    model.connect({mul, 0}, unused, 0);
+    model.connect({sin, 0}, delay, 0);
+    model.add_output({sin, 0});
+
+    REQUIRE(model.fold_constants() == 4);
+    REQUIRE_FALSE(model.has_block(mul));
+    REQUIRE_FALSE(model.has_block(sin));
+
+    const auto folded = model.get_outputs()[0];
+    REQUIRE(model.get_block(folded.block).get_block_name() == BLK_NAME_CONST);
+    REQUIRE(model.get_source(delay, 0)->block == folded.block);
+
+    // Only the folded sine result, feeding the output and the delay, and the stateful delay remain
+    REQUIRE(model.remove_unused_blocks() == 5);
+    REQUIRE(model.get_block_num() == 2);
+    REQUIRE(model.has_block(delay));
+    REQUIRE_FALSE(model.has_block(const_a));
+    REQUIRE_FALSE(model.has_block(unused));
+    REQUIRE(model.remove_unused_blocks() == 0);
+
+    const float expected = std::sin(static_cast<float>(0.25 * 3.0));
+
+    ArgumentBox<DataType::F32> out;
+    model.reset();
+    model.step();
+    model.step();
+
+    model.get_output(folded, &out);
+    REQUIRE(out.value == expected);
+    model.get_output({delay, 0}, &out);
+    REQUIRE(out.value == expected);
+}
+
+TEST_CASE("Model Remove Unused Stateful", "[model]") {
+    using namespace mtea;
+
+    const auto f64 = std::to_array({DataType::F64});
+    const ArgumentBox<DataType::F64> time_step(0.1);
+
+    block_model model;
+    const auto clock = model.add_block(create_block(BLK_NAME_CLOCK, f64, &time_step));
+    const auto sin = model.add_block(create_block(BLK_NAME_TRIG_SIN, f64));
+    model.connect({clock, 0}, sin, 0);
+
+    // The clock is stateful and must be kept, and the sine is not folded since the clock is not constant
+    REQUIRE(model.fold_constants() == 0);
+    REQUIRE(model.remove_unused_blocks() == 1);
+    REQUIRE(model.has_block(clock));
+    REQUIRE_FALSE(model.has_block(sin));
+}
+
+TEST_CASE("Model Merge Duplicates", "[model]") {
+    using namespace mtea;
+
+    const auto f64 = std::to_array({DataType::F64});
+    const ArgumentBox<DataType::F64> time_step(0.1);
+    const ArgumentBox<DataType::U32> size(2);
+
+    block_model model;
+    const auto clock = model.add_block(create_block(BLK_NAME_CLOCK, f64, &time_step));
+    const auto sin_a = model.add_block(create_block(BLK_NAME_TRIG_SIN, f64));
+    const auto sin_b = model.add_block(create_block(BLK_NAME_TRIG_SIN, f64));
+    const auto cos = model.add_block(create_block(BLK_NAME_TRIG_COS, f64));
+    const auto mul_a = model.add_block(create_block(BLK_NAME_ARITH_MUL, f64, &size));
+    const auto mul_b = model.add_block(create_block(BLK_NAME_ARITH_MUL, f64, &size));
+    const auto delay_a = model.add_block(create_block(BLK_NAME_DELAY, f64));
+    const auto delay_b = model.add_block(create_block(BLK_NAME_DELAY, f64));
+    const auto add = model.add_block(create_block(BLK_NAME_ARITH_ADD, f64, &size));
+
+    model.connect({clock, 0}, sin_a, 0);
+    model.connect({clock, 0}, sin_b, 0);
+    model.connect({clock, 0}, cos, 0);
+    model.connect({sin_a, 0}, mul_a, 0);
+    model.connect({cos, 0}, mul_a, 1);
+    model.connect({sin_b, 0}, mul_b, 0);
+    model.connect({cos, 0}, mul_b, 1);
+    model.connect({clock, 0}, delay_a, 0);
+    model.connect({clock, 0}, delay_b, 0);
+    model.connect({mul_a, 0}, add, 0);
+    model.connect({mul_b, 0}, add, 1);
+    model.add_output({add, 0});
+
+    model.reset();
+    for (size_t i = 0; i < 5; ++i) {
+        model.step();
+    }
+
+    ArgumentBox<DataType::F64> expected;
+    model.get_output({add, 0}, &expected);
+
+    // The second sine merges first, which then makes the second product a duplicate of the first
+    REQUIRE(model.merge_duplicates() == 2);
+    REQUIRE(model.has_block(sin_a));
+    REQUIRE_FALSE(model.has_block(sin_b));
+    REQUIRE(model.has_block(cos));
+    REQUIRE_FALSE(model.has_block(mul_b));
+    REQUIRE(model.has_block(delay_a));
+    REQUIRE(model.has_block(delay_b));
+    REQUIRE(model.get_source(add, 0)->block == mul_a);
+    REQUIRE(model.get_source(add, 1)->block == mul_a);
+    REQUIRE(model.merge_duplicates() == 0);
+
+    ArgumentBox<DataType::F64> out;
+    model.reset();
+    for (size_t i = 0; i < 5; ++i) {
+        model.step();
+    }
+
+    model.get_output({add, 0}, &out);
+    REQUIRE(out.value == expected.value);
+}
+
+TEST_CASE("Model Merge Lookup Tables", "[model]") {
+    using namespace mtea;
+
+    using lookup_t = lookup_block<DataType::F64, 1>;
+
+    const auto f64 = std::to_array({DataType::F64});
+    const ArgumentBox<DataType::F64> input(0.5);
+
+    const auto breakpoints = std::to_array<double>({0.0, 1.0});
+    const auto table_a = std::to_array<double>({0.0, 10.0});
+    const auto table_b = std::to_array<double>({0.0, -10.0});
+    const auto table_c = std::to_array<double>({0.0, 10.0});
+
+    block_model model;
+    const auto in = model.add_block(create_block(BLK_NAME_CONST, f64, &input));
+    const auto lookup_a = model.add_block(std::make_unique<lookup_t>(std::to_array({breakpoints.data()}), std::to_array({breakpoints.size()}), table_a.data()));
+    const auto lookup_b = model.add_block(std::make_unique<lookup_t>(std::to_array({breakpoints.data()}), std::to_array({breakpoints.size()}), table_b.data()));
+    const auto lookup_c = model.add_block(std::make_unique<lookup_t>(std::to_array({breakpoints.data()}), std::to_array({breakpoints.size()}), table_c.data()));
+
+    for (const auto blk : {lookup_a, lookup_b, lookup_c}) {
+        model.connect({in, 0}, blk, 0);
+        model.add_output({blk, 0});
+    }
+
+    // Tables with equal values merge even when stored separately, while different tables are kept apart
+    // The data is summarized by a hash, and equal hashes are confirmed against the data itself
+    REQUIRE(model.get_block(lookup_a).get_parameters() == model.get_block(lookup_c).get_parameters());
+    REQUIRE(model.get_block(lookup_a).get_parameters() != model.get_block(lookup_b).get_parameters());
+    REQUIRE(model.get_block(lookup_a).has_equal_parameters(model.get_block(lookup_c)));
+    REQUIRE_FALSE(model.get_block(lookup_a).has_equal_parameters(model.get_block(lookup_b)));
+    REQUIRE_FALSE(model.get_block(lookup_a).has_equal_parameters(model.get_block(in)));
+    REQUIRE(model.merge_duplicates() == 1);
+    REQUIRE(model.has_block(lookup_b));
+    REQUIRE_FALSE(model.has_block(lookup_c));
+
+    model.reset();
+    model.step();
+
+    ArgumentBox<DataType::F64> out;
+    model.get_output(model.get_outputs()[0], &out);
+    REQUIRE(out.value == 5.0);
+    model.get_output(model.get_outputs()[1], &out);
+    REQUIRE(out.value == -5.0);
+    model.get_output(model.get_outputs()[2], &out);
+    REQUIRE(out.value == 5.0);
+}
+
+struct parameter_model {
+    parameter_model() {
+        using namespace mtea;
+
+        const auto f64 = std::to_array({DataType::F64});
+
+        const ArgumentBox<DataType::F64> gain(2.0);
+        const ArgumentBox<DataType::F64> upper(1.5);
+        const ArgumentBox<DataType::F64> lower(-1.0);
+        const ArgumentBox<DataType::F64> threshold(0.45);
+        const ArgumentBox<DataType::F64> reset_value(3.0);
+        const ArgumentBox<DataType::F64> time_step(0.1);
+        const ArgumentBox<DataType::U32> size(2);
+
+        const_gain = model.add_block(create_block(BLK_NAME_CONST, f64, &gain));
+        const_upper = model.add_block(create_block(BLK_NAME_CONST, f64, &upper));
+        const_lower = model.add_block(create_block(BLK_NAME_CONST, f64, &lower));
+        const_threshold = model.add_block(create_block(BLK_NAME_CONST, f64, &threshold));
+        const_reset = model.add_block(create_block(BLK_NAME_CONST, f64, &reset_value));
+
+        const auto clock = model.add_block(create_block(BLK_NAME_CLOCK, f64, &time_step));
+        mul = model.add_block(create_block(BLK_NAME_ARITH_MUL, f64, &size));
+        sub = model.add_block(create_block(BLK_NAME_ARITH_SUB, f64, &size));
+        limiter = model.add_block(create_block(BLK_NAME_LIMITER, f64));
+        gt = model.add_block(create_block(BLK_NAME_REL_GT, f64));
+        delay = model.add_block(create_block(BLK_NAME_DELAY, f64));
+        integ = model.add_block(create_block(BLK_NAME_INTEG, f64, &time_step));
+
+        model.connect({clock, 0}, mul, 0);
+        model.connect({const_gain, 0}, mul, 1);
+        model.connect({const_gain, 0}, sub, 0);
+        model.connect({clock, 0}, sub, 1);
+        model.connect({mul, 0}, limiter, 0);
+        model.connect({const_upper, 0}, limiter, 1);
+        model.connect({const_lower, 0}, limiter, 2);
+        model.connect({clock, 0}, gt, 0);
+        model.connect({const_threshold, 0}, gt, 1);
+
+        for (const auto blk : {delay, integ}) {
+            model.connect({limiter, 0}, blk, 0);
+            model.connect({const_reset, 0}, blk, 1);
+            model.connect({gt, 0}, blk, 2);
+            model.add_output({blk, 0});
+        }
+
+        model.add_output({sub, 0});
+        model.add_output({gt, 0});
+    }
+
+    mtea::block_model model;
+
+    size_t const_gain{};
+    size_t const_upper{};
+    size_t const_lower{};
+    size_t const_threshold{};
+    size_t const_reset{};
+
+    size_t mul{};
+    size_t sub{};
+    size_t limiter{};
+    size_t gt{};
+    size_t delay{};
+    size_t integ{};
+};
+
+TEST_CASE("Model Specialize Blocks", "[model]") {
+    using namespace mtea;
+
+    parameter_model reference;
+    parameter_model specialized;
+    auto& model = specialized.model;
+
+    // The subtraction takes its constant as the minuend, for which no specialized variant exists
+    REQUIRE(model.specialize_blocks() == 5);
+    REQUIRE(model.has_block(specialized.sub));
+    for (const auto blk : {specialized.mul, specialized.limiter, specialized.gt, specialized.delay, specialized.integ}) {
+        REQUIRE_FALSE(model.has_block(blk));
+    }
+
+    // Only the constant still feeding the subtraction is kept
+    REQUIRE(model.has_block(specialized.const_gain));
+    for (const auto blk : {specialized.const_upper, specialized.const_lower, specialized.const_threshold, specialized.const_reset}) {
+        REQUIRE_FALSE(model.has_block(blk));
+    }
+    REQUIRE(model.get_block_num() == 8);
+
+    const auto outputs = model.get_outputs();
+    REQUIRE(model.get_block(outputs[0].block).get_block_name() == BLK_NAME_DELAY_CONST);
+    REQUIRE(model.get_block(outputs[1].block).get_block_name() == BLK_NAME_INTEG_CONST);
+    REQUIRE(model.get_block(outputs[2].block).get_block_name() == BLK_NAME_ARITH_SUB);
+    REQUIRE(model.get_block(outputs[3].block).get_block_name() == BLK_NAME_REL_GT_CONST);
+
+    // The flag input moves from the third to the second port of the specialized delay
+    REQUIRE(model.get_source(outputs[0].block, 1)->block == outputs[3].block);
+    REQUIRE(model.get_block(model.get_source(outputs[0].block, 0)->block).get_block_name() == BLK_NAME_LIMITER_CONST);
+
+    REQUIRE(model.specialize_blocks() == 0);
+
+    reference.model.reset();
+    model.reset();
+
+    for (size_t k = 0; k < 20; ++k) {
+        reference.model.step();
+        model.step();
+
+        for (size_t i = 0; i < 3; ++i) {
+            ArgumentBox<DataType::F64> expected;
+            ArgumentBox<DataType::F64> actual;
+            reference.model.get_output(reference.model.get_outputs()[i], &expected);
+            model.get_output(outputs[i], &actual);
+            REQUIRE(actual.value == expected.value);
+        }
+
+        ArgumentBox<DataType::BOOL> expected_flag;
+        ArgumentBox<DataType::BOOL> actual_flag;
+        reference.model.get_output(reference.model.get_outputs()[3], &expected_flag);
+        model.get_output(outputs[3], &actual_flag);
+        REQUIRE(actual_flag.value == expected_flag.value);
+    }
+}
+
+TEST_CASE("Model Attach Recorder", "[model]") {
+    using namespace mtea;
+
+    const auto f64 = std::to_array({DataType::F64});
+    const ArgumentBox<DataType::F64> time_step(0.5);
+    const ArgumentBox<DataType::F64> threshold(1.2);
+
+    block_model model;
+    const auto clock = model.add_block(create_block(BLK_NAME_CLOCK, f64, &time_step));
+    const auto limit = model.add_block(create_block(BLK_NAME_CONST, f64, &threshold));
+    const auto gt = model.add_block(create_block(BLK_NAME_REL_GT, f64));
+    model.connect({clock, 0}, gt, 0);
+    model.connect({limit, 0}, gt, 1);
+
+    const auto always = model.attach_recorder({clock, 0}, 8, 2);
+    const auto gated = model.attach_recorder({clock, 0}, 8, 2, model_port{gt, 0});
+    REQUIRE(model.get_source(always, 0)->block == clock);
+    REQUIRE(model.get_source(gated, 1)->block == gt);
+
+    // The enable port must provide a flag, and the model is unchanged if it does not
+    const size_t block_num = model.get_block_num();
+    REQUIRE_THROWS(model.attach_recorder({clock, 0}, 8, 1, model_port{limit, 0}));
+    REQUIRE_THROWS(model.attach_recorder({clock, 1}, 8));
+    REQUIRE(model.get_block_num() == block_num);
+
+    // The recorders are stateful and are kept even though no block consumes their outputs
+    REQUIRE(model.remove_unused_blocks() == 0);
+
+    model.reset();
+    for (size_t k = 0; k < 6; ++k) {
+        model.step();
+    }
+
+    std::array<double, 8> values{};
+
+    auto& always_rec = dynamic_cast<recorder_block_dynamic<DataType::F64>&>(model.get_block(always));
+    REQUIRE(always_rec.get_decimation() == 2);
+    REQUIRE(always_rec.read(values.data(), values.size()) == 3);
+    REQUIRE(values[0] == 0.5);
+    REQUIRE(values[1] == 1.5);
+    REQUIRE(values[2] == 2.5);
+
+    auto& gated_rec = dynamic_cast<recorder_block_dynamic<DataType::F64>&>(model.get_block(gated));
+    REQUIRE(gated_rec.read(values.data(), values.size()) == 2);
+    REQUIRE(values[0] == 1.5);
+    REQUIRE(values[1] == 2.5);
+}
+
+// Feeds the delay and the integrator back into their own inputs, such that both are stepped with the port values of
+// the previous step
+struct feedback_model {
+    feedback_model() {
+        using namespace mtea;
+
+        const auto f64 = std::to_array({DataType::F64});
+
+        const ArgumentBox<DataType::F64> gain(-0.5);
+        const ArgumentBox<DataType::F64> reset_value(1.0);
+        const ArgumentBox<DataType::F64> threshold(100.0);
+        const ArgumentBox<DataType::F64> time_step(0.1);
+        const ArgumentBox<DataType::U32> size(2);
+
+        const auto const_gain = model.add_block(create_block(BLK_NAME_CONST, f64, &gain));
+        const auto const_reset = model.add_block(create_block(BLK_NAME_CONST, f64, &reset_value));
+        const auto const_threshold = model.add_block(create_block(BLK_NAME_CONST, f64, &threshold));
+
+        const auto clock = model.add_block(create_block(BLK_NAME_CLOCK, f64, &time_step));
+        const auto gt = model.add_block(create_block(BLK_NAME_REL_GT, f64));
+        const auto add = model.add_block(create_block(BLK_NAME_ARITH_ADD, f64, &size));
+        const auto mul = model.add_block(create_block(BLK_NAME_ARITH_MUL, f64, &size));
+        const auto delay = model.add_block(create_block(BLK_NAME_DELAY, f64));
+        const auto integ = model.add_block(create_block(BLK_NAME_INTEG, f64, &time_step));
+
+        model.connect({clock, 0}, gt, 0);
+        model.connect({const_threshold, 0}, gt, 1);
+
+        model.connect({delay, 0}, add, 0);
+        model.connect({clock, 0}, add, 1);
+        model.connect({add, 0}, delay, 0);
+
+        model.connect({integ, 0}, mul, 0);
+        model.connect({const_gain, 0}, mul, 1);
+        model.connect({mul, 0}, integ, 0);
+
+        for (const auto blk : {delay, integ}) {
+            model.connect({const_reset, 0}, blk, 1);
+            model.connect({gt, 0}, blk, 2);
+        }
+
+        model.add_output({add, 0});
+        model.add_output({integ, 0});
+        model.add_output({clock, 0});
+    }
+
+    mtea::block_model model;
+};
+
+static std::vector<double> read_outputs(const mtea::block_model& model) {
+    std::vector<double> values;
+    for (const auto& port : model.get_outputs()) {
+        mtea::ArgumentBox<mtea::DataType::F64> value;
+        model.get_output(port, &value);
+        values.push_back(value.value);
+    }
+    return values;
+}
+
+static std::vector<std::vector<double>> step_outputs(mtea::block_model& model, const size_t num) {
+    std::vector<std::vector<double>> values;
+    for (size_t k = 0; k < num; ++k) {
+        model.step();
+        values.push_back(read_outputs(model));
+    }
+    return values;
+}
+
+TEST_CASE("Model State Restore", "[model]") {
+    for (const bool lazy : {false, true}) {
+        feedback_model m;
+        auto& model = m.model;
+        model.set_lazy_evaluation(lazy);
+        model.reset();
+
+        step_outputs(model, 4);
+        const auto image = model.save_state();
+        const auto expected = step_outputs(model, 6);
+
+        model.restore_state(image);
+        REQUIRE(step_outputs(model, 6) == expected);
+
+        // The restored port values feed the first step, such that restoring an earlier image twice gives equal results
+        model.restore_state(image);
+        REQUIRE(step_outputs(model, 6) == expected);
+    }
+}
+
+TEST_CASE("Model Clone", "[model]") {
+    feedback_model m;
+    auto& model = m.model;
+    REQUIRE(model.specialize_blocks() == 4);
+    model.reset();
+    step_outputs(model, 4);
+
+    auto copy = model.clone();
+    REQUIRE(copy.get_block_num() == model.get_block_num());
+    REQUIRE(read_outputs(copy) == read_outputs(model));
+
+    const auto expected = step_outputs(model, 6);
+    REQUIRE(step_outputs(copy, 6) == expected);
+
+    // The copy holds its own blocks, so resetting it leaves the original model unchanged
+    const auto current = read_outputs(model);
+    copy.reset();
+    REQUIRE(read_outputs(model) == current);
+    REQUIRE(read_outputs(copy) != current);
+
+    // Images may be transferred between a model and its clones
+    model.restore_state(copy.save_state());
+    REQUIRE(step_outputs(model, 10) == step_outputs(copy, 10));
+}
+
+TEST_CASE("Model State Ensemble", "[model]") {
+    const size_t INSTANCE_NUM = 4;
+
+    feedback_model shared;
+    shared.model.reset();
+    auto ensemble = shared.model.create_ensemble(INSTANCE_NUM);
+
+    std::vector<std::unique_ptr<feedback_model>> separate;
+    for (size_t i = 0; i < INSTANCE_NUM; ++i) {
+        separate.push_back(std::make_unique<feedback_model>());
+        separate.back()->model.reset();
+    }
+
+    for (size_t step = 0; step < 12; ++step) {
+        for (size_t i = 0; i < INSTANCE_NUM; ++i) {
+            // Only step a subset of instances to ensure the states diverge
+            if (step % (i + 1) != 0) {
+                continue;
+            }
+
+            shared.model.load_instance(ensemble, i);
+            shared.model.step();
+            ensemble.store(i);
+
+            separate[i]->model.step();
+            REQUIRE(read_outputs(shared.model) == read_outputs(separate[i]->model));
+        }
+    }
+
+    for (size_t i = 0; i < INSTANCE_NUM; ++i) {
+        shared.model.load_instance(ensemble, i);
+        REQUIRE(read_outputs(shared.model) == read_outputs(separate[i]->model));
+    }
+}
+
+#endif // MTEA_USE_FULL_LIB
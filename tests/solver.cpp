@@ -0,0 +1,472 @@
+// SPDX-License-Identifier: MIT
+
+#ifdef MTEA_USE_FULL_LIB
+
+#include <catch2/catch_all.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include "mtea.hpp"
+#include "mtea_creation.hpp"
+#include "mtea_model.hpp"
+#include "mtea_solver.hpp"
+#include "mtea_string.hpp"
+
+#include <array>
+#include <cmath>
+#include <numbers>
+#include <tuple>
+#include <vector>
+
+TEST_CASE("Solver Variable Step Decay", "[solver]") {
+    mtea::variable_step_solver solver(1, mtea::solver_tolerance{.relative = 1e-8, .absolute = 1e-10, .step_min = 1e-6, .step_max = 10.0});
+
+    const auto fcn = [](double, std::span<const double> x, std::span<double> dx) {
+        dx[0] = -2.0 * x[0];
+    };
+
+    std::vector<double> x = {1.0};
+    double t = 0.0;
+
+    while (t < 5.0) {
+        solver.set_time_step(std::min(solver.get_time_step(), 5.0 - t));
+        t += solver.step(t, x, fcn);
+        REQUIRE_THAT(x[0], Catch::Matchers::WithinAbs(std::exp(-2.0 * t), 1e-7));
+    }
+
+    REQUIRE(solver.get_accepted_num() < 500);
+}
+
+TEST_CASE("Solver Variable Step Non-Finite Derivative", "[solver]") {
+    using namespace mtea;
+
+    // The integrator input is 0 / 0, which can never be accepted at any step size
+    const auto f64 = std::to_array({DataType::F64});
+    const auto bool_type = std::to_array({DataType::BOOL});
+
+    const ArgumentBox<DataType::F64> time_step(0.01);
+    const ArgumentBox<DataType::F64> zero(0.0);
+    const ArgumentBox<DataType::BOOL> no_reset(false);
+    const ArgumentBox<DataType::U32> size(2);
+
+    block_model model;
+    const auto const_zero = model.add_block(create_block(BLK_NAME_CONST, f64, &zero));
+    const auto const_flag = model.add_block(create_block(BLK_NAME_CONST, bool_type, &no_reset));
+    const auto div = model.add_block(create_block(BLK_NAME_ARITH_DIV, f64, &size));
+    const auto integ = model.add_block(create_block(BLK_NAME_INTEG, f64, &time_step));
+
+    model.connect({const_zero, 0}, div, 0);
+    model.connect({const_zero, 0}, div, 1);
+    model.connect({div, 0}, integ, 0);
+    model.connect({const_zero, 0}, integ, 1);
+    model.connect({const_flag, 0}, integ, 2);
+    model.reset();
+
+    variable_step_solver solver(model.get_continuous_state_num(), solver_tolerance{.relative = 1e-6, .absolute = 1e-9, .step_min = 1e-6, .step_max = 1.0});
+    REQUIRE_THROWS_AS(model.step_variable(solver, 0.0), block_error);
+    REQUIRE(solver.get_accepted_num() == 0);
+    REQUIRE(solver.get_rejected_num() > 0);
+}
+
+TEST_CASE("Solver Variable Step Model", "[solver]") {
+    using namespace mtea;
+
+    // Harmonic oscillator built from two integrators in a model, driven by the solver instead of integrator_block::step()
+    const auto f64 = std::to_array({DataType::F64});
+    const auto bool_type = std::to_array({DataType::BOOL});
+
+    const ArgumentBox<DataType::F64> time_step(0.01);
+    const ArgumentBox<DataType::F64> one(1.0);
+    const ArgumentBox<DataType::F64> zero(0.0);
+    const ArgumentBox<DataType::F64> gain(-1.0);
+    const ArgumentBox<DataType::BOOL> no_reset(false);
+    const ArgumentBox<DataType::U32> size(2);
+
+    block_model model;
+    const auto const_one = model.add_block(create_block(BLK_NAME_CONST, f64, &one));
+    const auto const_zero = model.add_block(create_block(BLK_NAME_CONST, f64, &zero));
+    const auto const_gain = model.add_block(create_block(BLK_NAME_CONST, f64, &gain));
+    const auto const_flag = model.add_block(create_block(BLK_NAME_CONST, bool_type, &no_reset));
+
+    const auto pos = model.add_block(create_block(BLK_NAME_INTEG, f64, &time_step));
+    const auto vel = model.add_block(create_block(BLK_NAME_INTEG, f64, &time_step));
+    const auto mul = model.add_block(create_block(BLK_NAME_ARITH_MUL, f64, &size));
+    const auto clock = model.add_block(create_block(BLK_NAME_CLOCK, f64, &time_step));
+    const auto deriv = model.add_block(create_block(BLK_NAME_DERIV, f64, &time_step));
+
+    model.connect({vel, 0}, pos, 0);
+    model.connect({const_one, 0}, pos, 1);
+    model.connect({const_flag, 0}, pos, 2);
+    model.connect({pos, 0}, mul, 0);
+    model.connect({const_gain, 0}, mul, 1);
+    model.connect({mul, 0}, vel, 0);
+    model.connect({const_zero, 0}, vel, 1);
+    model.connect({const_flag, 0}, vel, 2);
+    model.connect({pos, 0}, deriv, 0);
+    model.connect({const_flag, 0}, deriv, 1);
+
+    model.reset();
+    REQUIRE(model.get_continuous_state_num() == 2);
+
+    variable_step_solver solver(model.get_continuous_state_num(), solver_tolerance{.relative = 1e-9, .absolute = 1e-12, .step_min = 1e-8, .step_max = 0.5});
+    variable_step_solver mismatched(1);
+    REQUIRE_THROWS(model.step_variable(mismatched, 0.0));
+
+    ArgumentBox<DataType::F64> x;
+    ArgumentBox<DataType::F64> v;
+    ArgumentBox<DataType::F64> t_clock;
+    ArgumentBox<DataType::F64> dx;
+
+    double t = 0.0;
+    double x_prev = 0.0;
+    size_t step_num = 0;
+
+    while (t < 10.0) {
+        const double h = model.step_variable(solver, t);
+        t += h;
+        step_num += 1;
+
+        model.get_output({pos, 0}, &x);
+        model.get_output({vel, 0}, &v);
+        model.get_output({clock, 0}, &t_clock);
+        model.get_output({deriv, 0}, &dx);
+
+        REQUIRE_THAT(x.value, Catch::Matchers::WithinAbs(std::cos(t), 1e-6));
+        REQUIRE_THAT(v.value, Catch::Matchers::WithinAbs(-std::sin(t), 1e-6));
+
+        // The step size is published to the discrete blocks, such that the clock follows the solver time and the
+        // derivative block divides by the step actually taken
+        REQUIRE_THAT(t_clock.value, Catch::Matchers::WithinAbs(t, 1e-9));
+        if (step_num > 1) {
+            REQUIRE_THAT(dx.value, Catch::Matchers::WithinRel((x.value - x_prev) / h, 1e-12));
+        }
+
+        x_prev = x.value;
+    }
+
+    REQUIRE(model.get_evaluation_num() > 0);
+    REQUIRE(step_num < 1000);
+}
+
+TEST_CASE("Solver Variable Step Model Generators", "[solver]") {
+    using namespace mtea;
+
+    // The decaying state keeps the solver changing its step size, which the generators must follow
+    const auto f64 = std::to_array({DataType::F64});
+    const auto bool_type = std::to_array({DataType::BOOL});
+
+    const ArgumentBox<DataType::F64> time_step(0.01);
+    const ArgumentBox<DataType::F64> one(1.0);
+    const ArgumentBox<DataType::F64> gain(-1.0);
+    const ArgumentBox<DataType::BOOL> no_reset(false);
+    const ArgumentBox<DataType::U32> size(2);
+
+    block_model model;
+    const auto const_one = model.add_block(create_block(BLK_NAME_CONST, f64, &one));
+    const auto const_gain = model.add_block(create_block(BLK_NAME_CONST, f64, &gain));
+    const auto const_flag = model.add_block(create_block(BLK_NAME_CONST, bool_type, &no_reset));
+
+    const auto integ = model.add_block(create_block(BLK_NAME_INTEG, f64, &time_step));
+    const auto mul = model.add_block(create_block(BLK_NAME_ARITH_MUL, f64, &size));
+    const auto clock = model.add_block(create_block(BLK_NAME_CLOCK, f64, &time_step));
+    const auto sine = model.add_block(create_block(BLK_NAME_SINE_WAVE, f64, &time_step));
+    const auto ramp = model.add_block(create_block(BLK_NAME_RAMP, f64, &time_step));
+    const auto chirp = model.add_block(create_block(BLK_NAME_CHIRP, f64, &time_step));
+
+    model.connect({integ, 0}, mul, 0);
+    model.connect({const_gain, 0}, mul, 1);
+    model.connect({mul, 0}, integ, 0);
+    model.connect({const_one, 0}, integ, 1);
+    model.connect({const_flag, 0}, integ, 2);
+    model.reset();
+
+    variable_step_solver solver(model.get_continuous_state_num(), solver_tolerance{.relative = 1e-12, .absolute = 1e-14, .step_min = 1e-8, .step_max = 0.05});
+
+    ArgumentBox<DataType::F64> t_clock;
+    ArgumentBox<DataType::F64> sine_value;
+    ArgumentBox<DataType::F64> ramp_value;
+    ArgumentBox<DataType::F64> chirp_value;
+
+    double t = 0.0;
+    double h_min = 1.0;
+    double h_max = 0.0;
+
+    while (t < 2.0) {
+        const double h = model.step_variable(solver, t);
+        t += h;
+        h_min = std::min(h_min, h);
+        h_max = std::max(h_max, h);
+
+        model.get_output({clock, 0}, &t_clock);
+        model.get_output({sine, 0}, &sine_value);
+        model.get_output({ramp, 0}, &ramp_value);
+        model.get_output({chirp, 0}, &chirp_value);
+
+        const double two_pi = 2.0 * std::numbers::pi;
+        REQUIRE_THAT(t_clock.value, Catch::Matchers::WithinAbs(t, 1e-9));
+        REQUIRE_THAT(sine_value.value, Catch::Matchers::WithinAbs(std::sin(two_pi * t), 1e-9));
+        REQUIRE_THAT(ramp_value.value, Catch::Matchers::WithinAbs(t, 1e-9));
+
+        // The default chirp sweeps from 1 Hz to 10 Hz over one second
+        if (t < 0.9) {
+            REQUIRE_THAT(chirp_value.value, Catch::Matchers::WithinAbs(std::sin(two_pi * (t + 4.5 * t * t)), 1e-8));
+        }
+    }
+
+    REQUIRE(h_min < h_max);
+}
+
+TEST_CASE("Solver Variable Step Model Zero Crossing", "[solver]") {
+    using namespace mtea;
+
+    // The state rises with a slope of one until it exceeds the threshold, after which the switch selects a slope of three
+    const auto f64 = std::to_array({DataType::F64});
+    const auto bool_type = std::to_array({DataType::BOOL});
+
+    const ArgumentBox<DataType::F64> time_step(0.1);
+    const ArgumentBox<DataType::F64> threshold(0.5);
+    const ArgumentBox<DataType::F64> slope_low(1.0);
+    const ArgumentBox<DataType::F64> slope_high(3.0);
+    const ArgumentBox<DataType::F64> zero(0.0);
+    const ArgumentBox<DataType::BOOL> no_reset(false);
+
+    const auto run = [&](const bool detect) {
+        block_model model;
+        const auto const_threshold = model.add_block(create_block(BLK_NAME_CONST, f64, &threshold));
+        const auto const_low = model.add_block(create_block(BLK_NAME_CONST, f64, &slope_low));
+        const auto const_high = model.add_block(create_block(BLK_NAME_CONST, f64, &slope_high));
+        const auto const_zero = model.add_block(create_block(BLK_NAME_CONST, f64, &zero));
+        const auto const_flag = model.add_block(create_block(BLK_NAME_CONST, bool_type, &no_reset));
+
+        const auto integ = model.add_block(create_block(BLK_NAME_INTEG, f64, &time_step));
+        const auto gt = model.add_block(create_block(BLK_NAME_REL_GT, f64));
+        const auto sw = model.add_block(create_block(BLK_NAME_SWITCH, f64));
+
+        model.connect({integ, 0}, gt, 0);
+        model.connect({const_threshold, 0}, gt, 1);
+        model.connect({gt, 0}, sw, 0);
+        model.connect({const_high, 0}, sw, 1);
+        model.connect({const_low, 0}, sw, 2);
+        model.connect({sw, 0}, integ, 0);
+        model.connect({const_zero, 0}, integ, 1);
+        model.connect({const_flag, 0}, integ, 2);
+        model.reset();
+
+        // Only the relational block provides a guard, as the switch changes with the flag it produces
+        REQUIRE(model.get_zero_crossing_num() == 1);
+
+        variable_step_solver solver(1, solver_tolerance{.relative = 1e-10, .absolute = 1e-12, .step_min = 1e-10, .step_max = 1.0});
+        zero_crossing_detector detector(model.get_zero_crossing_num());
+
+        double t = 0.0;
+        double t_event = 0.0;
+        while (t < 2.0 - 1e-12) {
+            solver.set_time_step(std::min(solver.get_time_step(), 2.0 - t));
+            const double h = model.step_variable(solver, t, detect ? &detector : nullptr);
+            if (t < 0.5 && t + h >= 0.5) {
+                t_event = t + h;
+            }
+            t += h;
+        }
+
+        ArgumentBox<DataType::F64> x;
+        model.get_output({integ, 0}, &x);
+        return std::make_tuple(x.value, t_event, solver.get_accepted_num() + solver.get_rejected_num());
+    };
+
+    const auto [x_detect, t_detect, steps_detect] = run(true);
+
+    // A step ends just after the event, and the state then follows the new slope exactly
+    REQUIRE(t_detect >= 0.5);
+    REQUIRE_THAT(t_detect, Catch::Matchers::WithinAbs(0.5, 1e-9));
+    REQUIRE_THAT(x_detect, Catch::Matchers::WithinAbs(0.5 + 3.0 * 1.5, 1e-8));
+
+    // Without detection the error control finds the discontinuity by rejecting steps instead
+    REQUIRE(steps_detect < std::get<2>(run(false)));
+}
+
+TEST_CASE("Solver Implicit Model", "[solver]") {
+    using namespace mtea;
+
+    const auto f64 = std::to_array({DataType::F64});
+    const auto bool_type = std::to_array({DataType::BOOL});
+
+    const ArgumentBox<DataType::F64> time_step(0.05);
+    const ArgumentBox<DataType::F64> one(1.0);
+    const ArgumentBox<DataType::F64> gain(-1000.0);
+    const ArgumentBox<DataType::BOOL> no_reset(false);
+    const ArgumentBox<DataType::U32> size(2);
+
+    block_model model;
+    const auto const_one = model.add_block(create_block(BLK_NAME_CONST, f64, &one));
+    const auto const_gain = model.add_block(create_block(BLK_NAME_CONST, f64, &gain));
+    const auto const_flag = model.add_block(create_block(BLK_NAME_CONST, bool_type, &no_reset));
+    const auto integ = model.add_block(create_block(BLK_NAME_INTEG, f64, &time_step));
+    const auto mul = model.add_block(create_block(BLK_NAME_ARITH_MUL, f64, &size));
+    const auto clock = model.add_block(create_block(BLK_NAME_CLOCK, f64, &time_step));
+
+    model.connect({integ, 0}, mul, 0);
+    model.connect({const_gain, 0}, mul, 1);
+    model.connect({mul, 0}, integ, 0);
+    model.connect({const_one, 0}, integ, 1);
+    model.connect({const_flag, 0}, integ, 2);
+    model.add_output({integ, 0});
+
+    // Specialized integrators and arithmetic blocks are driven the same way
+    model.specialize_blocks();
+    model.reset();
+
+    implicit_solver solver(model.get_continuous_state_num());
+    REQUIRE(solver.get_state_num() == 1);
+
+    // Backward Euler stays stable with a step twenty times the explicit stability limit
+    const double h = 0.04;
+    double expected = 1.0;
+    for (size_t k = 1; k <= 50; ++k) {
+        model.step_implicit(solver, static_cast<double>(k - 1) * h, h);
+        expected /= 1.0 + 1000.0 * h;
+
+        ArgumentBox<DataType::F64> x;
+        ArgumentBox<DataType::F64> t_clock;
+        model.get_output(model.get_outputs()[0], &x);
+        model.get_output({clock, 0}, &t_clock);
+
+        REQUIRE_THAT(x.value, Catch::Matchers::WithinAbs(expected, 1e-9));
+        REQUIRE_THAT(t_clock.value, Catch::Matchers::WithinAbs(static_cast<double>(k) * h, 1e-12));
+    }
+}
+
+TEST_CASE("Solver Implicit Stiff", "[solver]") {
+    const auto fcn = [](double t, std::span<const double> x, std::span<double> dx) {
+        dx[0] = -1000.0 * (x[0] - std::cos(t));
+    };
+
+    for (const auto method : {mtea::ImplicitMethod::BACKWARD_EULER, mtea::ImplicitMethod::BDF2}) {
+        mtea::implicit_solver solver(1, method);
+
+        std::vector<double> x = {0.0};
+        const double h = 0.01;
+
+        for (size_t i = 0; i < 500; ++i) {
+            solver.step(static_cast<double>(i) * h, h, x, fcn);
+        }
+
+        REQUIRE_THAT(x[0], Catch::Matchers::WithinAbs(std::cos(5.0), 1e-3));
+        REQUIRE(solver.get_jacobian_num() == 1);
+        REQUIRE(solver.get_factorization_num() <= 2);
+    }
+}
+
+TEST_CASE("Solver Implicit Singular Retry", "[solver]") {
+    const auto fcn = [](double, std::span<const double> x, std::span<double> dx) {
+        dx[0] = x[0];
+        dx[1] = x[0] + x[1];
+    };
+
+    mtea::implicit_solver solver(2);
+    std::vector<double> x = {1.0, 1.0};
+
+    solver.step(0.0, 0.5, x, fcn);
+    REQUIRE_THAT(x[0], Catch::Matchers::WithinAbs(2.0, 1e-9));
+    const size_t jacobian_num = solver.get_jacobian_num();
+
+    // I - hJ is singular for h = 1, which must not leave a partial factorization to be reused by later steps
+    REQUIRE_THROWS(solver.step(0.5, 1.0, x, fcn));
+    REQUIRE(solver.get_jacobian_num() == jacobian_num);
+
+    solver.step(0.5, 0.5, x, fcn);
+    REQUIRE_THAT(x[0], Catch::Matchers::WithinAbs(4.0, 1e-9));
+    REQUIRE_THAT(x[1], Catch::Matchers::WithinAbs(12.0, 1e-9));
+    REQUIRE(solver.get_jacobian_num() == jacobian_num);
+}
+
+TEST_CASE("Solver Implicit Sparse Coloring", "[solver]") {
+    const size_t N = 20;
+
+    // Diffusion along a chain, so that each derivative depends on its neighbors only
+    const auto fcn = [N](double, std::span<const double> x, std::span<double> dx) {
+        for (size_t i = 0; i < N; ++i) {
+            const double left = i > 0 ? x[i - 1] : 0.0;
+            const double right = i + 1 < N ? x[i + 1] : 0.0;
+            dx[i] = 500.0 * (left - 2.0 * x[i] + right);
+        }
+    };
+
+    std::vector<std::vector<size_t>> deps(N);
+    for (size_t i = 0; i < N; ++i) {
+        for (size_t j = (i > 0 ? i - 1 : 0); j <= std::min(i + 1, N - 1); ++j) {
+            deps[i].push_back(j);
+        }
+    }
+
+    mtea::implicit_solver sparse(N);
+    sparse.set_sparsity(deps);
+    REQUIRE(sparse.get_color_num() == 3);
+
+    mtea::implicit_solver dense(N);
+    REQUIRE(dense.get_color_num() == N);
+
+    std::vector<double> x_sparse(N, 1.0);
+    std::vector<double> x_dense(N, 1.0);
+
+    for (size_t i = 0; i < 100; ++i) {
+        sparse.step(static_cast<double>(i) * 0.01, 0.01, x_sparse, fcn);
+        dense.step(static_cast<double>(i) * 0.01, 0.01, x_dense, fcn);
+    }
+
+    for (size_t i = 0; i < N; ++i) {
+        REQUIRE_THAT(x_sparse[i], Catch::Matchers::WithinAbs(x_dense[i], 1e-8));
+        REQUIRE(std::abs(x_sparse[i]) < 1.0);
+    }
+}
+
+TEST_CASE("Solver Zero Crossing Relational", "[solver]") {
+    mtea::relational_block<mtea::DataType::F64, mtea::RelationalOperator::GREATER_THAN> rel;
+    mtea::limiter_block<mtea::DataType::F64> lim;
+
+    lim.s_in.limit_lower = -0.25;
+    lim.s_in.limit_upper = 0.75;
+
+    std::vector<mtea::block_interface*> blocks = {&rel, &lim};
+
+    const auto fcn = [&](double t, std::span<double> g) {
+        rel.s_in.value_a = std::sin(t);
+        rel.s_in.value_b = 0.5;
+        lim.s_in.value = std::sin(t);
+
+        size_t idx = 0;
+        for (const auto* b : blocks) {
+            for (size_t i = 0; i < b->get_zero_crossing_num(); ++i) {
+                g[idx++] = b->get_zero_crossing(i);
+            }
+        }
+    };
+
+    REQUIRE(rel.get_zero_crossing_num() == 1);
+    REQUIRE(lim.get_zero_crossing_num() == 2);
+    REQUIRE_THROWS(lim.get_zero_crossing(2));
+
+    mtea::zero_crossing_detector detector(3);
+    std::vector<double> g(3, 0.0);
+
+    fcn(0.1, g);
+    detector.reset(g);
+
+    fcn(1.0, g);
+    REQUIRE(detector.check(g));
+
+    const double t_event = detector.locate(0.1, 1.0, fcn, 1e-12);
+    REQUIRE_THAT(t_event, Catch::Matchers::WithinAbs(std::asin(0.5), 1e-10));
+    REQUIRE(detector.get_event_index() == 0);
+
+    fcn(t_event, g);
+    detector.reset(g);
+
+    fcn(1.0, g);
+    REQUIRE(detector.check(g));
+
+    const double t_limit = detector.locate(t_event, 1.0, fcn, 1e-12);
+    REQUIRE_THAT(t_limit, Catch::Matchers::WithinAbs(std::asin(0.75), 1e-10));
+    REQUIRE(detector.get_event_index() == 2);
+}
+
+#endif // MTEA_USE_FULL_LIB
@@ -0,0 +1,240 @@
+// SPDX-License-Identifier: MIT
+
+#ifdef MTEA_USE_FULL_LIB
+
+#include <catch2/catch_all.hpp>
+
+#include "mtea.hpp"
+#include "mtea_state.hpp"
+
+#include <array>
+#include <memory>
+#include <tuple>
+#include <vector>
+
+struct state_test_model {
+    state_test_model() : clock(0.1), deriv(0.1), integ(0.1) {
+        delay.s_in.reset = 0.0;
+        delay.s_in.reset_flag = false;
+        deriv.s_in.reset_flag = false;
+        integ.s_in.reset = 1.0;
+        integ.s_in.reset_flag = false;
+        sw.s_in.value_flag = true;
+        sw.s_in.value_a = 1.0;
+        sw.s_in.value_b = 2.0;
+
+        for (auto* b : blocks) {
+            b->reset();
+        }
+    }
+
+    void step() {
+        delay.s_in.value = clock.s_out.value;
+        deriv.s_in.value = delay.s_out.value * delay.s_out.value;
+        integ.s_in.value = deriv.s_out.value;
+
+        for (auto* b : blocks) {
+            b->step();
+        }
+    }
+
+    std::array<double, 4> outputs() const {
+        return {clock.s_out.value, delay.s_out.value, deriv.s_out.value, integ.s_out.value};
+    }
+
+    mtea::clock_block<mtea::DataType::F64> clock;
+    mtea::delay_block<mtea::DataType::F64> delay;
+    mtea::derivative_block<mtea::DataType::F64> deriv;
+    mtea::integrator_block<mtea::DataType::F64> integ;
+    mtea::switch_block<mtea::DataType::F64> sw;
+
+    std::array<mtea::block_interface*, 5> blocks = {&clock, &delay, &deriv, &integ, &sw};
+};
+
+TEST_CASE("State Snapshot Restore", "[state]") {
+    state_test_model model;
+
+    for (size_t i = 0; i < 25; ++i) {
+        model.step();
+    }
+
+    mtea::state_image image;
+    image.capture(model.blocks);
+    REQUIRE(image.get_block_num() == model.blocks.size());
+
+    std::vector<std::array<double, 4>> expected;
+    for (size_t i = 0; i < 25; ++i) {
+        model.step();
+        expected.push_back(model.outputs());
+    }
+
+    image.restore(model.blocks);
+
+    for (const auto& e : expected) {
+        model.step();
+        REQUIRE(model.outputs() == e);
+    }
+}
+
+TEST_CASE("State Snapshot Transfer", "[state]") {
+    state_test_model model_a;
+    state_test_model model_b;
+
+    for (size_t i = 0; i < 10; ++i) {
+        model_a.step();
+    }
+
+    mtea::state_image image;
+    image.capture(model_a.blocks);
+
+    const std::vector<std::byte> file_data(image.get_data().begin(), image.get_data().end());
+    mtea::restore_state_image(model_b.blocks, file_data);
+
+    for (size_t i = 0; i < 10; ++i) {
+        model_a.step();
+        model_b.step();
+        REQUIRE(model_a.outputs() == model_b.outputs());
+    }
+}
+
+TEST_CASE("State Snapshot Invalid", "[state]") {
+    state_test_model model;
+
+    mtea::state_image image;
+    image.capture(model.blocks);
+
+    std::vector<std::byte> data(image.get_data().begin(), image.get_data().end());
+
+    const auto short_blocks = std::span(model.blocks).first(3);
+    REQUIRE_THROWS(mtea::restore_state_image(short_blocks, data));
+
+    data[0] = std::byte{0};
+    REQUIRE_THROWS(mtea::restore_state_image(model.blocks, data));
+    REQUIRE_THROWS(mtea::state_image(data));
+
+    REQUIRE_THROWS(mtea::restore_state_image(model.blocks, std::span(data).first(4)));
+}
+
+TEST_CASE("State Reset Image", "[state]") {
+    mtea::arith_block<mtea::DataType::F64, mtea::ArithType::ADD, 2> add;
+    mtea::limiter_block<mtea::DataType::F64> lim;
+    mtea::conversion_block<mtea::DataType::F64, mtea::DataType::I32> conv;
+    mtea::delay_block<mtea::DataType::F64> delay;
+
+    std::array<mtea::block_interface*, 4> blocks = {&add, &lim, &conv, &delay};
+
+    const auto reset_model = [&]() {
+        add.s_in.values[0] = 1.5;
+        add.s_in.values[1] = 2.0;
+        add.reset();
+
+        lim.s_in.value = add.s_out.value;
+        lim.s_in.limit_lower = 0.0;
+        lim.s_in.limit_upper = 3.0;
+        lim.reset();
+
+        conv.s_in.value = lim.s_out.value;
+        conv.reset();
+
+        delay.s_in.reset = lim.s_out.value;
+        delay.s_in.reset_flag = false;
+        delay.reset();
+    };
+
+    const auto outputs = [&]() {
+        return std::make_tuple(add.s_out.value, lim.s_out.value, conv.s_out.value, delay.s_out.value, delay.next_value);
+    };
+
+    reset_model();
+    const auto expected = outputs();
+
+    mtea::state_image reset_image;
+    reset_image.capture(blocks);
+
+    for (size_t i = 0; i < 5; ++i) {
+        add.s_in.values[0] = static_cast<double>(i) - 10.0;
+        add.step();
+        lim.s_in.value = add.s_out.value;
+        lim.step();
+        conv.s_in.value = lim.s_out.value;
+        conv.step();
+        delay.s_in.value = conv.s_out.value;
+        delay.step();
+    }
+
+    REQUIRE(outputs() != expected);
+
+    reset_image.restore(blocks);
+    REQUIRE(outputs() == expected);
+    REQUIRE(conv.s_out.value == 3);
+}
+
+TEST_CASE("State Ensemble", "[state]") {
+    const size_t INSTANCE_NUM = 8;
+
+    state_test_model shared;
+    mtea::state_ensemble ensemble(shared.blocks, INSTANCE_NUM);
+
+    REQUIRE(ensemble.get_instance_num() == INSTANCE_NUM);
+    REQUIRE(ensemble.get_instance_size() < sizeof(state_test_model));
+
+    std::vector<std::unique_ptr<state_test_model>> separate;
+    for (size_t i = 0; i < INSTANCE_NUM; ++i) {
+        separate.push_back(std::make_unique<state_test_model>());
+    }
+
+    for (size_t step = 0; step < 20; ++step) {
+        for (size_t i = 0; i < INSTANCE_NUM; ++i) {
+            // Only step a subset of instances to ensure the states diverge
+            if (step % (i + 1) != 0) {
+                continue;
+            }
+
+            ensemble.load(i);
+            shared.step();
+            ensemble.store(i);
+
+            separate[i]->step();
+        }
+    }
+
+    for (size_t i = 0; i < INSTANCE_NUM; ++i) {
+        ensemble.load(i);
+        REQUIRE(shared.outputs() == separate[i]->outputs());
+    }
+
+    REQUIRE_THROWS(ensemble.load(INSTANCE_NUM));
+}
+
+TEST_CASE("State Ensemble Noise Instances", "[state]") {
+    const size_t INSTANCE_NUM = 2;
+
+    mtea::uniform_noise_block<mtea::DataType::F64> noise(7);
+    const auto blocks = std::to_array<mtea::block_interface*>({&noise});
+    mtea::state_ensemble ensemble(blocks, INSTANCE_NUM);
+
+    std::array<double, INSTANCE_NUM> values{};
+    for (size_t i = 0; i < INSTANCE_NUM; ++i) {
+        mtea::uniform_noise_block<mtea::DataType::F64> separate(7, i);
+        separate.reset();
+
+        ensemble.load(i);
+        REQUIRE(noise.s_out.value == separate.s_out.value);
+
+        for (size_t step = 0; step < 5; ++step) {
+            noise.step();
+            separate.step();
+            REQUIRE(noise.s_out.value == separate.s_out.value);
+        }
+
+        ensemble.store(i);
+        values[i] = noise.s_out.value;
+    }
+
+    REQUIRE(values[0] != values[1]);
+
+    ensemble.load(1);
+    REQUIRE(noise.s_out.value == values[1]);
+}
+
+#endif // MTEA_USE_FULL_LIB